@@ -147,8 +147,11 @@ FMaterialAnalysisResults AnalyzeMaterialUsage(UWorld* TargetWorld)
 			TArray<UMaterialInterface*> Materials;
 			constexpr bool bGetDebugMaterials = false;
 			PrimitiveComponent->GetUsedMaterials(OUT Materials, bGetDebugMaterials);
-			auto& Stats =
-				Results.MeshStatsByCombo.FindOrAdd(MeshMaterialCombinationType{Mesh, ArrayToString(Materials)});
+			// Build the key in inline storage, so the only allocation is the final key string
+			TStringBuilder<1024> MaterialsKey;
+			AppendArrayToString(MaterialsKey, Materials);
+			auto& Stats = Results.MeshStatsByCombo.FindOrAdd(
+				MeshMaterialCombinationType{Mesh, FString(MaterialsKey.ToView())});
 			if (Stats.MaterialObjects.Num() == 0)
 			{
 				// Move materials into stats. Only access the material member after this!
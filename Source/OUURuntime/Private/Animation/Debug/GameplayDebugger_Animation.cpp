@@ -162,29 +162,33 @@ void FGameplayDebuggerCategory_Animation::DrawSceneComponentTree(
 		},
 		// OnGetDebugString
 		[&](USceneComponent* SceneComponent) -> FString {
+			// Called for every component in every frame, so build the line in inline storage instead of concatenating
+			// temporary strings
+			TStringBuilder<512> DebugString;
+			DebugString << TEXT("[{yellow}");
 			const FName SocketName = SceneComponent->GetAttachSocketName();
-			const FString SocketNameString = (SocketName == NAME_None ? FString("") : SocketName.ToString());
-			const FString ColorString = SceneComponent == DebugMeshComponent ? "{green}" : "{white}";
-			const FString SceneComponentName = SceneComponent->GetName();
-			FString OptionalMeshString = "";
+			if (SocketName != NAME_None)
+			{
+				SocketName.AppendString(DebugString);
+			}
+			DebugString << TEXT("{white}] ");
+			DebugString << (SceneComponent == DebugMeshComponent ? TEXT("{green}") : TEXT("{white}"));
+			SceneComponent->GetFName().AppendString(DebugString);
+			DebugString << TEXT(" ");
 			if (const auto* StaticMeshComponent = Cast<UStaticMeshComponent>(SceneComponent))
 			{
-				OptionalMeshString = FString::Printf(TEXT("(%s)"), *LexToString(StaticMeshComponent->GetStaticMesh()));
+				DebugString << TEXT("(");
+				LexAppend(DebugString, StaticMeshComponent->GetStaticMesh());
+				DebugString << TEXT(")");
 			}
 			else if (const auto* SkeletalMeshComponent = Cast<USkeletalMeshComponent>(SceneComponent))
 			{
-				OptionalMeshString =
-					FString::Printf(TEXT("(%s)"), *LexToString(SkeletalMeshComponent->GetSkeletalMeshAsset()));
+				DebugString << TEXT("(");
+				LexAppend(DebugString, SkeletalMeshComponent->GetSkeletalMeshAsset());
+				DebugString << TEXT(")");
 			}
-
-			return FString::Printf(
-				TEXT("[{yellow}%s{white}] %s%s %s\n"
-					 "\t\t{grey}T|R|S = %s"),
-				*SocketNameString,
-				*ColorString,
-				*SceneComponentName,
-				*OptionalMeshString,
-				*SceneComponent->GetRelativeTransform().ToString());
+			DebugString << TEXT("\n\t\t{grey}T|R|S = ") << SceneComponent->GetRelativeTransform().ToString();
+			return FString(DebugString.ToView());
 		});
 }
 
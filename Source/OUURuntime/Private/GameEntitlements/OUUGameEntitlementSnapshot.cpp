@@ -0,0 +1,144 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#include "GameEntitlements/OUUGameEntitlementSnapshot.h"
+
+#include "Algo/AllOf.h"
+#include "GameEntitlements/OUUGameEntitlementsSettings.h"
+#include "Templates/ReadMostlyVariable.h"
+
+namespace OUU::Runtime::GameEntitlements::Private
+{
+	// Static storage instead of a subsystem member, so snapshots can be read before the engine is created and while
+	// it's torn down. Readers only copy the shared ref, so they never contend with each other or with publishing.
+	TRcuVariable<FOUUGameEntitlementSnapshotRef>& GetCurrentSnapshotVariable()
+	{
+		static TRcuVariable<FOUUGameEntitlementSnapshotRef> CurrentSnapshot{
+			MakeShared<FOUUGameEntitlementSnapshot, ESPMode::ThreadSafe>()};
+		return CurrentSnapshot;
+	}
+} // namespace OUU::Runtime::GameEntitlements::Private
+
+FOUUGameEntitlementSnapshotRef FOUUGameEntitlementSnapshot::Create(
+	uint32 SerialNumber,
+	const FOUUGameEntitlementVersion& ActiveVersion,
+	const FGameplayTagContainer& ActiveEntitlements,
+	const FOUUGameEntitlementBitSet& ActiveEntitlementBits,
+	const TMap<FGameplayTag, int32>& EntitlementIndices,
+	TConstArrayView<FOUUGameEntitlementContentRule> ContentRules)
+{
+	auto Snapshot = MakeShared<FOUUGameEntitlementSnapshot, ESPMode::ThreadSafe>();
+	Snapshot->bIsInitialized = true;
+	Snapshot->SerialNumber = SerialNumber;
+	Snapshot->ActiveVersion = ActiveVersion;
+	Snapshot->ActiveEntitlements = ActiveEntitlements;
+	Snapshot->ActiveEntitlementBits = ActiveEntitlementBits;
+	Snapshot->EntitlementIndices = EntitlementIndices;
+
+	// Evaluate the content rules once, so readers only have to check content against the blocked rules
+	for (const FOUUGameEntitlementContentRule& Rule : ContentRules)
+	{
+		const bool bIsRuleEntitled = Algo::AllOf(Rule.RequiredModules, [&Snapshot](const FGameplayTag& Module) {
+			return Snapshot->IsEntitled(Module);
+		});
+		if (bIsRuleEntitled)
+			continue;
+
+		FString Directory = Rule.ContentDirectory.Path;
+		Directory.RemoveFromEnd(TEXT("/"));
+		if (Directory.Len() > 0)
+		{
+			Snapshot->BlockedContentDirectories.AddUnique(MoveTemp(Directory));
+		}
+		if (Rule.PrimaryAssetType.IsValid())
+		{
+			Snapshot->BlockedPrimaryAssetTypes.AddUnique(Rule.PrimaryAssetType);
+		}
+	}
+	return Snapshot;
+}
+
+FOUUGameEntitlementSnapshotRef FOUUGameEntitlementSnapshot::GetCurrent()
+{
+	return OUU::Runtime::GameEntitlements::Private::GetCurrentSnapshotVariable().Read().Get();
+}
+
+void FOUUGameEntitlementSnapshot::Publish(const FOUUGameEntitlementSnapshotRef& Snapshot)
+{
+	OUU::Runtime::GameEntitlements::Private::GetCurrentSnapshotVariable().Set(Snapshot);
+}
+
+bool FOUUGameEntitlementSnapshot::IsEntitled(const FGameplayTag& ModuleOrCollection) const
+{
+	// Invalid = empty tag should be treated as asking for "no requirements"
+	if (ModuleOrCollection.IsValid() == false)
+		return true;
+
+	const int32* IndexPtr = EntitlementIndices.Find(ModuleOrCollection);
+	return IndexPtr && ActiveEntitlementBits.Contains(*IndexPtr);
+}
+
+bool FOUUGameEntitlementSnapshot::IsEntitled(const FOUUGameEntitlementBitSet& RequiredEntitlements) const
+{
+	return ActiveEntitlementBits.ContainsAll(RequiredEntitlements);
+}
+
+FOUUGameEntitlementBitSet FOUUGameEntitlementSnapshot::MakeEntitlementMask(
+	const FOUUGameEntitlementModules_Ref& Modules) const
+{
+	return MakeEntitlementMask(Modules.Get());
+}
+
+FOUUGameEntitlementBitSet FOUUGameEntitlementSnapshot::MakeEntitlementMask(
+	const FGameplayTagContainer& ModulesAndCollections) const
+{
+	// Same as UOUUGameEntitlementsSubsystem::MakeEntitlementMask(): Unknown tags add the never active index 0
+	FOUUGameEntitlementBitSet Result;
+	for (const FGameplayTag& Tag : ModulesAndCollections)
+	{
+		const int32* IndexPtr = EntitlementIndices.Find(Tag);
+		Result.Add(IndexPtr ? *IndexPtr : 0);
+	}
+	return Result;
+}
+
+bool FOUUGameEntitlementSnapshot::IsEntitledToContent(const FSoftObjectPath& Path) const
+{
+	if (BlockedContentDirectories.Num() == 0 || Path.IsNull())
+		return true;
+
+	TStringBuilder<256> PackageName;
+	Path.GetLongPackageFName().AppendString(PackageName);
+	const FStringView PackageNameView = PackageName.ToView();
+
+	for (const FString& Directory : BlockedContentDirectories)
+	{
+		// Match the directory itself and all sub-paths, but not siblings with the same prefix (e.g. /Game/DLC10)
+		if (PackageNameView.StartsWith(Directory)
+			&& (PackageNameView.Len() == Directory.Len() || PackageNameView[Directory.Len()] == TCHAR('/')))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FOUUGameEntitlementSnapshot::IsEntitledToContent(const FPrimaryAssetId& AssetId) const
+{
+	return BlockedPrimaryAssetTypes.Contains(AssetId.PrimaryAssetType) == false;
+}
+
+int32 FOUUGameEntitlementSnapshot::RemoveUnentitledContent(TArray<FSoftObjectPath>& Paths) const
+{
+	if (BlockedContentDirectories.Num() == 0)
+		return 0;
+
+	return Paths.RemoveAll([this](const FSoftObjectPath& Path) { return IsEntitledToContent(Path) == false; });
+}
+
+int32 FOUUGameEntitlementSnapshot::RemoveUnentitledContent(TArray<FPrimaryAssetId>& AssetIds) const
+{
+	if (BlockedPrimaryAssetTypes.Num() == 0)
+		return 0;
+
+	return AssetIds.RemoveAll([this](const FPrimaryAssetId& AssetId) { return IsEntitledToContent(AssetId) == false; });
+}
@@ -49,14 +49,52 @@ UOUUGameEntitlementsSubsystem& UOUUGameEntitlementsSubsystem::Get()
 bool UOUUGameEntitlementsSubsystem::IsEntitled(const FOUUGameEntitlementModule& Module) const
 {
 	// Invalid = empty tag should be treated as asking for "no requirements"
-	return Module.IsValid() == false
-		|| ActiveEntitlements.HasTag(FOUUGameEntitlementModuleAndCollection::ConvertChecked(Module));
+	return Module.IsValid() == false || IsEntitledToIndex(GetEntitlementIndex(Module));
 }
 
 bool UOUUGameEntitlementsSubsystem::IsEntitled(const FOUUGameEntitlementModules_Ref& Modules) const
 {
 	// Expected to return true if Modules is empty
-	return ActiveEntitlements.HasAll(FOUUGameEntitlementModuleAndCollections_Value::CreateChecked(Modules.Get()));
+	for (const FGameplayTag& Module : Modules.Get())
+	{
+		if (IsEntitledToIndex(GetEntitlementIndex(Module)) == false)
+			return false;
+	}
+	return true;
+}
+
+bool UOUUGameEntitlementsSubsystem::IsEntitled(const FOUUGameEntitlementBitSet& RequiredEntitlements) const
+{
+	return ActiveEntitlementBits.ContainsAll(RequiredEntitlements);
+}
+
+bool UOUUGameEntitlementsSubsystem::IsEntitledToIndex(int32 EntitlementIndex) const
+{
+	return ActiveEntitlementBits.Contains(EntitlementIndex);
+}
+
+int32 UOUUGameEntitlementsSubsystem::GetEntitlementIndex(const FGameplayTag& Tag) const
+{
+	const int32* IndexPtr = EntitlementIndices.Find(Tag);
+	return IndexPtr ? *IndexPtr : UnknownEntitlementIndex;
+}
+
+FOUUGameEntitlementBitSet UOUUGameEntitlementsSubsystem::MakeEntitlementMask(
+	const FOUUGameEntitlementModules_Ref& Modules) const
+{
+	return MakeEntitlementMask(Modules.Get());
+}
+
+FOUUGameEntitlementBitSet UOUUGameEntitlementsSubsystem::MakeEntitlementMask(
+	const FGameplayTagContainer& ModulesAndCollections) const
+{
+	// Unknown tags add UnknownEntitlementIndex, so the mask is never satisfied just like for IsEntitled(Modules)
+	FOUUGameEntitlementBitSet Result;
+	for (const FGameplayTag& Tag : ModulesAndCollections)
+	{
+		Result.Add(GetEntitlementIndex(Tag));
+	}
+	return Result;
 }
 
 bool UOUUGameEntitlementsSubsystem::HasInitializedActiveEntitlements() const
@@ -93,12 +131,28 @@ void UOUUGameEntitlementsSubsystem::SetOverrideVersion(const FOUUGameEntitlement
 	}
 }
 
+#if WITH_DEV_AUTOMATION_TESTS
+FOUUGameEntitlementSnapshotRef UOUUGameEntitlementsSubsystem::ActivateVersion_ForTesting(
+	const FOUUGameEntitlementVersion& Version,
+	const UOUUGameEntitlementSettings& Settings)
+{
+	bHasInitializedActiveEntitlements = false;
+	ActiveVersion = Version;
+	RebuildActiveEntitlements(Settings);
+	return LatestSnapshot;
+}
+#endif
+
 void UOUUGameEntitlementsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	checkf(UGameplayTagsManager::GetIfAllocated(), TEXT("Entitlements subsystem needs valid gameplay tags manager"));
 
+	// Continue the serial numbers of previously published snapshots, e.g. of an earlier engine instance
+	bPublishesSnapshots = true;
+	LatestSnapshot = FOUUGameEntitlementSnapshot::GetCurrent();
+
 	UGameplayTagsManager::Get().CallOrRegister_OnDoneAddingNativeTagsDelegate(
 		FSimpleMulticastDelegate::FDelegate::CreateUObject(
 			this,
@@ -113,14 +167,18 @@ void UOUUGameEntitlementsSubsystem::Initialize(FSubsystemCollectionBase& Collect
 bool UOUUGameEntitlementsSubsystem::IsEntitledToCollection(const FOUUGameEntitlementCollection& Collection) const
 {
 	// Invalid = empty tag should be treated as asking for "no requirements"
-	return Collection.IsValid() == false
-		|| ActiveEntitlements.HasTag(FOUUGameEntitlementModuleAndCollection::ConvertChecked(Collection));
+	return Collection.IsValid() == false || IsEntitledToIndex(GetEntitlementIndex(Collection));
 }
 
 bool UOUUGameEntitlementsSubsystem::IsEntitledToCollection(const FOUUGameEntitlementCollections_Ref& Collections) const
 {
 	// Expected to return true if Modules is empty
-	return ActiveEntitlements.HasAll(FOUUGameEntitlementModuleAndCollections_Value::CreateChecked(Collections.Get()));
+	for (const FGameplayTag& Collection : Collections.Get())
+	{
+		if (IsEntitledToIndex(GetEntitlementIndex(Collection)) == false)
+			return false;
+	}
+	return true;
 }
 
 #if WITH_EDITOR
@@ -157,31 +215,102 @@ void UOUUGameEntitlementsSubsystem::RefreshActiveVersionAndEntitlements()
 	auto& DefaultVersion = Settings.DefaultVersion;
 #endif
 	ActiveVersion = OverrideVersion.IsValid() ? OverrideVersion : DefaultVersion;
-	ActiveEntitlements.Reset();
+
+	RebuildActiveEntitlements(Settings);
+}
+
+void UOUUGameEntitlementsSubsystem::RebuildActiveEntitlements(const UOUUGameEntitlementSettings& Settings)
+{
+	RebuildEntitlementIndices();
+	ActiveEntitlementBits.Reset(ParentEntitlementIndices.Num());
+
+	TArray<FGameplayTag> PendingEntitlements;
 	if (auto* EntitlementsPtr = Settings.EntitlementsPerVersion.Find(ActiveVersion))
 	{
-		ActiveEntitlements = FOUUGameEntitlementModuleAndCollections_Value::CreateChecked(*EntitlementsPtr);
+		PendingEntitlements = EntitlementsPtr->GetGameplayTagArray();
 	}
 
-	// recursively add entitlements from module collections
-	int32 LastEntitlementCount = -1;
-	while (ActiveEntitlements.Num() != LastEntitlementCount)
+	// Single pass over the collection graph: Every module and collection is expanded at most once, so collections
+	// that reference each other don't need a fixpoint iteration.
+	FOUUGameEntitlementBitSet ExpandedEntitlements;
+	FGameplayTagContainer ExpandedTags;
+	while (PendingEntitlements.Num() > 0)
 	{
-		for (const auto Entitlement : ActiveEntitlements)
+		const FGameplayTag Entitlement = PendingEntitlements.Pop(EAllowShrinking::No);
+		const int32 EntitlementIndex = GetEntitlementIndex(Entitlement);
+		if (EntitlementIndex == UnknownEntitlementIndex || ExpandedEntitlements.Contains(EntitlementIndex))
+			continue;
+
+		ExpandedEntitlements.Add(EntitlementIndex);
+		ExpandedTags.AddTag(Entitlement);
+		AddEntitlementWithParents(ActiveEntitlementBits, EntitlementIndex);
+
+		auto EntitlementAsCollection = FOUUGameEntitlementCollection::TryConvert(Entitlement);
+		if (EntitlementAsCollection.IsValid())
 		{
-			auto EntitlementAsCollection = FOUUGameEntitlementCollection::TryConvert(Entitlement);
-			if (EntitlementAsCollection.IsValid())
+			if (auto* EntitlementsPtr = Settings.ModuleCollections.Find(EntitlementAsCollection))
 			{
-				if (auto* EntitlementsPtr = Settings.ModuleCollections.Find(EntitlementAsCollection))
-				{
-					ActiveEntitlements.AppendTags(
-						FOUUGameEntitlementModuleAndCollections_Value::CreateChecked(*EntitlementsPtr));
-				}
+				PendingEntitlements.Append(EntitlementsPtr->GetGameplayTagArray());
 			}
 		}
-		LastEntitlementCount = ActiveEntitlements.Num();
 	}
+	ActiveEntitlements = FOUUGameEntitlementModuleAndCollections_Value::CreateChecked(ExpandedTags);
 
 	bHasInitializedActiveEntitlements = true;
+	PublishSnapshot(Settings);
 	OnActiveEntitlementsChanged.Broadcast();
 }
+
+void UOUUGameEntitlementsSubsystem::RebuildEntitlementIndices()
+{
+	EntitlementIndices.Reset();
+	ParentEntitlementIndices.Reset();
+	ParentEntitlementIndices.Add(INDEX_NONE);
+
+	const auto& TagsManager = UGameplayTagsManager::Get();
+	for (const FGameplayTag& RootTag :
+		 {FOUUGameEntitlementTags::Module::Get(), FOUUGameEntitlementTags::Collection::Get()})
+	{
+		EntitlementIndices.Add(RootTag, ParentEntitlementIndices.Add(INDEX_NONE));
+		for (const FGameplayTag& Tag : TagsManager.RequestGameplayTagChildren(RootTag))
+		{
+			EntitlementIndices.Add(Tag, ParentEntitlementIndices.Add(INDEX_NONE));
+		}
+	}
+
+	for (const auto& Entry : EntitlementIndices)
+	{
+		if (const int32* ParentIndexPtr = EntitlementIndices.Find(Entry.Key.RequestDirectParent()))
+		{
+			ParentEntitlementIndices[Entry.Value] = *ParentIndexPtr;
+		}
+	}
+}
+
+void UOUUGameEntitlementsSubsystem::PublishSnapshot(const UOUUGameEntitlementSettings& Settings)
+{
+	LatestSnapshot = FOUUGameEntitlementSnapshot::Create(
+		LatestSnapshot->GetSerialNumber() + 1,
+		ActiveVersion,
+		ActiveEntitlements.Get(),
+		ActiveEntitlementBits,
+		EntitlementIndices,
+		Settings.ContentRules);
+
+	if (bPublishesSnapshots)
+	{
+		FOUUGameEntitlementSnapshot::Publish(LatestSnapshot);
+	}
+}
+
+void UOUUGameEntitlementsSubsystem::AddEntitlementWithParents(
+	FOUUGameEntitlementBitSet& BitSet,
+	int32 EntitlementIndex) const
+{
+	// Parents of entitlements that are already in the set must be in the set as well, so we can stop early
+	while (EntitlementIndex != INDEX_NONE && BitSet.Contains(EntitlementIndex) == false)
+	{
+		BitSet.Add(EntitlementIndex);
+		EntitlementIndex = ParentEntitlementIndices[EntitlementIndex];
+	}
+}
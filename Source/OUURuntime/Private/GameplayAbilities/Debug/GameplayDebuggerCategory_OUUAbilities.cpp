@@ -633,10 +633,12 @@ void FGameplayDebuggerCategory_OUUAbilities::DrawDebugBody()
 				0);
 			*/
 			// since the tag containers in the even buffer cause crashes, here's a version without them:
-			DebugLine(
-				FString::Printf(TEXT("%s -> %s"), *LexToString(Entry.Instigator), *LexToString(Entry.Target)),
-				10.f,
-				0);
+			// (built in inline storage, because this runs for every history entry in every frame)
+			TStringBuilder<256> InstigatorToTarget;
+			LexAppend(InstigatorToTarget, Entry.Instigator);
+			InstigatorToTarget << TEXT(" -> ");
+			LexAppend(InstigatorToTarget, Entry.Target);
+			DebugLine(FString(InstigatorToTarget.ToView()), 10.f, 0);
 		}
 	}
 }
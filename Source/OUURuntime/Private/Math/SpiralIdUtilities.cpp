@@ -2,6 +2,49 @@
 
 #include "Math/SpiralIdUtilities.h"
 
+namespace OUU::Runtime::Private::SpiralId
+{
+	/** Floor of the square root of a non-negative integer. Exact for the whole int32 range. */
+	FORCEINLINE int32 IntegerSqrt(const int32 Value)
+	{
+		int32 Root = static_cast<int32>(FMath::Sqrt(static_cast<double>(Value)));
+		// Correct possible rounding errors of the floating point square root by one in either direction
+		Root -= (static_cast<int64>(Root) * Root > Value) ? 1 : 0;
+		Root += (static_cast<int64>(Root + 1) * (Root + 1) <= Value) ? 1 : 0;
+		return Root;
+	}
+
+	/**
+	 * Closed form inverse of ConvertCoordinatesToSpiralId().
+	 *
+	 * Ring K (cells with max(|X|,|Y|) == K) contains the IDs [(2K-1)^2, (2K+1)^2) and is centered around the ID 4K^2,
+	 * which is the top left corner (-K, K). IDs above the center run along the top edge and then down the right edge,
+	 * IDs below the center run down the left edge and then along the bottom edge. The second half is the first half
+	 * mirrored through the origin with swapped edges, which allows writing the decode without branches.
+	 */
+	FORCEINLINE FIntPoint DecodeSpiralId(const int32 InSpiralId)
+	{
+		// Negative IDs are not valid. Treat them like the origin.
+		const int32 SpiralId = FMath::Max(InSpiralId, 0);
+
+		const int32 Ring = (IntegerSqrt(SpiralId) + 1) >> 1;
+		const int32 OffsetFromRingCenter = SpiralId - 4 * Ring * Ring;
+
+		const bool bUpperHalf = OffsetFromRingCenter >= 0;
+		const int32 Sign = bUpperHalf ? 1 : -1;
+		const int32 AbsOffset = bUpperHalf ? OffsetFromRingCenter : -OffsetFromRingCenter;
+
+		// Is the cell on the first edge of the half (top for upper half, left for lower half)?
+		const bool bFirstEdge = AbsOffset <= 2 * Ring;
+		const int32 PositionOnEdge = bFirstEdge ? AbsOffset - Ring : 3 * Ring - AbsOffset;
+
+		const bool bEdgeAlongX = bFirstEdge == bUpperHalf;
+		return FIntPoint(
+			Sign * (bEdgeAlongX ? PositionOnEdge : Ring),
+			Sign * (bEdgeAlongX ? Ring : PositionOnEdge));
+	}
+} // namespace OUU::Runtime::Private::SpiralId
+
 int32 USpiralIdUtilities::ConvertCoordinatesToSpiralId(const int32 X, const int32 Y)
 {
 	// If you find this calculation confusing, don't worry I had a hard time understanding it
@@ -64,33 +107,35 @@ int32 USpiralIdUtilities::ConvertWorldLocationToSpiralId(
 
 FIntPoint USpiralIdUtilities::ConvertSpiralIdToCoordinates(const int32 SpiralId)
 {
-	FIntPoint PerStepDelta(0, 1);
-	int32 SegmentLength = 1;
+	return OUU::Runtime::Private::SpiralId::DecodeSpiralId(SpiralId);
+}
 
-	FIntPoint Coordinates(0, 0);
-	int32 SegmentProgress = 0;
-	for (int i = 0; i < SpiralId; ++i)
+void USpiralIdUtilities::ConvertSpiralIdsToCoordinates(
+	TConstArrayView<int32> SpiralIds,
+	TArrayView<FIntPoint> OutCoordinates)
+{
+	checkf(
+		SpiralIds.Num() == OutCoordinates.Num(),
+		TEXT("Output view must have the same size as the input view (%i != %i)"),
+		SpiralIds.Num(),
+		OutCoordinates.Num());
+
+	// No branches and no dependencies between iterations, so the compiler can vectorize this loop.
+	const int32* RESTRICT Ids = SpiralIds.GetData();
+	FIntPoint* RESTRICT Coordinates = OutCoordinates.GetData();
+	const int32 Num = SpiralIds.Num();
+	for (int32 Idx = 0; Idx < Num; ++Idx)
 	{
-		Coordinates += PerStepDelta;
-		++SegmentProgress;
-
-		if (SegmentProgress == SegmentLength)
-		{
-			SegmentProgress = 0;
-
-			// Rotate PerStepDelta by 90 deg
-			const int32 Temp = PerStepDelta.X;
-			PerStepDelta.X = -PerStepDelta.Y;
-			PerStepDelta.Y = Temp;
-
-			if (PerStepDelta.X == 0)
-			{
-				++SegmentLength;
-			}
-		}
+		Coordinates[Idx] = OUU::Runtime::Private::SpiralId::DecodeSpiralId(Ids[Idx]);
 	}
-	Coordinates.Y *= -1;
-	return Coordinates;
+}
+
+TArray<FIntPoint> USpiralIdUtilities::ConvertSpiralIdArrayToCoordinates(const TArray<int32>& SpiralIds)
+{
+	TArray<FIntPoint> Result;
+	Result.SetNumUninitialized(SpiralIds.Num());
+	ConvertSpiralIdsToCoordinates(SpiralIds, Result);
+	return Result;
 }
 
 FVector2D USpiralIdUtilities::ConvertSpiralIdToCenterLocation(
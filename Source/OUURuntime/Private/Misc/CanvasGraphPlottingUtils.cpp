@@ -131,14 +131,18 @@ void OUU::Runtime::CanvasGraphPlottingUtils::DrawCanvasGraph(
 		}
 	};
 
+	TArray<float> StatValues;
 	for (auto& Stat : StatsToDraw)
 	{
+		Stat.ValueAggregator.CopyValues(StatValues);
+		const int32 NumberOfStatSamples = FMath::Min(NumberOfSamples, StatValues.Num());
+
 		// For each sample in our data set
-		for (int32 CurFrameIndex = 0; CurFrameIndex < NumberOfSamples; ++CurFrameIndex)
+		for (int32 CurFrameIndex = 0; CurFrameIndex < NumberOfStatSamples; ++CurFrameIndex)
 		{
 			const int32 PrevFrameIndex = FMath::Max(0, CurFrameIndex - 1);
-			const float PrevValue = Stat.ValueAggregator[PrevFrameIndex];
-			const float CurValue = Stat.ValueAggregator[CurFrameIndex];
+			const float PrevValue = StatValues[PrevFrameIndex];
+			const float CurValue = StatValues[CurFrameIndex];
 
 			DrawLineAndLabel(
 				PrevValue,
@@ -147,7 +151,7 @@ void OUU::Runtime::CanvasGraphPlottingUtils::DrawCanvasGraph(
 				StaticCast<float>(CurFrameIndex) / NumberOfSamples,
 				Stat.Color,
 				Stat.Title,
-				CurFrameIndex == NumberOfSamples - 1);
+				CurFrameIndex == NumberOfStatSamples - 1);
 		}
 	}
 
@@ -2,164 +2,510 @@
 
 #include "Misc/RegexUtils.h"
 
+#include "HAL/IConsoleManager.h"
 #include "Internationalization/Regex.h"
+#include "Misc/ScopeRWLock.h"
+#include "Templates/ArrayUtils.h"
+
+#include <atomic>
 
 namespace OUU::Runtime::Private::Regex
 {
-	struct FScopedRegex
+	TAutoConsoleVariable<int32> CVar_PatternCacheSize{
+		TEXT("ouu.Regex.PatternCacheSize"),
+		256,
+		TEXT("Maximum number of compiled patterns kept in the RegexUtils pattern cache. 0 disables the cache.")};
+
+	struct FPatternCacheKey
+	{
+		FString PatternString;
+		ERegexPatternFlags Flags = ERegexPatternFlags::None;
+	};
+
+	// Used for lookups, so cache hits do not have to copy the pattern string
+	struct FPatternCacheKeyView
+	{
+		FStringView PatternString;
+		ERegexPatternFlags Flags = ERegexPatternFlags::None;
+	};
+
+	struct FPatternCacheEntry
 	{
+		explicit FPatternCacheEntry(const FRegexPattern& InPattern, uint64 InLastUsed) :
+			Pattern(InPattern), LastUsed(InLastUsed)
+		{
+		}
+
+		FPatternCacheEntry(const FPatternCacheEntry& Other) :
+			Pattern(Other.Pattern), LastUsed(Other.LastUsed.load(std::memory_order_relaxed))
+		{
+		}
+
 		FRegexPattern Pattern;
-		FRegexMatcher Matcher;
+		// Updated under the read lock on every hit, so this has to be atomic
+		std::atomic<uint64> LastUsed;
+	};
+
+	// Regex patterns are case sensitive, so the default (case insensitive) FString key funcs cannot be used
+	struct FPatternCacheKeyFuncs : TDefaultMapKeyFuncs<FPatternCacheKey, FPatternCacheEntry, false>
+	{
+		static uint32 GetKeyHash(const FPatternCacheKeyView& Key)
+		{
+			const uint32 StringHash =
+				FCrc::MemCrc32(Key.PatternString.GetData(), Key.PatternString.Len() * sizeof(TCHAR));
+			return HashCombineFast(StringHash, static_cast<uint32>(Key.Flags));
+		}
+
+		static uint32 GetKeyHash(const FPatternCacheKey& Key)
+		{
+			return GetKeyHash(FPatternCacheKeyView{Key.PatternString, Key.Flags});
+		}
 
-		FScopedRegex(const FString& PatternString, const FString& InputString) :
-			Pattern(PatternString), Matcher(Pattern, InputString)
+		static bool Matches(const FPatternCacheKey& A, const FPatternCacheKeyView& B)
 		{
+			return A.Flags == B.Flags
+				&& FStringView(A.PatternString).Equals(B.PatternString, ESearchCase::CaseSensitive);
 		}
 
-		FRegexMatcher* operator->() { return &Matcher; }
+		static bool Matches(const FPatternCacheKey& A, const FPatternCacheKey& B)
+		{
+			return Matches(A, FPatternCacheKeyView{B.PatternString, B.Flags});
+		}
 	};
 
+	struct FPatternCache
+	{
+		FRWLock Lock;
+		TMap<FPatternCacheKey, FPatternCacheEntry, FDefaultSetAllocator, FPatternCacheKeyFuncs> Entries;
+		std::atomic<uint64> UseCounter{0};
+		std::atomic<uint64> NumHits{0};
+		std::atomic<uint64> NumMisses{0};
+	};
+
+	FPatternCache& GetPatternCache()
+	{
+		static FPatternCache Cache;
+		return Cache;
+	}
+
 	bool IsExactMatchRange(const FString& TestString, int32 MatchBeginning, int32 MatchEnding)
 	{
 		const int32 StringLength = TestString.Len();
 		return (StringLength > 0) && (MatchBeginning == 0) && (MatchEnding == StringLength);
 	}
 
-	bool IsValidMatchRange(const FString& TestString, int32 MatchBeginning, int32 MatchEnding)
+	FRegexMatch MakeRegexMatch(const FString& TestString, const FRegexSpan& Span)
 	{
-		const int32 StringLength = TestString.Len();
-		return (MatchEnding > MatchBeginning) && StringLength > 0
-			&& (MatchBeginning >= 0 && MatchBeginning <= StringLength)
-			&& (MatchEnding >= 0 && MatchEnding <= StringLength);
+		return FRegexMatch{
+			Span.Beginning,
+			Span.Ending,
+			Span.IsValid() ? TestString.Mid(Span.Beginning, Span.Len()) : FString()};
 	}
 
-	template <typename ResultType, typename TruePredicateType, typename FalsePredicateType>
-	ResultType MatchRegex(
-		const FString& PatternString,
-		const FString& TestString,
-		int32 BeginIndex,
-		TruePredicateType TruePredicate,
-		FalsePredicateType FalsePredicate)
+	FRegexGroups MakeRegexGroups(FRegexMatchEnumerator& Matches, int32 GroupCount)
 	{
-		FScopedRegex Regex{PatternString, TestString};
-		const int32 StringLength = TestString.Len();
-		for (int32 i = BeginIndex; i < StringLength; i++)
+		FRegexGroups Result;
+		Result.CaptureGroups.Reserve(GroupCount + 1);
+		for (int32 i = 0; i < (GroupCount + 1); i++)
 		{
-			Regex->SetLimits(i, StringLength);
-			if (!Regex->FindNext())
-				continue;
+			Result.CaptureGroups.Add(MakeRegexMatch(Matches.GetInput(), Matches.GetGroupSpan(i)));
+		}
+		return Result;
+	}
 
-			int32 MatchBeginning = Regex->GetMatchBeginning();
-			int32 MatchEnding = Regex->GetMatchEnding();
-			if (IsValidMatchRange(TestString, MatchBeginning, MatchEnding))
+	bool MatchesRegex(const FRegexPattern& RegexPattern, const FString& TestString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		return Matches.FindNext();
+	}
+
+	int32 CountRegexMatches(const FRegexPattern& RegexPattern, const FString& TestString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		int32 Count = 0;
+		while (Matches.FindNext())
+		{
+			Count++;
+		}
+		return Count;
+	}
+
+	bool MatchesRegexExact(const FRegexPattern& RegexPattern, const FString& TestString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		if (!Matches.FindNext())
+			return false;
+
+		const FRegexSpan Span = Matches.GetMatchSpan();
+		return IsExactMatchRange(TestString, Span.Beginning, Span.Ending);
+	}
+
+	TArray<FRegexMatch> GetRegexMatches(const FRegexPattern& RegexPattern, const FString& TestString)
+	{
+		TArray<FRegexMatch> Result;
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		while (Matches.FindNext())
+		{
+			Result.Add(MakeRegexMatch(TestString, Matches.GetMatchSpan()));
+		}
+		return Result;
+	}
+
+	FRegexGroups GetRegexMatchAndGroupsExact(
+		const FRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		if (!Matches.FindNext())
+			return FRegexGroups::Invalid();
+
+		const FRegexSpan Span = Matches.GetMatchSpan();
+		if (!IsExactMatchRange(TestString, Span.Beginning, Span.Ending))
+			return FRegexGroups::Invalid();
+
+		return MakeRegexGroups(Matches, GroupCount);
+	}
+
+	TArray<FRegexGroups> GetRegexMatchesAndGroups(
+		const FRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString)
+	{
+		TArray<FRegexGroups> Result;
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		while (Matches.FindNext())
+		{
+			Result.Add(MakeRegexGroups(Matches, GroupCount));
+		}
+		return Result;
+	}
+
+	FRegexGroups GetFirstRegexMatchAndGroups(
+		const FRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, TestString);
+		return Matches.FindNext() ? MakeRegexGroups(Matches, GroupCount) : FRegexGroups::Invalid();
+	}
+
+	FString ReplaceFirstRegexMatch(
+		const FRegexPattern& RegexPattern,
+		const FString& InputString,
+		const FString& ReplaceString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, InputString);
+		if (!Matches.FindNext())
+			return InputString;
+
+		const FRegexSpan Span = Matches.GetMatchSpan();
+		FString Result;
+		Result.Reserve(InputString.Len() - Span.Len() + ReplaceString.Len());
+		Result.AppendChars(*InputString, Span.Beginning);
+		Result.Append(ReplaceString);
+		Result.AppendChars(*InputString + Span.Ending, InputString.Len() - Span.Ending);
+		return Result;
+	}
+
+	FString ReplaceAllRegexMatches(
+		const FRegexPattern& RegexPattern,
+		const FString& InputString,
+		const FString& ReplaceString)
+	{
+		FRegexMatchEnumerator Matches(RegexPattern, InputString);
+		int32 LastMatchEnding = 0;
+		FString Result;
+		Result.Reserve(InputString.Len());
+		while (Matches.FindNext())
+		{
+			// All the chars from input string between last match end and new match
+			const FRegexSpan Span = Matches.GetMatchSpan();
+			Result.AppendChars(*InputString + LastMatchEnding, Span.Beginning - LastMatchEnding);
+			Result.Append(ReplaceString);
+			LastMatchEnding = Span.Ending;
+		}
+		// Rest of the string until end
+		Result.AppendChars(*InputString + LastMatchEnding, InputString.Len() - LastMatchEnding);
+		return Result;
+	}
+
+	// Matching a single string takes microseconds instead of the few nanoseconds the ArrayUtils defaults are tuned for,
+	// so batches go wide a lot earlier.
+	constexpr int32 BatchSequentialThreshold = 256;
+	constexpr int32 BatchMinChunkSize = 64;
+
+	FORCEINLINE const FString& GetBatchElementString(const FString& String, FString& ScratchString)
+	{
+		return String;
+	}
+
+	FORCEINLINE const FString& GetBatchElementString(const FName& Name, FString& ScratchString)
+	{
+		Name.ToString(ScratchString);
+		return ScratchString;
+	}
+
+	/** Evaluate the pattern for all elements. Returns one flag per element and writes the number of matches. */
+	template <typename ElementType>
+	TArray<bool> MatchBatch(
+		const FRegexPattern& Pattern,
+		TArrayView<const ElementType> Elements,
+		ERegexBatchMatchMode Mode,
+		int32& OutNumMatches)
+	{
+		TArray<bool> Flags;
+		Flags.SetNumUninitialized(Elements.Num());
+		std::atomic<int32> NumMatches{0};
+
+		const ArrayUtils::FParallelChunking Chunking(Elements.Num(), BatchSequentialThreshold, BatchMinChunkSize);
+		Chunking.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+			// Reused for all names of the chunk
+			FString ScratchString;
+			int32 NumChunkMatches = 0;
+			for (int32 i = StartIdx; i < EndIdx; i++)
 			{
-				return TruePredicate(Regex, MatchBeginning, MatchEnding, MatchEnding);
+				const FString& String = GetBatchElementString(Elements[i], ScratchString);
+				const bool bMatches = Mode == ERegexBatchMatchMode::Exact ? MatchesRegexExact(Pattern, String)
+																		  : MatchesRegex(Pattern, String);
+				Flags[i] = bMatches;
+				NumChunkMatches += bMatches ? 1 : 0;
+			}
+			NumMatches.fetch_add(NumChunkMatches, std::memory_order_relaxed);
+		});
+
+		OutNumMatches = NumMatches.load(std::memory_order_relaxed);
+		return Flags;
+	}
+
+	template <typename ElementType>
+	TBitArray<> MatchesRegexBatch(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const ElementType> Elements,
+		ERegexBatchMatchMode Mode)
+	{
+		int32 NumMatches = 0;
+		const TArray<bool> Flags = MatchBatch(Pattern.GetPattern(), Elements, Mode, NumMatches);
+
+		TBitArray<> Result(false, Flags.Num());
+		for (int32 i = 0; i < Flags.Num(); i++)
+		{
+			if (Flags[i])
+			{
+				Result[i] = true;
 			}
 		}
-		return FalsePredicate();
+		return Result;
 	}
 
-	bool MatchesRegex_Recursive(const FString& RegexPattern, const FString& TestString, int32 BeginIndex)
+	template <typename ElementType>
+	TArray<int32> FindRegexMatchIndices(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const ElementType> Elements,
+		ERegexBatchMatchMode Mode)
 	{
-		return MatchRegex<bool>(
-			RegexPattern,
-			TestString,
-			BeginIndex,
-			[&](FScopedRegex& Regex, int32 MatchBeginning, int32, int32) { return true; },
-			[]() { return false; });
+		int32 NumMatches = 0;
+		const TArray<bool> Flags = MatchBatch(Pattern.GetPattern(), Elements, Mode, NumMatches);
+
+		TArray<int32> Result;
+		Result.Reserve(NumMatches);
+		for (int32 i = 0; i < Flags.Num(); i++)
+		{
+			if (Flags[i])
+			{
+				Result.Add(i);
+			}
+		}
+		return Result;
 	}
+} // namespace OUU::Runtime::Private::Regex
+
+FCompiledRegexPattern::FCompiledRegexPattern(const FString& InPatternString, ERegexPatternFlags InFlags) :
+	PatternString(InPatternString), Flags(InFlags), Pattern(InPatternString, InFlags)
+{
+}
 
-	int32 CountRegexMatches_Recursive(const FString& RegexPattern, const FString& TestString, int32 BeginIndex)
+namespace OUU::Runtime
+{
+	FRegexMatchEnumerator::FRegexMatchEnumerator(const FRegexPattern& Pattern, const FString& InInput) :
+		Input(InInput), Matcher(Pattern, InInput)
 	{
-		return MatchRegex<int32>(
-			RegexPattern,
-			TestString,
-			BeginIndex,
-			[&RegexPattern,
-			 &TestString](FScopedRegex& Regex, int32 MatchBeginning, int32 MatchEnding, int32 BeginIndex) {
-				return CountRegexMatches_Recursive(RegexPattern, TestString, BeginIndex) + 1;
-			},
-			[]() { return 0; });
 	}
 
-	TArray<FRegexMatch> GetRegexMatches_Recursive(
-		const FString& RegexPattern,
-		const FString& TestString,
-		int32 BeginIndex)
+	FRegexMatchEnumerator::FRegexMatchEnumerator(const FCompiledRegexPattern& Pattern, const FString& InInput) :
+		FRegexMatchEnumerator(Pattern.GetPattern(), InInput)
 	{
-		return MatchRegex<TArray<FRegexMatch>>(
-			RegexPattern,
-			TestString,
-			BeginIndex,
-			[&RegexPattern,
-			 &TestString](FScopedRegex& Regex, int32 MatchBeginning, int32 MatchEnding, int32 BeginIndex) {
-				TArray<FRegexMatch> ResultList;
-				ResultList.Add(FRegexMatch{
-					MatchBeginning,
-					MatchEnding,
-					TestString.Mid(MatchBeginning, MatchEnding - MatchBeginning)});
-				ResultList.Append(GetRegexMatches_Recursive(RegexPattern, TestString, BeginIndex));
-				return ResultList;
-			},
-			[]() { return TArray<FRegexMatch>{}; });
 	}
 
-	TArray<FRegexGroups> GetRegexMatchesAndGroups_Recursive(
-		const FString& RegexPattern,
-		int32 GroupCount,
-		const FString& TestString,
-		int32 BeginIndex)
-	{
-		return MatchRegex<TArray<FRegexGroups>>(
-			RegexPattern,
-			TestString,
-			BeginIndex,
-			[&RegexPattern,
-			 &TestString,
-			 &GroupCount](FScopedRegex& Regex, int32 MatchBeginning, int32 MatchEnding, int32 BeginIndex) {
-				TArray<FRegexGroups> ResultList;
-				FRegexGroups Result;
-				for (int32 i = 0; i < GroupCount; i++)
+	bool FRegexMatchEnumerator::FindNext()
+	{
+		// The matcher continues after the end of the previous match and steps over empty matches by itself,
+		// so only non-empty matches have to be filtered here.
+		while (Matcher.FindNext())
+		{
+			const int32 MatchBeginning = Matcher.GetMatchBeginning();
+			const int32 MatchEnding = Matcher.GetMatchEnding();
+			if (MatchEnding > MatchBeginning)
+			{
+				CurrentMatch = FRegexSpan{MatchBeginning, MatchEnding};
+				return true;
+			}
+		}
+		CurrentMatch = FRegexSpan();
+		return false;
+	}
+
+	FRegexSpan FRegexMatchEnumerator::GetGroupSpan(int32 GroupIndex)
+	{
+		if (GroupIndex == 0)
+			return CurrentMatch;
+
+		return FRegexSpan{Matcher.GetCaptureGroupBeginning(GroupIndex), Matcher.GetCaptureGroupEnding(GroupIndex)};
+	}
+
+	FRegexPattern FRegexPatternCache::FindOrCompile(const FString& PatternString, ERegexPatternFlags Flags)
+	{
+		using namespace Private::Regex;
+		FPatternCache& Cache = GetPatternCache();
+
+		const int32 MaxNumEntries = CVar_PatternCacheSize.GetValueOnAnyThread();
+		if (MaxNumEntries <= 0)
+		{
+			Cache.NumMisses.fetch_add(1, std::memory_order_relaxed);
+			return FRegexPattern(PatternString, Flags);
+		}
+
+		const FPatternCacheKeyView KeyView{PatternString, Flags};
+		const uint32 KeyHash = FPatternCacheKeyFuncs::GetKeyHash(KeyView);
+		{
+			FReadScopeLock ReadLock(Cache.Lock);
+			if (FPatternCacheEntry* Entry = Cache.Entries.FindByHash(KeyHash, KeyView))
+			{
+				Entry->LastUsed.store(
+					Cache.UseCounter.fetch_add(1, std::memory_order_relaxed),
+					std::memory_order_relaxed);
+				Cache.NumHits.fetch_add(1, std::memory_order_relaxed);
+				return Entry->Pattern;
+			}
+		}
+
+		// Compile outside of the lock. If another thread compiles the same pattern concurrently, the last one wins.
+		Cache.NumMisses.fetch_add(1, std::memory_order_relaxed);
+		FRegexPattern Pattern(PatternString, Flags);
+
+		FWriteScopeLock WriteLock(Cache.Lock);
+		Cache.Entries.RemoveByHash(KeyHash, KeyView);
+		while (Cache.Entries.Num() >= MaxNumEntries)
+		{
+			// Evict the least recently used entry. Linear, but only done on misses of a full cache.
+			const FPatternCacheKey* OldestKey = nullptr;
+			uint64 OldestLastUsed = MAX_uint64;
+			for (const auto& Entry : Cache.Entries)
+			{
+				const uint64 LastUsed = Entry.Value.LastUsed.load(std::memory_order_relaxed);
+				if (LastUsed < OldestLastUsed)
 				{
-					Result.CaptureGroups.Add(FRegexMatch{
-						Regex->GetCaptureGroupBeginning(i),
-						Regex->GetCaptureGroupEnding(i),
-						Regex->GetCaptureGroup(i)});
+					OldestLastUsed = LastUsed;
+					OldestKey = &Entry.Key;
 				}
-				ResultList.Add(Result);
-				ResultList.Append(GetRegexMatchesAndGroups_Recursive(RegexPattern, GroupCount, TestString, BeginIndex));
-				return ResultList;
-			},
-			[]() { return TArray<FRegexGroups>{}; });
+			}
+			Cache.Entries.Remove(*OldestKey);
+		}
+		Cache.Entries.Emplace(
+			FPatternCacheKey{PatternString, Flags},
+			FPatternCacheEntry(Pattern, Cache.UseCounter.fetch_add(1, std::memory_order_relaxed)));
+		return Pattern;
 	}
 
-} // namespace OUU::Runtime::Private::Regex
+	FRegexPatternCacheStats FRegexPatternCache::GetStats()
+	{
+		Private::Regex::FPatternCache& Cache = Private::Regex::GetPatternCache();
+
+		FRegexPatternCacheStats Stats;
+		Stats.NumHits = Cache.NumHits.load(std::memory_order_relaxed);
+		Stats.NumMisses = Cache.NumMisses.load(std::memory_order_relaxed);
+		Stats.MaxNumEntries = FMath::Max(Private::Regex::CVar_PatternCacheSize.GetValueOnAnyThread(), 0);
+		{
+			FReadScopeLock ReadLock(Cache.Lock);
+			Stats.NumEntries = Cache.Entries.Num();
+		}
+		return Stats;
+	}
+
+	void FRegexPatternCache::Empty()
+	{
+		Private::Regex::FPatternCache& Cache = Private::Regex::GetPatternCache();
+		FWriteScopeLock WriteLock(Cache.Lock);
+		Cache.Entries.Empty();
+	}
+
+	void FRegexPatternCache::ResetStats()
+	{
+		Private::Regex::FPatternCache& Cache = Private::Regex::GetPatternCache();
+		Cache.NumHits.store(0, std::memory_order_relaxed);
+		Cache.NumMisses.store(0, std::memory_order_relaxed);
+	}
+
+	TBitArray<> MatchesRegexBatch(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FString> Strings,
+		ERegexBatchMatchMode Mode)
+	{
+		return Private::Regex::MatchesRegexBatch(Pattern, Strings, Mode);
+	}
+
+	TBitArray<> MatchesRegexBatch(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FName> Names,
+		ERegexBatchMatchMode Mode)
+	{
+		return Private::Regex::MatchesRegexBatch(Pattern, Names, Mode);
+	}
+
+	TArray<int32> FindRegexMatchIndices(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FString> Strings,
+		ERegexBatchMatchMode Mode)
+	{
+		return Private::Regex::FindRegexMatchIndices(Pattern, Strings, Mode);
+	}
+
+	TArray<int32> FindRegexMatchIndices(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FName> Names,
+		ERegexBatchMatchMode Mode)
+	{
+		return Private::Regex::FindRegexMatchIndices(Pattern, Names, Mode);
+	}
+} // namespace OUU::Runtime
+
 
 bool URegexFunctionLibrary::MatchesRegex(const FString& RegexPattern, const FString& TestString)
 {
-	return OUU::Runtime::Private::Regex::MatchesRegex_Recursive(RegexPattern, TestString, 0);
+	return OUU::Runtime::Private::Regex::MatchesRegex(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		TestString);
 }
 
 int32 URegexFunctionLibrary::CountRegexMatches(const FString& RegexPattern, const FString& TestString)
 {
-	return OUU::Runtime::Private::Regex::CountRegexMatches_Recursive(RegexPattern, TestString, 0);
+	return OUU::Runtime::Private::Regex::CountRegexMatches(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		TestString);
 }
 
 bool URegexFunctionLibrary::MatchesRegexExact(const FString& RegexPattern, const FString& TestString)
 {
-	OUU::Runtime::Private::Regex::FScopedRegex Regex(RegexPattern, TestString);
-	if (!Regex->FindNext())
-		return false;
-
-	return OUU::Runtime::Private::Regex::IsExactMatchRange(
-		TestString,
-		Regex->GetMatchBeginning(),
-		Regex->GetMatchEnding());
+	return OUU::Runtime::Private::Regex::MatchesRegexExact(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		TestString);
 }
 
 TArray<FRegexMatch> URegexFunctionLibrary::GetRegexMatches(const FString& RegexPattern, const FString& TestString)
 {
-	return OUU::Runtime::Private::Regex::GetRegexMatches_Recursive(RegexPattern, TestString, 0);
+	return OUU::Runtime::Private::Regex::GetRegexMatches(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		TestString);
 }
 
 FRegexGroups URegexFunctionLibrary::GetRegexMatchAndGroupsExact(
@@ -167,27 +513,10 @@ FRegexGroups URegexFunctionLibrary::GetRegexMatchAndGroupsExact(
 	int32 GroupCount,
 	const FString& TestString)
 {
-	FRegexGroups Result;
-
-	OUU::Runtime::Private::Regex::FScopedRegex Regex{RegexPattern, TestString};
-	if (!Regex->FindNext())
-		return Result;
-
-	const int32 MatchBeginning = Regex->GetMatchBeginning();
-	const int32 MatchEnding = Regex->GetMatchEnding();
-	if (!OUU::Runtime::Private::Regex::IsExactMatchRange(TestString, MatchBeginning, MatchEnding))
-		return Result;
-
-	TArray<FRegexGroups> ResultList;
-	for (int32 i = 0; i < (GroupCount + 1); i++)
-	{
-		Result.CaptureGroups.Add(FRegexMatch{
-			Regex->GetCaptureGroupBeginning(i),
-			Regex->GetCaptureGroupEnding(i),
-			Regex->GetCaptureGroup(i)});
-	}
-
-	return Result;
+	return OUU::Runtime::Private::Regex::GetRegexMatchAndGroupsExact(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		GroupCount,
+		TestString);
 }
 
 TArray<FRegexGroups> URegexFunctionLibrary::GetRegexMatchesAndGroups(
@@ -195,11 +524,10 @@ TArray<FRegexGroups> URegexFunctionLibrary::GetRegexMatchesAndGroups(
 	int32 GroupCount,
 	const FString& TestString)
 {
-	return OUU::Runtime::Private::Regex::GetRegexMatchesAndGroups_Recursive(
-		RegexPattern,
-		GroupCount + 1,
-		TestString,
-		0);
+	return OUU::Runtime::Private::Regex::GetRegexMatchesAndGroups(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		GroupCount,
+		TestString);
 }
 
 FRegexGroups URegexFunctionLibrary::GetFirstRegexMatchAndGroups(
@@ -207,8 +535,10 @@ FRegexGroups URegexFunctionLibrary::GetFirstRegexMatchAndGroups(
 	int32 GroupCount,
 	const FString& TestString)
 {
-	auto Result = GetRegexMatchesAndGroups(RegexPattern, GroupCount, TestString);
-	return Result.Num() > 0 ? Result[0] : FRegexGroups::Invalid();
+	return OUU::Runtime::Private::Regex::GetFirstRegexMatchAndGroups(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		GroupCount,
+		TestString);
 }
 
 FString URegexFunctionLibrary::ReplaceFirstRegexMatch(
@@ -216,11 +546,10 @@ FString URegexFunctionLibrary::ReplaceFirstRegexMatch(
 	const FString& InputString,
 	const FString& ReplaceString)
 {
-	auto Matches = GetRegexMatches(RegexPattern, InputString);
-	if (Matches.Num() < 1)
-		return InputString;
-	const auto& FirstMatch = Matches[0];
-	return InputString.Mid(0, FirstMatch.MatchBeginning) + ReplaceString + InputString.Mid(FirstMatch.MatchEnding);
+	return OUU::Runtime::Private::Regex::ReplaceFirstRegexMatch(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		InputString,
+		ReplaceString);
 }
 
 FString URegexFunctionLibrary::ReplaceAllRegexMatches(
@@ -228,18 +557,76 @@ FString URegexFunctionLibrary::ReplaceAllRegexMatches(
 	const FString& InputString,
 	const FString& ReplaceString)
 {
-	auto Matches = GetRegexMatches(RegexPattern, InputString);
-	int32 LastMatchEnding = 0;
-	FString Result = "";
-	for (const auto& Match : Matches)
-	{
-		// All the chars from input string between last match end and new match
-		const FString CarryOver = InputString.Mid(LastMatchEnding, Match.MatchBeginning - LastMatchEnding);
+	return OUU::Runtime::Private::Regex::ReplaceAllRegexMatches(
+		OUU::Runtime::FRegexPatternCache::FindOrCompile(RegexPattern),
+		InputString,
+		ReplaceString);
+}
 
-		Result += CarryOver + ReplaceString;
-		LastMatchEnding = Match.MatchEnding;
-	}
-	// Rest of the string until end
-	Result += InputString.Mid(LastMatchEnding);
-	return Result;
+bool URegexFunctionLibrary::MatchesRegex(const FCompiledRegexPattern& RegexPattern, const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::MatchesRegex(RegexPattern.GetPattern(), TestString);
+}
+
+bool URegexFunctionLibrary::MatchesRegexExact(const FCompiledRegexPattern& RegexPattern, const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::MatchesRegexExact(RegexPattern.GetPattern(), TestString);
+}
+
+int32 URegexFunctionLibrary::CountRegexMatches(const FCompiledRegexPattern& RegexPattern, const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::CountRegexMatches(RegexPattern.GetPattern(), TestString);
+}
+
+TArray<FRegexMatch> URegexFunctionLibrary::GetRegexMatches(
+	const FCompiledRegexPattern& RegexPattern,
+	const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::GetRegexMatches(RegexPattern.GetPattern(), TestString);
+}
+
+TArray<FRegexGroups> URegexFunctionLibrary::GetRegexMatchesAndGroups(
+	const FCompiledRegexPattern& RegexPattern,
+	int32 GroupCount,
+	const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::GetRegexMatchesAndGroups(RegexPattern.GetPattern(), GroupCount, TestString);
+}
+
+FRegexGroups URegexFunctionLibrary::GetFirstRegexMatchAndGroups(
+	const FCompiledRegexPattern& RegexPattern,
+	int32 GroupCount,
+	const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::GetFirstRegexMatchAndGroups(
+		RegexPattern.GetPattern(),
+		GroupCount,
+		TestString);
+}
+
+FRegexGroups URegexFunctionLibrary::GetRegexMatchAndGroupsExact(
+	const FCompiledRegexPattern& RegexPattern,
+	int32 GroupCount,
+	const FString& TestString)
+{
+	return OUU::Runtime::Private::Regex::GetRegexMatchAndGroupsExact(
+		RegexPattern.GetPattern(),
+		GroupCount,
+		TestString);
+}
+
+FString URegexFunctionLibrary::ReplaceFirstRegexMatch(
+	const FCompiledRegexPattern& RegexPattern,
+	const FString& InputString,
+	const FString& ReplaceString)
+{
+	return OUU::Runtime::Private::Regex::ReplaceFirstRegexMatch(RegexPattern.GetPattern(), InputString, ReplaceString);
+}
+
+FString URegexFunctionLibrary::ReplaceAllRegexMatches(
+	const FCompiledRegexPattern& RegexPattern,
+	const FString& InputString,
+	const FString& ReplaceString)
+{
+	return OUU::Runtime::Private::Regex::ReplaceAllRegexMatches(RegexPattern.GetPattern(), InputString, ReplaceString);
 }
@@ -4,6 +4,8 @@
 
 #include "Animation/Debug/GameplayDebugger_Animation.h"
 #include "Modules/ModuleManager.h"
+#include "Templates/FrameArena.h"
+#include "Templates/InterfaceUtils.h"
 
 #if WITH_GAMEPLAY_DEBUGGER
 	#include "GameEntitlements/Debug/GameplayDebuggerCategory_GameEntitlements.h"
@@ -26,6 +28,9 @@ class FOUURuntimeModule : public IModuleInterface
 	// - IModuleInterface
 	void StartupModule() override
 	{
+		OUU::Runtime::InterfaceUtils::FInterfaceImplementationCache::RegisterInvalidationDelegates();
+		OUU::Runtime::FFrameArena::RegisterEndFrameDelegate();
+
 #if WITH_GAMEPLAY_DEBUGGER
 		OUU_GameplayDebuggerCategories::RegisterCategories<EGameplayDebuggerCategoryState::Disabled>();
 
@@ -43,6 +48,9 @@ class FOUURuntimeModule : public IModuleInterface
 #if WITH_GAMEPLAY_DEBUGGER
 		OUU_GameplayDebuggerCategories::UnregisterCategories();
 #endif
+
+		OUU::Runtime::FFrameArena::UnregisterEndFrameDelegate();
+		OUU::Runtime::InterfaceUtils::FInterfaceImplementationCache::UnregisterInvalidationDelegates();
 	}
 	// --
 };
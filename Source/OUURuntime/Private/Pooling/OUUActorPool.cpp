@@ -3,6 +3,7 @@
 #include "Pooling/OUUActorPool.h"
 
 #include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
 #include "HAL/IConsoleManager.h"
 #include "LogOpenUnrealUtilities.h"
 #include "ProfilingDebugging/CsvProfiler.h"
@@ -24,6 +25,29 @@ namespace OUU::Runtime::ActorPool
 		TEXT("ouu.ActorPool.MaxDestructTimePerTick"),
 		0.0005,
 		TEXT("The desired budget in seconds allowed to do pooled actor destruction per frame"));
+
+	static auto CVar_SpatialPriorityUpdateInterval = TAutoConsoleVariable<float>(
+		TEXT("ouu.ActorPool.SpatialPriority.UpdateInterval"),
+		0.25,
+		TEXT("Interval in seconds in which the spatial priorities of all pending spawn requests are re-evaluated "
+			 "against the current player views. New requests are always scored on creation."));
+
+	static auto CVar_SpatialPriorityViewConeHalfAngle = TAutoConsoleVariable<float>(
+		TEXT("ouu.ActorPool.SpatialPriority.ViewConeHalfAngle"),
+		50.0,
+		TEXT("Half angle in degrees of the view cone in which spawn requests are considered visually relevant"));
+
+	static auto CVar_SpatialPriorityOutOfViewDistanceScale = TAutoConsoleVariable<float>(
+		TEXT("ouu.ActorPool.SpatialPriority.OutOfViewDistanceScale"),
+		4.0,
+		TEXT("Distances of spawn requests outside of the view cone are scaled by this factor before they are scored, "
+			 "so visible requests are preferred over closer requests behind the viewer"));
+
+	static auto CVar_SpatialPriorityReferenceDistance = TAutoConsoleVariable<float>(
+		TEXT("ouu.ActorPool.SpatialPriority.ReferenceDistance"),
+		5000.0,
+		TEXT("Distance in cm inside of the view cone at which spawn requests get a spatial score of 0.5. "
+			 "Scores are normalized to [0, 1] with this distance."));
 } // namespace OUU::Runtime::ActorPool
 
 UOUUActorPool* UOUUActorPool::Get(const UObject& WorldContext)
@@ -58,6 +82,9 @@ UOUUActorPool::FSpawnRequestHandle UOUUActorPool::RequestActorSpawn(const UOUUAc
 	SpawnRequest.Status = ESpawnRequestStatus::Pending;
 	SpawnRequest.SerialNumber = RequestSerialNumberCounter.fetch_add(1);
 	SpawnRequest.RequestedTime = World->GetTimeSeconds();
+	// Use the views of the last batch update, so we don't have to gather player views for every request.
+	SpawnRequest.SpatialScore =
+		SpawnRequest.PrioritizeByPlayerView ? ComputeSpatialScore(SpawnRequest.Transform.GetLocation()) : 1.f;
 
 	return SpawnRequestHandle;
 }
@@ -192,8 +219,7 @@ void UOUUActorPool::AddReferencedObjects(UObject* InThis, FReferenceCollector& C
 UOUUActorPool::FSpawnRequestHandle UOUUActorPool::GetNextRequestToSpawn() const
 {
 	FSpawnRequestHandle BestSpawnRequestHandle;
-	float BestPriority = MAX_FLT;
-	bool bBestIsPending = false;
+	const FSpawnRequest* BestPendingRequest = nullptr;
 	uint32 BestSerialNumber = MAX_uint32;
 	for (const FSpawnRequestHandle SpawnRequestHandle : SpawnRequestHandleManager.GetHandles())
 	{
@@ -204,16 +230,13 @@ UOUUActorPool::FSpawnRequestHandle UOUUActorPool::GetNextRequestToSpawn() const
 		const FSpawnRequest& SpawnRequest = GetSpawnRequest(SpawnRequestHandle);
 		if (SpawnRequest.Status == ESpawnRequestStatus::Pending)
 		{
-			if (!bBestIsPending || SpawnRequest.Priority < BestPriority
-				|| (SpawnRequest.Priority == BestPriority && SpawnRequest.SerialNumber < BestSerialNumber))
+			if (!BestPendingRequest || SpawnRequest.IsMoreImportantThan(*BestPendingRequest))
 			{
 				BestSpawnRequestHandle = SpawnRequestHandle;
-				BestSerialNumber = SpawnRequest.SerialNumber;
-				BestPriority = SpawnRequest.Priority;
-				bBestIsPending = true;
+				BestPendingRequest = &SpawnRequest;
 			}
 		}
-		else if (!bBestIsPending && SpawnRequest.Status == ESpawnRequestStatus::RetryPending)
+		else if (!BestPendingRequest && SpawnRequest.Status == ESpawnRequestStatus::RetryPending)
 		{
 			// No priority on retries just FIFO
 			if (SpawnRequest.SerialNumber < BestSerialNumber)
@@ -306,10 +329,103 @@ void UOUUActorPool::DeactivateActorFast(AActor* Actor) const
 	Actor->SetActorHiddenInGame(true);
 }
 
+void UOUUActorPool::GatherPlayerViews(TArray<FTransform>& OutViews) const
+{
+	const UWorld* World = GetWorld();
+	check(World);
+
+	// On clients this only contains local players, on servers also the player controllers of remote connections.
+	for (auto It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (!IsValid(PlayerController))
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		OutViews.Emplace(ViewRotation, ViewLocation);
+	}
+}
+
+float UOUUActorPool::ScoreLocationAgainstViews(
+	const FVector& Location,
+	TConstArrayView<FTransform> Views,
+	float ViewConeHalfAngle,
+	float OutOfViewDistanceScale,
+	float ReferenceDistance)
+{
+	const float CosViewConeHalfAngle = FMath::Cos(FMath::DegreesToRadians(ViewConeHalfAngle));
+	const float SafeReferenceDistance = FMath::Max(ReferenceDistance, 1.f);
+
+	float BestScore = 1.f;
+	for (const FTransform& View : Views)
+	{
+		const FVector ViewToLocation = Location - View.GetLocation();
+		const float Distance = ViewToLocation.Size();
+		const bool bIsInViewCone = Distance <= UE_KINDA_SMALL_NUMBER
+			|| FVector::DotProduct(View.GetUnitAxis(EAxis::X), ViewToLocation / Distance) >= CosViewConeHalfAngle;
+		const float ScaledDistance = bIsInViewCone ? Distance : Distance * OutOfViewDistanceScale;
+
+		// Maps [0, inf) to [0, 1) without requiring a maximum distance
+		BestScore = FMath::Min(BestScore, ScaledDistance / (ScaledDistance + SafeReferenceDistance));
+	}
+	return BestScore;
+}
+
+float UOUUActorPool::ComputeSpatialScore(const FVector& Location) const
+{
+	using namespace OUU::Runtime::ActorPool;
+	return ScoreLocationAgainstViews(
+		Location,
+		CachedPlayerViews,
+		CVar_SpatialPriorityViewConeHalfAngle.GetValueOnGameThread(),
+		CVar_SpatialPriorityOutOfViewDistanceScale.GetValueOnGameThread(),
+		CVar_SpatialPriorityReferenceDistance.GetValueOnGameThread());
+}
+
+void UOUUActorPool::UpdateSpatialPriorities()
+{
+	const UWorld* World = GetWorld();
+	check(World);
+
+	const double CurrentTime = World->GetRealTimeSeconds();
+	const double UpdateInterval =
+		OUU::Runtime::ActorPool::CVar_SpatialPriorityUpdateInterval.GetValueOnGameThread();
+	if (CurrentTime - LastSpatialPriorityUpdateTime < UpdateInterval)
+	{
+		return;
+	}
+	LastSpatialPriorityUpdateTime = CurrentTime;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UActorPool::UpdateSpatialPriorities);
+
+	CachedPlayerViews.Reset();
+	GatherPlayerViews(CachedPlayerViews);
+
+	// Scores are only re-evaluated here in one batch and cached on the requests, so the comparisons in
+	// GetNextRequestToSpawn() stay cheap.
+	for (const FSpawnRequestHandle SpawnRequestHandle : SpawnRequestHandleManager.GetHandles())
+	{
+		if (!SpawnRequestHandle.IsValid())
+		{
+			continue;
+		}
+		FSpawnRequest& SpawnRequest = GetMutableSpawnRequest(SpawnRequestHandle);
+		if (SpawnRequest.PrioritizeByPlayerView && SpawnRequest.Status == ESpawnRequestStatus::Pending)
+		{
+			SpawnRequest.SpatialScore = ComputeSpatialScore(SpawnRequest.Transform.GetLocation());
+		}
+	}
+}
+
 void UOUUActorPool::ProcessPendingSpawningRequest(const double MaxTimeSlicePerTick)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UActorPool::ProcessPendingSpawningRequest);
 	SpawnRequestHandleManager.ShrinkHandles();
+	UpdateSpatialPriorities();
 
 	const double TimeSliceEnd = FPlatformTime::Seconds() + MaxTimeSlicePerTick;
 
@@ -3,7 +3,7 @@
 #include "SemVer/BuildMetadata.h"
 
 #include "LogOpenUnrealUtilities.h"
-#include "Misc/RegexUtils.h"
+#include "SemVer/SemVerParser.h"
 
 FSemVerBuildMetadata::FSemVerBuildMetadata(
 	const FString& SourceString,
@@ -29,7 +29,7 @@ bool FSemVerBuildMetadata::TryParseString(const FString& SourceString, ESemVerPa
 
 	if (Strictness == ESemVerParsingStrictness::Strict)
 	{
-		if (OUU::Runtime::RegexUtils::MatchesRegexExact("([0-9a-zA-Z-]+(?:\\.[0-9a-zA-Z-]+)*)", SourceString))
+		if (OUU::Runtime::SemVerParser::IsValidStrictBuildMetadata(SourceString))
 		{
 			Metadata = SourceString;
 			return true;
@@ -85,3 +85,8 @@ bool FSemVerBuildMetadata::operator!=(const FSemVerBuildMetadata& Other) const
 {
 	return !((*this) == Other);
 }
+
+uint32 GetTypeHash(const FSemVerBuildMetadata& Metadata)
+{
+	return GetTypeHash(Metadata.Metadata);
+}
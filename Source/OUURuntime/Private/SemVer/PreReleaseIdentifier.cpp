@@ -3,7 +3,7 @@
 #include "SemVer/PreReleaseIdentifier.h"
 
 #include "Misc/EngineVersionComparison.h"
-#include "Misc/RegexUtils.h"
+#include "SemVer/SemVerParser.h"
 
 FSemVerPreReleaseIdentifier::FSemVerPreReleaseIdentifier(
 	const FString& SourceString,
@@ -56,7 +56,7 @@ bool FSemVerPreReleaseIdentifier::TryParseString(const FString& SourceString, ES
 			}
 		}
 
-		if (!OUU::Runtime::RegexUtils::MatchesRegexExact("^(?:0|[1-9]\\d*|\\d*[a-zA-Z-][0-9a-zA-Z-]*)$", Identifier))
+		if (!OUU::Runtime::SemVerParser::IsValidPreReleaseIdentifier(Identifier))
 		{
 			bIdentifiersOk = false;
 			break;
@@ -80,6 +80,29 @@ const TArray<FString>& FSemVerPreReleaseIdentifier::GetIdentifiers() const
 	return Identifiers;
 }
 
+uint8 FSemVerPreReleaseIdentifier::GetPrecedenceRank() const
+{
+	// Versions without pre-release have higher precedence than all pre-release versions
+	if (Identifiers.Num() == 0)
+		return MAX_uint8;
+
+	// Ranks 1-63: Numeric identifiers have lower precedence than alphanumeric ones.
+	// Big numbers are saturated, so they share a rank and fall back to the full comparison.
+	const FString& FirstIdentifier = Identifiers[0];
+	const int32 NumericIdentifier = TryParseNumericIdentifier(FirstIdentifier);
+	if (NumericIdentifier != INDEX_NONE)
+		return static_cast<uint8>(1 + FMath::Clamp(NumericIdentifier, 0, 62));
+
+	// Ranks 64-254: Alphanumeric identifiers are compared case-insensitive (see FString::operator<),
+	// so only the ASCII lower case of the first character may be used.
+	uint32 FirstChar = FirstIdentifier.Len() > 0 ? static_cast<uint32>(FirstIdentifier[0]) : 0;
+	if (FirstChar >= 'A' && FirstChar <= 'Z')
+	{
+		FirstChar += 'a' - 'A';
+	}
+	return static_cast<uint8>(64 + FMath::Min<uint32>(FirstChar, 190));
+}
+
 bool FSemVerPreReleaseIdentifier::TryIncrement()
 {
 	const int32 NumIdentifiers = Identifiers.Num();
@@ -115,8 +138,8 @@ bool FSemVerPreReleaseIdentifier::operator==(const FSemVerPreReleaseIdentifier&
 
 	for (int32 i = 0; i < ThisNumIdentifiers; i++)
 	{
-		const FString ThisIdentifier = Identifiers[i];
-		const FString OtherIdentifier = Other.Identifiers[i];
+		const FString& ThisIdentifier = Identifiers[i];
+		const FString& OtherIdentifier = Other.Identifiers[i];
 
 		if (ThisIdentifier != OtherIdentifier)
 		{
@@ -141,8 +164,8 @@ bool FSemVerPreReleaseIdentifier::operator<(const FSemVerPreReleaseIdentifier& O
 
 	for (int32 i = 0; i < MinNumIdentifiers; i++)
 	{
-		const FString ThisIdentifier = Identifiers[i];
-		const FString OtherIdentifier = Other.Identifiers[i];
+		const FString& ThisIdentifier = Identifiers[i];
+		const FString& OtherIdentifier = Other.Identifiers[i];
 
 		if (ThisIdentifier == OtherIdentifier)
 		{
@@ -170,8 +193,8 @@ bool FSemVerPreReleaseIdentifier::operator>(const FSemVerPreReleaseIdentifier& O
 
 	for (int32 i = 0; i < MinNumIdentifiers; i++)
 	{
-		const FString ThisIdentifier = Identifiers[i];
-		const FString OtherIdentifier = Other.Identifiers[i];
+		const FString& ThisIdentifier = Identifiers[i];
+		const FString& OtherIdentifier = Other.Identifiers[i];
 
 		if (ThisIdentifier == OtherIdentifier)
 		{
@@ -238,3 +261,14 @@ int32 FSemVerPreReleaseIdentifier::TryParseNumericIdentifier(const FString& Iden
 	}
 	return INDEX_NONE;
 }
+
+uint32 GetTypeHash(const FSemVerPreReleaseIdentifier& PreRelease)
+{
+	// FString hashes are case-insensitive just like the comparison in operator==
+	uint32 Hash = GetTypeHash(PreRelease.Identifiers.Num());
+	for (const FString& Identifier : PreRelease.Identifiers)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Identifier));
+	}
+	return Hash;
+}
@@ -0,0 +1,271 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "SemVer/SemVerParser.h"
+
+namespace OUU::Runtime::Private::SemVerParser
+{
+	FORCEINLINE bool IsDigit(TCHAR Char)
+	{
+		return Char >= TEXT('0') && Char <= TEXT('9');
+	}
+
+	// [0-9a-zA-Z-]
+	FORCEINLINE bool IsIdentifierChar(TCHAR Char)
+	{
+		return IsDigit(Char) || (Char >= TEXT('a') && Char <= TEXT('z')) || (Char >= TEXT('A') && Char <= TEXT('Z'))
+			|| Char == TEXT('-');
+	}
+
+	// [0-9a-zA-Z.-]
+	FORCEINLINE bool IsIdentifierOrDotChar(TCHAR Char)
+	{
+		return IsIdentifierChar(Char) || Char == TEXT('.');
+	}
+
+	// Same set as \s in ICU regex patterns ([\t\n\f\r\p{Z}]), which differs slightly from FChar::IsWhitespace
+	FORCEINLINE bool IsRegexWhitespace(TCHAR Char)
+	{
+		switch (Char)
+		{
+		case TEXT('\t'):
+		case TEXT('\n'):
+		case TEXT('\f'):
+		case TEXT('\r'):
+		case 0x0020:
+		case 0x00A0:
+		case 0x1680:
+		case 0x2028:
+		case 0x2029:
+		case 0x202F:
+		case 0x205F:
+		case 0x3000: return true;
+		default: return Char >= 0x2000 && Char <= 0x200A;
+		}
+	}
+
+	FORCEINLINE bool IsNotRegexWhitespace(TCHAR Char)
+	{
+		return !IsRegexWhitespace(Char);
+	}
+
+	struct FCursor
+	{
+		FStringView String;
+		int32 Pos = 0;
+
+		FORCEINLINE bool IsAtEnd() const { return Pos >= String.Len(); }
+
+		FORCEINLINE TCHAR Peek(int32 Offset = 0) const
+		{
+			return (Pos + Offset) < String.Len() ? String[Pos + Offset] : TCHAR(0);
+		}
+
+		FORCEINLINE bool TryConsume(TCHAR Char)
+		{
+			if (IsAtEnd() || String[Pos] != Char)
+				return false;
+
+			Pos++;
+			return true;
+		}
+
+		template <typename PredicateType>
+		FORCEINLINE FStringView ConsumeWhile(PredicateType Predicate)
+		{
+			const int32 Start = Pos;
+			while (!IsAtEnd() && Predicate(String[Pos]))
+			{
+				Pos++;
+			}
+			return String.Mid(Start, Pos - Start);
+		}
+
+		FORCEINLINE FStringView SubstringSince(int32 Start) const { return String.Mid(Start, Pos - Start); }
+	};
+
+	FORCEINLINE bool IsNonEmpty(FStringView Identifier)
+	{
+		return Identifier.Len() > 0;
+	}
+
+	/** Consume dot separated identifiers ([0-9a-zA-Z-]*) as long as each of them passes IsValidIdentifier. */
+	template <typename ValidatorType>
+	bool ParseDotSeparatedIdentifiers(FCursor& Cursor, ValidatorType IsValidIdentifier)
+	{
+		while (true)
+		{
+			if (!IsValidIdentifier(Cursor.ConsumeWhile(IsIdentifierChar)))
+				return false;
+			if (!Cursor.TryConsume(TEXT('.')))
+				return true;
+		}
+	}
+
+	// (0|[1-9]\d*)
+	bool ParseStrictNumber(FCursor& Cursor, FStringView& OutDigits)
+	{
+		OutDigits = Cursor.ConsumeWhile(IsDigit);
+		return OutDigits.Len() == 1 || (OutDigits.Len() > 1 && OutDigits[0] != TEXT('0'));
+	}
+
+	// \d+
+	bool ParseNumber(FCursor& Cursor, FStringView& OutDigits)
+	{
+		OutDigits = Cursor.ConsumeWhile(IsDigit);
+		return OutDigits.Len() > 0;
+	}
+
+	bool ParseStrict(FStringView SourceString, OUU::Runtime::SemVerParser::FSemVerStringComponents& Out)
+	{
+		FCursor Cursor{SourceString};
+		if (!ParseStrictNumber(Cursor, Out.Major) || !Cursor.TryConsume(TEXT('.'))
+			|| !ParseStrictNumber(Cursor, Out.Minor) || !Cursor.TryConsume(TEXT('.'))
+			|| !ParseStrictNumber(Cursor, Out.Patch))
+		{
+			return false;
+		}
+
+		if (Cursor.TryConsume(TEXT('-')))
+		{
+			const int32 Start = Cursor.Pos;
+			if (!ParseDotSeparatedIdentifiers(Cursor, OUU::Runtime::SemVerParser::IsValidPreReleaseIdentifier))
+				return false;
+			Out.PreRelease = Cursor.SubstringSince(Start);
+		}
+
+		if (Cursor.TryConsume(TEXT('+')))
+		{
+			const int32 Start = Cursor.Pos;
+			if (!ParseDotSeparatedIdentifiers(Cursor, IsNonEmpty))
+				return false;
+			Out.BuildMetadata = Cursor.SubstringSince(Start);
+		}
+
+		return Cursor.IsAtEnd();
+	}
+
+	bool ParseRegular(FStringView SourceString, OUU::Runtime::SemVerParser::FSemVerStringComponents& Out)
+	{
+		FCursor Cursor{SourceString};
+		if (!ParseNumber(Cursor, Out.Major) || !Cursor.TryConsume(TEXT('.')) || !ParseNumber(Cursor, Out.Minor)
+			|| !Cursor.TryConsume(TEXT('.')) || !ParseNumber(Cursor, Out.Patch))
+		{
+			return false;
+		}
+
+		if (Cursor.TryConsume(TEXT('-')))
+		{
+			Out.PreRelease = Cursor.ConsumeWhile(IsIdentifierOrDotChar);
+		}
+
+		if (Cursor.TryConsume(TEXT('+')))
+		{
+			Out.BuildMetadata = Cursor.ConsumeWhile(IsNotRegexWhitespace);
+		}
+
+		return Cursor.IsAtEnd();
+	}
+
+	/**
+	 * Mirrors the greedy first match of the liberal regex: Every component after the major version is optional and
+	 * only consumed if it is complete, so the match never has to backtrack.
+	 * @returns the end of the match or INDEX_NONE if the string contains no version.
+	 */
+	int32 ParseLiberal(FStringView SourceString, OUU::Runtime::SemVerParser::FSemVerStringComponents& Out)
+	{
+		int32 Start = 0;
+		while (Start < SourceString.Len() && !IsDigit(SourceString[Start]))
+		{
+			Start++;
+		}
+		if (Start == SourceString.Len())
+			return INDEX_NONE;
+
+		FCursor Cursor{SourceString, Start};
+		ParseNumber(Cursor, Out.Major);
+
+		// (?:\.(\d+))?
+		for (FStringView* Component : {&Out.Minor, &Out.Patch})
+		{
+			if (Cursor.Peek() == TEXT('.') && IsDigit(Cursor.Peek(1)))
+			{
+				Cursor.Pos++;
+				ParseNumber(Cursor, *Component);
+			}
+		}
+
+		Cursor.TryConsume(TEXT('-'));
+		Out.PreRelease = Cursor.ConsumeWhile(IsIdentifierOrDotChar);
+
+		if (Cursor.TryConsume(TEXT('+')))
+		{
+			Out.BuildMetadata = Cursor.ConsumeWhile(IsNotRegexWhitespace);
+		}
+
+		return Cursor.Pos;
+	}
+} // namespace OUU::Runtime::Private::SemVerParser
+
+namespace OUU::Runtime::SemVerParser
+{
+	bool TryParse(FStringView SourceString, ESemVerParsingStrictness Strictness, FSemVerStringComponents& OutComponents)
+	{
+		using namespace Private::SemVerParser;
+
+		OutComponents = {};
+		switch (Strictness)
+		{
+		case ESemVerParsingStrictness::Strict: return ParseStrict(SourceString, OutComponents);
+		case ESemVerParsingStrictness::Regular: return ParseRegular(SourceString, OutComponents);
+		case ESemVerParsingStrictness::Liberal: return ParseLiberal(SourceString, OutComponents) != INDEX_NONE;
+		default: return false;
+		}
+	}
+
+	bool IsValidSemVer(FStringView SourceString, ESemVerParsingStrictness Strictness)
+	{
+		FSemVerStringComponents Components;
+		if (Strictness != ESemVerParsingStrictness::Liberal)
+			return TryParse(SourceString, Strictness, Components);
+
+		// The liberal match has to start at the first character and cover the entire string
+		return SourceString.Len() > 0 && Private::SemVerParser::IsDigit(SourceString[0])
+			&& Private::SemVerParser::ParseLiberal(SourceString, Components) == SourceString.Len();
+	}
+
+	int32 ParseVersionNumber(FStringView Digits)
+	{
+		int64 Result = 0;
+		for (const TCHAR Char : Digits)
+		{
+			Result = Result * 10 + (Char - TEXT('0'));
+			if (Result >= MAX_int32)
+				return MAX_int32;
+		}
+		return static_cast<int32>(Result);
+	}
+
+	bool IsValidPreReleaseIdentifier(FStringView Identifier)
+	{
+		// 0|[1-9]\d*|\d*[a-zA-Z-][0-9a-zA-Z-]*
+		if (Identifier.Len() == 0)
+			return false;
+
+		bool bIsNumeric = true;
+		for (const TCHAR Char : Identifier)
+		{
+			if (!Private::SemVerParser::IsIdentifierChar(Char))
+				return false;
+			bIsNumeric &= Private::SemVerParser::IsDigit(Char);
+		}
+		return !bIsNumeric || Identifier.Len() == 1 || Identifier[0] != TEXT('0');
+	}
+
+	bool IsValidStrictBuildMetadata(FStringView Metadata)
+	{
+		// [0-9a-zA-Z-]+(?:\.[0-9a-zA-Z-]+)*
+		Private::SemVerParser::FCursor Cursor{Metadata};
+		return Private::SemVerParser::ParseDotSeparatedIdentifiers(Cursor, Private::SemVerParser::IsNonEmpty)
+			&& Cursor.IsAtEnd();
+	}
+} // namespace OUU::Runtime::SemVerParser
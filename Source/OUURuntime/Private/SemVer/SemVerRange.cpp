@@ -0,0 +1,564 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "SemVer/SemVerRange.h"
+
+#include "Misc/Parse.h"
+#include "SemVer/SemVerParser.h"
+
+namespace OUU::Runtime::Private::SemVerRange
+{
+	enum class EOperator
+	{
+		None,
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		Equal,
+		Tilde,
+		Caret
+	};
+
+	/** Version that may be incomplete, e.g. "1", "1.2", "1.x", "*" */
+	struct FPartialVersion
+	{
+		// Number of specified components. Wildcards and all components after them are not specified.
+		int32 NumComponents = 0;
+		int32 Components[3] = {0, 0, 0};
+		FSemVerPreReleaseIdentifier PreRelease;
+	};
+
+	FORCEINLINE bool IsDigit(TCHAR Char)
+	{
+		return Char >= TEXT('0') && Char <= TEXT('9');
+	}
+
+	FORCEINLINE bool IsWildcard(TCHAR Char)
+	{
+		return Char == TEXT('x') || Char == TEXT('X') || Char == TEXT('*');
+	}
+
+	// [0-9a-zA-Z.-]
+	FORCEINLINE bool IsQualifierChar(TCHAR Char)
+	{
+		return IsDigit(Char) || (Char >= TEXT('a') && Char <= TEXT('z')) || (Char >= TEXT('A') && Char <= TEXT('Z'))
+			|| Char == TEXT('-') || Char == TEXT('.');
+	}
+
+	EOperator ConsumeOperator(FStringView& Token)
+	{
+		struct FOperatorPrefix
+		{
+			FStringView Prefix;
+			EOperator Operator;
+		};
+		// Longer prefixes first, so ">=" is not consumed as ">"
+		static const FOperatorPrefix OperatorPrefixes[] = {
+			{TEXT(">="), EOperator::GreaterEqual},
+			{TEXT("<="), EOperator::LessEqual},
+			{TEXT("~>"), EOperator::Tilde},
+			{TEXT(">"), EOperator::Greater},
+			{TEXT("<"), EOperator::Less},
+			{TEXT("="), EOperator::Equal},
+			{TEXT("~"), EOperator::Tilde},
+			{TEXT("^"), EOperator::Caret},
+		};
+
+		for (const FOperatorPrefix& Entry : OperatorPrefixes)
+		{
+			if (Token.StartsWith(Entry.Prefix, ESearchCase::CaseSensitive))
+			{
+				Token.RightChopInline(Entry.Prefix.Len());
+				return Entry.Operator;
+			}
+		}
+		return EOperator::None;
+	}
+
+	bool TryParsePartialVersion(FStringView Token, FPartialVersion& Out)
+	{
+		if (Token.Len() > 0 && (Token[0] == TEXT('v') || Token[0] == TEXT('V')))
+		{
+			Token.RightChopInline(1);
+		}
+		if (Token.IsEmpty())
+			return false;
+
+		int32 Pos = 0;
+		bool bHadWildcard = false;
+		for (int32 ComponentIdx = 0; ComponentIdx < 3 && Pos < Token.Len(); ComponentIdx++)
+		{
+			if (ComponentIdx > 0)
+			{
+				if (Token[Pos] != TEXT('.'))
+					break;
+				Pos++;
+			}
+
+			if (Pos < Token.Len() && IsWildcard(Token[Pos]))
+			{
+				bHadWildcard = true;
+				Pos++;
+				continue;
+			}
+
+			const int32 Start = Pos;
+			while (Pos < Token.Len() && IsDigit(Token[Pos]))
+			{
+				Pos++;
+			}
+			// Numbers after a wildcard (e.g. "1.x.3") are not allowed
+			if (Pos == Start || bHadWildcard)
+				return false;
+
+			Out.Components[ComponentIdx] = SemVerParser::ParseVersionNumber(Token.Mid(Start, Pos - Start));
+			Out.NumComponents = ComponentIdx + 1;
+		}
+
+		// Pre-release and build metadata are only allowed on complete versions
+		if (Pos < Token.Len() && Out.NumComponents == 3 && Token[Pos] == TEXT('-'))
+		{
+			const int32 Start = ++Pos;
+			while (Pos < Token.Len() && IsQualifierChar(Token[Pos]))
+			{
+				Pos++;
+			}
+			const FString PreReleaseString(Token.Mid(Start, Pos - Start));
+			if (PreReleaseString.IsEmpty()
+				|| !Out.PreRelease.TryParseString(PreReleaseString, ESemVerParsingStrictness::Strict))
+			{
+				return false;
+			}
+		}
+
+		// Build metadata does not affect precedence, so it's validated and skipped
+		if (Pos < Token.Len() && Out.NumComponents == 3 && Token[Pos] == TEXT('+'))
+		{
+			const int32 Start = ++Pos;
+			while (Pos < Token.Len() && IsQualifierChar(Token[Pos]))
+			{
+				Pos++;
+			}
+			if (!SemVerParser::IsValidStrictBuildMetadata(Token.Mid(Start, Pos - Start)))
+				return false;
+		}
+
+		return Pos == Token.Len();
+	}
+
+	FORCEINLINE int32 SaturatingIncrement(int32 Value)
+	{
+		return Value == MAX_int32 ? Value : Value + 1;
+	}
+
+	FSemanticVersion MakeVersion(int32 Major, int32 Minor, int32 Patch, const FSemVerPreReleaseIdentifier& PreRelease)
+	{
+		// Assign the members directly, because the constructor rejects 0.0.0, which is a valid bound
+		FSemanticVersion Result;
+		Result.MajorVersion = Major;
+		Result.MinorVersion = Minor;
+		Result.PatchVersion = Patch;
+		Result.PreReleaseIdentifier = PreRelease;
+		return Result;
+	}
+
+	FSemVerRangeBound MakeBound(int32 Major, int32 Minor, int32 Patch, bool bInclusive)
+	{
+		return FSemVerRangeBound(MakeVersion(Major, Minor, Patch, {}), bInclusive);
+	}
+
+	FSemVerRangeBound MakeBound(const FPartialVersion& Partial, bool bInclusive)
+	{
+		const int32* C = Partial.Components;
+		return FSemVerRangeBound(MakeVersion(C[0], C[1], C[2], Partial.PreRelease), bInclusive);
+	}
+
+	/** Exclusive upper bound below the lowest pre-release of the version, i.e. "<Major.Minor.Patch-0" */
+	FSemVerRangeBound MakeUpperBoundBelowPreReleases(int32 Major, int32 Minor, int32 Patch)
+	{
+		static const FSemVerPreReleaseIdentifier LowestPreRelease(TEXT("0"));
+		return FSemVerRangeBound(MakeVersion(Major, Minor, Patch, LowestPreRelease), false);
+	}
+
+	/** Exclusive upper bound for all versions with the same major version ("1") or major and minor version ("1.2") */
+	FSemVerRangeBound MakeUpperBoundOfPartial(const FPartialVersion& Partial)
+	{
+		const int32* C = Partial.Components;
+		return Partial.NumComponents == 1 ? MakeUpperBoundBelowPreReleases(SaturatingIncrement(C[0]), 0, 0)
+										  : MakeUpperBoundBelowPreReleases(C[0], SaturatingIncrement(C[1]), 0);
+	}
+
+	void MakeIntervalEmpty(FSemVerRangeInterval& Interval)
+	{
+		Interval.IntersectLower(MakeBound(0, 0, 0, true));
+		Interval.IntersectUpper(MakeUpperBoundBelowPreReleases(0, 0, 0));
+	}
+
+	void ApplyComparator(FSemVerRangeInterval& Interval, EOperator Operator, const FPartialVersion& Partial)
+	{
+		const int32 NumComponents = Partial.NumComponents;
+		const int32* C = Partial.Components;
+
+		if (NumComponents == 0)
+		{
+			// "<*" and ">*" can't be satisfied, all other operators are satisfied by any version
+			if (Operator == EOperator::Less || Operator == EOperator::Greater)
+			{
+				MakeIntervalEmpty(Interval);
+			}
+			return;
+		}
+
+		switch (Operator)
+		{
+		case EOperator::None:
+		case EOperator::Equal:
+			if (NumComponents == 3)
+			{
+				Interval.IntersectLower(MakeBound(Partial, true));
+				Interval.IntersectUpper(MakeBound(Partial, true));
+			}
+			else
+			{
+				Interval.IntersectLower(MakeBound(Partial, true));
+				Interval.IntersectUpper(MakeUpperBoundOfPartial(Partial));
+			}
+			break;
+		case EOperator::Greater:
+			if (NumComponents == 3)
+			{
+				Interval.IntersectLower(MakeBound(Partial, false));
+			}
+			else
+			{
+				// ">1.2" is ">=1.3.0"
+				Interval.IntersectLower(
+					NumComponents == 1 ? MakeBound(SaturatingIncrement(C[0]), 0, 0, true)
+									   : MakeBound(C[0], SaturatingIncrement(C[1]), 0, true));
+			}
+			break;
+		case EOperator::GreaterEqual: Interval.IntersectLower(MakeBound(Partial, true)); break;
+		case EOperator::Less:
+			if (NumComponents == 3)
+			{
+				Interval.IntersectUpper(MakeBound(Partial, false));
+			}
+			else
+			{
+				// "<1.2" is "<1.2.0-0"
+				Interval.IntersectUpper(MakeUpperBoundBelowPreReleases(C[0], C[1], 0));
+			}
+			break;
+		case EOperator::LessEqual:
+			if (NumComponents == 3)
+			{
+				Interval.IntersectUpper(MakeBound(Partial, true));
+			}
+			else
+			{
+				Interval.IntersectUpper(MakeUpperBoundOfPartial(Partial));
+			}
+			break;
+		case EOperator::Tilde:
+			// Allow patch level changes if a minor version is specified, minor level changes if not
+			Interval.IntersectLower(MakeBound(Partial, true));
+			Interval.IntersectUpper(MakeUpperBoundOfPartial(Partial));
+			break;
+		case EOperator::Caret:
+			// Allow changes that do not modify the left-most non-zero component
+			Interval.IntersectLower(MakeBound(Partial, true));
+			if (C[0] > 0 || NumComponents == 1)
+			{
+				Interval.IntersectUpper(MakeUpperBoundBelowPreReleases(SaturatingIncrement(C[0]), 0, 0));
+			}
+			else if (C[1] > 0 || NumComponents == 2)
+			{
+				Interval.IntersectUpper(MakeUpperBoundBelowPreReleases(0, SaturatingIncrement(C[1]), 0));
+			}
+			else
+			{
+				Interval.IntersectUpper(MakeUpperBoundBelowPreReleases(0, 0, SaturatingIncrement(C[2])));
+			}
+			break;
+		}
+	}
+
+	void SplitAtWhitespace(FStringView String, TArray<FStringView, TInlineAllocator<8>>& OutTokens)
+	{
+		int32 Pos = 0;
+		while (Pos < String.Len())
+		{
+			if (FChar::IsWhitespace(String[Pos]))
+			{
+				Pos++;
+				continue;
+			}
+
+			const int32 Start = Pos;
+			while (Pos < String.Len() && !FChar::IsWhitespace(String[Pos]))
+			{
+				Pos++;
+			}
+			OutTokens.Add(String.Mid(Start, Pos - Start));
+		}
+	}
+
+	/** Compile a whitespace separated comparator set or a hyphen range into an interval */
+	bool TryParseComparatorSet(FStringView ComparatorSet, FSemVerRangeInterval& OutInterval)
+	{
+		TArray<FStringView, TInlineAllocator<8>> Tokens;
+		SplitAtWhitespace(ComparatorSet, Tokens);
+
+		// "1.2.3 - 2.3.4" is ">=1.2.3 <=2.3.4"
+		if (Tokens.Num() == 3 && Tokens[1].Equals(TEXT("-")))
+		{
+			FPartialVersion From, To;
+			if (!TryParsePartialVersion(Tokens[0], From) || !TryParsePartialVersion(Tokens[2], To))
+				return false;
+
+			ApplyComparator(OutInterval, EOperator::GreaterEqual, From);
+			ApplyComparator(OutInterval, EOperator::LessEqual, To);
+			return true;
+		}
+
+		for (int32 TokenIdx = 0; TokenIdx < Tokens.Num(); TokenIdx++)
+		{
+			FStringView Token = Tokens[TokenIdx];
+			const EOperator Operator = ConsumeOperator(Token);
+
+			// Operators may be separated from their version by whitespace, e.g. ">= 1.2.3"
+			if (Token.IsEmpty() && Operator != EOperator::None && TokenIdx + 1 < Tokens.Num())
+			{
+				Token = Tokens[++TokenIdx];
+			}
+
+			FPartialVersion Partial;
+			if (!TryParsePartialVersion(Token, Partial))
+				return false;
+
+			ApplyComparator(OutInterval, Operator, Partial);
+		}
+
+		// An empty comparator set is satisfied by any version, just like "*"
+		return true;
+	}
+} // namespace OUU::Runtime::Private::SemVerRange
+
+//////////////////////////////////////////////////////////////////////////
+
+FSemVerRangeBound::FSemVerRangeBound(const FSemanticVersion& InVersion, bool bInInclusive) :
+	Version(InVersion), Key(InVersion.GetPrecedenceKey()), bInclusive(bInInclusive)
+{
+}
+
+int32 FSemVerRangeBound::ComparePrecedence(const FSemanticVersion& Other, uint64 OtherKey) const
+{
+	if (OtherKey != Key)
+		return OtherKey < Key ? -1 : 1;
+	if (Other < Version)
+		return -1;
+	return Version < Other ? 1 : 0;
+}
+
+bool FSemVerRangeBound::AllowsPreReleasesOf(const FSemanticVersion& Other) const
+{
+	return Version.PreReleaseIdentifier.GetIdentifiers().Num() > 0 && Version.MajorVersion == Other.MajorVersion
+		&& Version.MinorVersion == Other.MinorVersion && Version.PatchVersion == Other.PatchVersion;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void FSemVerRangeInterval::IntersectLower(const FSemVerRangeBound& Bound)
+{
+	if (Lower.IsSet())
+	{
+		// Keep the current bound if it's higher or if it's equally high and at least as strict
+		const int32 Comparison = Lower->ComparePrecedence(Bound.Version, Bound.Key);
+		if (Comparison < 0 || (Comparison == 0 && (!Lower->bInclusive || Bound.bInclusive)))
+			return;
+	}
+	Lower = Bound;
+}
+
+void FSemVerRangeInterval::IntersectUpper(const FSemVerRangeBound& Bound)
+{
+	if (Upper.IsSet())
+	{
+		// Keep the current bound if it's lower or if it's equally low and at least as strict
+		const int32 Comparison = Upper->ComparePrecedence(Bound.Version, Bound.Key);
+		if (Comparison > 0 || (Comparison == 0 && (!Upper->bInclusive || Bound.bInclusive)))
+			return;
+	}
+	Upper = Bound;
+}
+
+bool FSemVerRangeInterval::IsEmpty() const
+{
+	if (!Lower.IsSet() || !Upper.IsSet())
+		return false;
+
+	const int32 Comparison = Lower->ComparePrecedence(Upper->Version, Upper->Key);
+	return Comparison < 0 || (Comparison == 0 && !(Lower->bInclusive && Upper->bInclusive));
+}
+
+bool FSemVerRangeInterval::Contains(const FSemanticVersion& Version, uint64 VersionKey, bool bIncludePreReleases) const
+{
+	if (Lower.IsSet())
+	{
+		const int32 Comparison = Lower->ComparePrecedence(Version, VersionKey);
+		if (Comparison < 0 || (Comparison == 0 && !Lower->bInclusive))
+			return false;
+	}
+
+	if (Upper.IsSet())
+	{
+		const int32 Comparison = Upper->ComparePrecedence(Version, VersionKey);
+		if (Comparison > 0 || (Comparison == 0 && !Upper->bInclusive))
+			return false;
+	}
+
+	if (bIncludePreReleases || Version.PreReleaseIdentifier.GetIdentifiers().Num() == 0)
+		return true;
+
+	return (Lower.IsSet() && Lower->AllowsPreReleasesOf(Version))
+		|| (Upper.IsSet() && Upper->AllowsPreReleasesOf(Version));
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+FSemVerRange::FSemVerRange() : Expression(TEXT("*"))
+{
+	Intervals.AddDefaulted();
+}
+
+FSemVerRange::FSemVerRange(const FString& SourceString)
+{
+	TryParseString(SourceString);
+}
+
+bool FSemVerRange::TryParseString(const FString& SourceString)
+{
+	using namespace OUU::Runtime::Private::SemVerRange;
+
+	Intervals.Reset();
+	bool bSuccess = true;
+	FStringView Remaining = SourceString;
+	while (true)
+	{
+		const int32 SeparatorIdx = Remaining.Find(TEXT("||"));
+		const FStringView ComparatorSet = SeparatorIdx == INDEX_NONE ? Remaining : Remaining.Left(SeparatorIdx);
+
+		FSemVerRangeInterval Interval;
+		if (!TryParseComparatorSet(ComparatorSet, Interval))
+		{
+			bSuccess = false;
+			break;
+		}
+
+		// Unsatisfiable comparator sets (e.g. ">2.0.0 <1.0.0") don't need to be checked at all
+		if (!Interval.IsEmpty())
+		{
+			Intervals.Add(MoveTemp(Interval));
+		}
+
+		if (SeparatorIdx == INDEX_NONE)
+			break;
+		Remaining.RightChopInline(SeparatorIdx + 2);
+	}
+
+	// Keep the expression even if it's invalid, so it can be inspected and stays invalid after serialization
+	Expression = SourceString;
+	if (!bSuccess)
+	{
+		Intervals.Reset();
+	}
+	return bSuccess;
+}
+
+FString FSemVerRange::ToString() const
+{
+	return Expression;
+}
+
+const TArray<FSemVerRangeInterval>& FSemVerRange::GetIntervals() const
+{
+	return Intervals;
+}
+
+bool FSemVerRange::IsEmpty() const
+{
+	return Intervals.Num() == 0;
+}
+
+bool FSemVerRange::IsSatisfiedBy(const FSemanticVersion& Version, bool bIncludePreReleases /*= false*/) const
+{
+	return IsSatisfiedBy_Internal(Version, Version.GetPrecedenceKey(), bIncludePreReleases);
+}
+
+int32 FSemVerRange::FindMaxSatisfying(
+	TConstArrayView<FSemanticVersion> Candidates,
+	bool bIncludePreReleases /*= false*/) const
+{
+	int32 BestIdx = INDEX_NONE;
+	uint64 BestKey = 0;
+	for (int32 CandidateIdx = 0; CandidateIdx < Candidates.Num(); CandidateIdx++)
+	{
+		const FSemanticVersion& Candidate = Candidates[CandidateIdx];
+		const uint64 Key = Candidate.GetPrecedenceKey();
+
+		// Skip candidates that can't beat the current best before checking the range
+		if (BestIdx != INDEX_NONE && (Key < BestKey || (Key == BestKey && !(Candidates[BestIdx] < Candidate))))
+			continue;
+
+		if (!IsSatisfiedBy_Internal(Candidate, Key, bIncludePreReleases))
+			continue;
+
+		BestIdx = CandidateIdx;
+		BestKey = Key;
+	}
+	return BestIdx;
+}
+
+void FSemVerRange::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		TryParseString(CopyTemp(Expression));
+	}
+}
+
+bool FSemVerRange::ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText)
+{
+	if (*Buffer == TEXT('"'))
+	{
+		FString ImportedExpression;
+		int32 NumCharsRead = 0;
+		if (!FParse::QuotedString(Buffer, ImportedExpression, &NumCharsRead))
+			return false;
+
+		Buffer += NumCharsRead;
+		TryParseString(ImportedExpression);
+		return true;
+	}
+
+	// Default struct import without the native override, so this function is not called recursively
+	UScriptStruct* Struct = StaticStruct();
+	const TCHAR* Result = Struct->ImportText(Buffer, this, Parent, PortFlags, ErrorText, Struct->GetName(), false);
+	if (Result == nullptr)
+		return false;
+
+	Buffer = Result;
+	TryParseString(CopyTemp(Expression));
+	return true;
+}
+
+bool FSemVerRange::IsSatisfiedBy_Internal(const FSemanticVersion& Version, uint64 VersionKey, bool bIncludePreReleases)
+	const
+{
+	for (const FSemVerRangeInterval& Interval : Intervals)
+	{
+		if (Interval.Contains(Version, VersionKey, bIncludePreReleases))
+			return true;
+	}
+	return false;
+}
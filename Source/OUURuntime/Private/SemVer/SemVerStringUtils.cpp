@@ -2,11 +2,10 @@
 
 #include "SemVer/SemVerStringUtils.h"
 
-#include "Misc/RegexUtils.h"
+#include "SemVer/SemVerParser.h"
 #include "SemVer/SemVerParsingStrictness.h"
-#include "SemVer/SemVerRegex.h"
 
 bool USemVerStringLibrary::IsValidSemanticVersion(const FString& InString, ESemVerParsingStrictness ParsingStrictness)
 {
-	return OUU::Runtime::RegexUtils::MatchesRegexExact(FSemVerRegex::String(ParsingStrictness), InString);
+	return OUU::Runtime::SemVerParser::IsValidSemVer(InString, ParsingStrictness);
 }
@@ -2,9 +2,9 @@
 
 #include "SemVer/SemanticVersion.h"
 
+#include "Algo/Sort.h"
 #include "LogOpenUnrealUtilities.h"
-#include "Misc/RegexUtils.h"
-#include "SemVer/SemVerRegex.h"
+#include "SemVer/SemVerParser.h"
 
 FSemanticVersion::FSemanticVersion(
 	int32 Major,
@@ -135,6 +135,45 @@ bool FSemanticVersion::TryIncrementPreReleaseVersion()
 	return PreReleaseIdentifier.TryIncrement();
 }
 
+uint64 FSemanticVersion::GetPrecedenceKey() const
+{
+	const auto PackComponent = [](int32 Value, int32 NumBits) -> uint64 {
+		return static_cast<uint64>(FMath::Clamp<int64>(Value, 0, (int64(1) << NumBits) - 1));
+	};
+	return (PackComponent(MajorVersion, 20) << 44) | (PackComponent(MinorVersion, 18) << 26)
+		| (PackComponent(PatchVersion, 18) << 8) | PreReleaseIdentifier.GetPrecedenceRank();
+}
+
+void FSemanticVersion::SortByPrecedence(TArray<FSemanticVersion>& Versions)
+{
+	struct FSortEntry
+	{
+		uint64 Key;
+		int32 Index;
+	};
+
+	TArray<FSortEntry> Entries;
+	Entries.Reserve(Versions.Num());
+	for (int32 i = 0; i < Versions.Num(); i++)
+	{
+		Entries.Add(FSortEntry{Versions[i].GetPrecedenceKey(), i});
+	}
+
+	Algo::Sort(Entries, [&Versions](const FSortEntry& A, const FSortEntry& B) {
+		if (A.Key != B.Key)
+			return A.Key < B.Key;
+		return Versions[A.Index].ComparePrecedenceFull_Internal(Versions[B.Index], true);
+	});
+
+	TArray<FSemanticVersion> SortedVersions;
+	SortedVersions.Reserve(Versions.Num());
+	for (const FSortEntry& Entry : Entries)
+	{
+		SortedVersions.Add(MoveTemp(Versions[Entry.Index]));
+	}
+	Versions = MoveTemp(SortedVersions);
+}
+
 bool FSemanticVersion::EqualsPrecedence(const FSemanticVersion& Other) const
 {
 	return MajorVersion == Other.MajorVersion && MinorVersion == Other.MinorVersion
@@ -174,33 +213,13 @@ bool FSemanticVersion::operator>=(const FSemanticVersion& Other) const
 
 bool FSemanticVersion::TryParseString_Internal(const FString& SourceString, ESemVerParsingStrictness Strictness)
 {
-	FString VersionNumbersString, PreReleaseAndBuildNr, PreReleaseString, BuildMetadataString;
-
-	FRegexGroups Result;
-	if (Strictness == ESemVerParsingStrictness::Liberal)
-	{
-		TArray<FRegexGroups> Matches =
-			OUU::Runtime::RegexUtils::GetRegexMatchesAndGroups(FSemVerRegex::String(Strictness), 5, SourceString);
-		if (Matches.Num() > 0)
-		{
-			Result = Matches[0];
-		}
-	}
-	else
-	{
-		Result =
-			OUU::Runtime::RegexUtils::GetRegexMatchAndGroupsExact(FSemVerRegex::String(Strictness), 5, SourceString);
-	}
-
-	if (!Result.IsValid())
-		return false;
-
-	if (!ensure(Result.CaptureGroups.Num() == 6))
+	OUU::Runtime::SemVerParser::FSemVerStringComponents Components;
+	if (!OUU::Runtime::SemVerParser::TryParse(SourceString, Strictness, Components))
 		return false;
 
-	LexFromString(MajorVersion, *Result.CaptureGroups[1].MatchString);
-	LexFromString(MinorVersion, *Result.CaptureGroups[2].MatchString);
-	LexFromString(PatchVersion, *Result.CaptureGroups[3].MatchString);
+	MajorVersion = OUU::Runtime::SemVerParser::ParseVersionNumber(Components.Major);
+	MinorVersion = OUU::Runtime::SemVerParser::ParseVersionNumber(Components.Minor);
+	PatchVersion = OUU::Runtime::SemVerParser::ParseVersionNumber(Components.Patch);
 
 	// Check for max int
 	UE_CLOG(
@@ -222,13 +241,24 @@ bool FSemanticVersion::TryParseString_Internal(const FString& SourceString, ESem
 		TEXT("PatchVersion is equal to maximum integer value after parsing. Such high version numbers are not "
 			 "supported!"));
 
-	PreReleaseIdentifier = {Result.CaptureGroups[4].MatchString, Strictness};
-	BuildMetadata = {Result.CaptureGroups[5].MatchString, Strictness};
+	PreReleaseIdentifier = {FString(Components.PreRelease), Strictness};
+	BuildMetadata = {FString(Components.BuildMetadata), Strictness};
 
 	return true;
 }
 
 bool FSemanticVersion::ComparePrecedence_Internal(const FSemanticVersion& Other, bool bSmallerThan) const
+{
+	// Most comparisons are decided by the packed key without touching the pre-release strings
+	const uint64 Key = GetPrecedenceKey();
+	const uint64 OtherKey = Other.GetPrecedenceKey();
+	if (Key != OtherKey)
+		return bSmallerThan ? Key < OtherKey : Key > OtherKey;
+
+	return ComparePrecedenceFull_Internal(Other, bSmallerThan);
+}
+
+bool FSemanticVersion::ComparePrecedenceFull_Internal(const FSemanticVersion& Other, bool bSmallerThan) const
 {
 	if (MajorVersion < Other.MajorVersion)
 		return bSmallerThan;
@@ -249,3 +279,11 @@ bool FSemanticVersion::ComparePrecedence_Internal(const FSemanticVersion& Other,
 
 	return false;
 }
+
+uint32 GetTypeHash(const FSemanticVersion& Version)
+{
+	uint32 Hash = HashCombine(GetTypeHash(Version.MajorVersion), GetTypeHash(Version.MinorVersion));
+	Hash = HashCombine(Hash, GetTypeHash(Version.PatchVersion));
+	Hash = HashCombine(Hash, GetTypeHash(Version.PreReleaseIdentifier));
+	return HashCombine(Hash, GetTypeHash(Version.BuildMetadata));
+}
@@ -157,3 +157,37 @@ FString USemanticVersionBlueprintLibrary::Conv_BuildMetadataString(const FSemVer
 {
 	return InBuildMetadata.ToString();
 }
+
+bool USemanticVersionBlueprintLibrary::TryParseSemVerRangeString(const FString& SourceString, FSemVerRange& OutRange)
+{
+	return OutRange.TryParseString(SourceString);
+}
+
+bool USemanticVersionBlueprintLibrary::SemVerSatisfiesRange(
+	const FSemanticVersion& Version,
+	const FSemVerRange& Range,
+	bool bIncludePreReleases)
+{
+	return Range.IsSatisfiedBy(Version, bIncludePreReleases);
+}
+
+bool USemanticVersionBlueprintLibrary::TryFindMaxSatisfyingSemVer(
+	const TArray<FSemanticVersion>& Candidates,
+	const FSemVerRange& Range,
+	bool bIncludePreReleases,
+	FSemanticVersion& OutVersion)
+{
+	const int32 Index = Range.FindMaxSatisfying(Candidates, bIncludePreReleases);
+	if (Index == INDEX_NONE)
+	{
+		OutVersion = FSemanticVersion();
+		return false;
+	}
+	OutVersion = Candidates[Index];
+	return true;
+}
+
+FString USemanticVersionBlueprintLibrary::Conv_SemVerRangeString(const FSemVerRange& InRange)
+{
+	return InRange.ToString();
+}
@@ -137,6 +137,13 @@ void FGameplayDebuggerCategory_SequentialFrameScheduler::DrawData(
 	const int32 MaxNumTasksExecuted = DebugScheduler->DebugData.NumTasksExecutedRingBuffer.Max();
 	CanvasContext.Printf(TEXT("Max num tasks / frame: %i"), MaxNumTasksExecuted);
 
+	const auto& TaskDurationQuantiles = DebugScheduler->DebugData.TaskDurationQuantiles;
+	CanvasContext.Printf(
+		TEXT("Task duration p50: %.4fms, p95: %.4fms, p99: %.4fms"),
+		TaskDurationQuantiles.GetQuantile(0.5) * 1000.f,
+		TaskDurationQuantiles.GetQuantile(0.95) * 1000.f,
+		TaskDurationQuantiles.GetQuantile(0.99) * 1000.f);
+
 	CanvasContext.MoveToNewLine();
 
 	auto& TaskHistory = DebugScheduler->DebugData.TaskHistory;
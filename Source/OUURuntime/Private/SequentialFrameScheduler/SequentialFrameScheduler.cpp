@@ -113,6 +113,7 @@ void FSequentialFrameScheduler::Tick(float DeltaTime)
 			CurrentTask->Handle,
 			TaskWaitTime,
 			TimeAfterTask - TimeBeforeTask});
+		DebugData.TaskDurationQuantiles.Add(static_cast<float>(TimeAfterTask - TimeBeforeTask));
 #endif
 	}
 #if WITH_GAMEPLAY_DEBUGGER
@@ -0,0 +1,324 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "Templates/FrameArena.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/ThreadManager.h"
+#include "LogOpenUnrealUtilities.h"
+#include "Misc/CoreDelegates.h"
+
+namespace OUU::Runtime
+{
+	namespace
+	{
+		TAutoConsoleVariable<int32> CVar_FrameArenaBlockSizeKB{
+			TEXT("ouu.FrameArena.BlockSizeKB"),
+			64,
+			TEXT("Initial size of the per-thread frame arena blocks in KB. Arenas that overflow in a frame grow their "
+				 "first block to the high water mark of that frame.")};
+
+		struct FArenaRegistry
+		{
+			FCriticalSection Lock;
+			TArray<FFrameArena*> Arenas;
+		};
+
+		FArenaRegistry& GetRegistry()
+		{
+			static FArenaRegistry Registry;
+			return Registry;
+		}
+
+		SIZE_T GetBlockSize()
+		{
+			return static_cast<SIZE_T>(FMath::Max(CVar_FrameArenaBlockSizeKB.GetValueOnAnyThread(), 1)) * 1024;
+		}
+
+		FDelegateHandle OnEndFrameHandle;
+
+		FAutoConsoleCommand CCommand_DumpFrameArenaStats{
+			TEXT("ouu.FrameArena.DumpStats"),
+			TEXT("Print the frame arena usage of all threads to the log"),
+			FConsoleCommandDelegate::CreateLambda([]() {
+				for (const FFrameArenaStats& Stats : FFrameArena::GetAllThreadStats())
+				{
+					UE_LOG(
+						LogOpenUnrealUtilities,
+						Log,
+						TEXT("Frame arena of thread '%s' (%u): last frame %llu bytes, high water mark %llu bytes, "
+							 "reserved %llu bytes, %llu overflow frames"),
+						*FThreadManager::GetThreadName(Stats.ThreadId),
+						Stats.ThreadId,
+						static_cast<uint64>(Stats.LastFrameBytes),
+						static_cast<uint64>(Stats.HighWaterMarkBytes),
+						static_cast<uint64>(Stats.ReservedBytes),
+						Stats.NumOverflowFrames);
+				}
+			})};
+	} // namespace
+
+	std::atomic<uint32> FFrameArena::GlobalFrameIndex{0};
+
+	FFrameArena::FFrameArena() :
+		LastFrameIndex(GlobalFrameIndex.load(std::memory_order_relaxed)), ThreadId(FPlatformTLS::GetCurrentThreadId()),
+		bIsGameThreadArena(IsInGameThread())
+	{
+		FArenaRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+		Registry.Arenas.Add(this);
+	}
+
+	FFrameArena::~FFrameArena()
+	{
+		checkf(NumOpenMarks == 0, TEXT("Frame arena destroyed while %i marks were still open"), NumOpenMarks);
+		{
+			FArenaRegistry& Registry = GetRegistry();
+			FScopeLock Lock(&Registry.Lock);
+			Registry.Arenas.RemoveSwap(this);
+		}
+		FreeBlocks();
+	}
+
+	FFrameArena& FFrameArena::Get()
+	{
+		static thread_local FFrameArena Arena;
+		return Arena;
+	}
+
+	void* FFrameArena::Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NumBytesToCopy, SIZE_T NewSize, uint32 Alignment)
+	{
+		if (NewSize == 0)
+		{
+			Free(Ptr, OldSize);
+			return nullptr;
+		}
+
+		ConditionalResetForNewFrame();
+
+		const UPTRINT Address = reinterpret_cast<UPTRINT>(Ptr);
+		if (Ptr && Address + OldSize == Cursor && Address + NewSize <= End && IsAligned(Address, Alignment))
+		{
+			if (NewSize < OldSize)
+			{
+				FramePeakBytes = FMath::Max(FramePeakBytes, GetNumBytesInUse());
+			}
+			Cursor = Address + NewSize;
+#if OUU_FRAME_ARENA_POISONING
+			if (NewSize > OldSize)
+			{
+				FMemory::Memset(reinterpret_cast<void*>(Address + OldSize), AllocatedPoison, NewSize - OldSize);
+			}
+			else
+			{
+				FMemory::Memset(reinterpret_cast<void*>(Address + NewSize), FreedPoison, OldSize - NewSize);
+			}
+#endif
+			return Ptr;
+		}
+
+		void* Result = Allocate(NewSize, Alignment);
+		if (Ptr && NumBytesToCopy > 0)
+		{
+			FMemory::Memcpy(Result, Ptr, FMath::Min(NumBytesToCopy, NewSize));
+		}
+		return Result;
+	}
+
+	void FFrameArena::Reset()
+	{
+		checkf(NumOpenMarks == 0, TEXT("Frame arena must not be reset while %i marks are open"), NumOpenMarks);
+
+		const SIZE_T FrameBytes = FMath::Max(FramePeakBytes, GetNumBytesInUse());
+		LastFrameIndex = GlobalFrameIndex.load(std::memory_order_relaxed);
+		FramePeakBytes = 0;
+
+		if (CurrentBlockIndex != INDEX_NONE)
+		{
+			PoisonRange(0, reinterpret_cast<UPTRINT>(Blocks[0].Memory));
+
+			// The frame did not fit into the first block:
+			// Replace all blocks with a single one that fits the whole frame, so the next frames stay linear.
+			if (Blocks.Num() > 1)
+			{
+				const SIZE_T BlockSize = GetBlockSize();
+				const SIZE_T NewBlockSize =
+					FMath::Max(AlignArbitrary(FrameBytes + FrameBytes / 4, BlockSize), BlockSize);
+				FreeBlocks();
+				Blocks.Add(FBlock{static_cast<uint8*>(FMemory::Malloc(NewBlockSize, DefaultAlignment)), NewBlockSize});
+				ReservedBytes.store(NewBlockSize, std::memory_order_relaxed);
+				NumOverflowFrames.fetch_add(1, std::memory_order_relaxed);
+			}
+
+			ActivateBlock(0);
+			BytesInPreviousBlocks = 0;
+		}
+
+		LastFrameBytes.store(FrameBytes, std::memory_order_relaxed);
+		if (FrameBytes > HighWaterMarkBytes.load(std::memory_order_relaxed))
+		{
+			HighWaterMarkBytes.store(FrameBytes, std::memory_order_relaxed);
+		}
+	}
+
+	SIZE_T FFrameArena::GetNumBytesInUse() const
+	{
+		if (CurrentBlockIndex == INDEX_NONE)
+			return 0;
+
+		return BytesInPreviousBlocks + (Cursor - reinterpret_cast<UPTRINT>(Blocks[CurrentBlockIndex].Memory));
+	}
+
+	FFrameArenaStats FFrameArena::GetStats() const
+	{
+		FFrameArenaStats Stats;
+		Stats.ThreadId = ThreadId;
+		Stats.LastFrameBytes = LastFrameBytes.load(std::memory_order_relaxed);
+		Stats.HighWaterMarkBytes = HighWaterMarkBytes.load(std::memory_order_relaxed);
+		Stats.ReservedBytes = ReservedBytes.load(std::memory_order_relaxed);
+		Stats.NumOverflowFrames = NumOverflowFrames.load(std::memory_order_relaxed);
+		return Stats;
+	}
+
+	TArray<FFrameArenaStats> FFrameArena::GetAllThreadStats()
+	{
+		FArenaRegistry& Registry = GetRegistry();
+		FScopeLock Lock(&Registry.Lock);
+
+		TArray<FFrameArenaStats> Result;
+		Result.Reserve(Registry.Arenas.Num());
+		for (const FFrameArena* Arena : Registry.Arenas)
+		{
+			Result.Add(Arena->GetStats());
+		}
+		return Result;
+	}
+
+	void FFrameArena::EndFrame()
+	{
+		GlobalFrameIndex.fetch_add(1, std::memory_order_relaxed);
+		Get().ConditionalResetForNewFrame();
+	}
+
+	void FFrameArena::RegisterEndFrameDelegate()
+	{
+		OnEndFrameHandle = FCoreDelegates::OnEndFrame.AddStatic(&FFrameArena::EndFrame);
+	}
+
+	void FFrameArena::UnregisterEndFrameDelegate()
+	{
+		FCoreDelegates::OnEndFrame.Remove(OnEndFrameHandle);
+		OnEndFrameHandle.Reset();
+	}
+
+	void* FFrameArena::AllocateSlow(SIZE_T Size, uint32 Alignment)
+	{
+		if (CurrentBlockIndex != INDEX_NONE)
+		{
+			BytesInPreviousBlocks += Cursor - reinterpret_cast<UPTRINT>(Blocks[CurrentBlockIndex].Memory);
+		}
+
+		// Blocks after the current one are left over from earlier in the frame (before a mark was popped).
+		// Reuse the next one if it is big enough, otherwise insert a new block in front of it.
+		const SIZE_T RequiredSize = Size + Alignment;
+		const int32 NextBlockIndex = CurrentBlockIndex + 1;
+		if (!Blocks.IsValidIndex(NextBlockIndex) || Blocks[NextBlockIndex].Size < RequiredSize)
+		{
+			const SIZE_T NewBlockSize = FMath::Max(GetBlockSize(), RequiredSize);
+			Blocks.Insert(
+				FBlock{static_cast<uint8*>(FMemory::Malloc(NewBlockSize, DefaultAlignment)), NewBlockSize},
+				NextBlockIndex);
+			ReservedBytes.fetch_add(NewBlockSize, std::memory_order_relaxed);
+		}
+		ActivateBlock(NextBlockIndex);
+
+		const UPTRINT Result = Align(Cursor, static_cast<UPTRINT>(Alignment));
+		check(Result + Size <= End);
+		Cursor = Result + Size;
+#if OUU_FRAME_ARENA_POISONING
+		FMemory::Memset(reinterpret_cast<void*>(Result), AllocatedPoison, Size);
+#endif
+		return reinterpret_cast<void*>(Result);
+	}
+
+	void FFrameArena::ActivateBlock(int32 BlockIndex)
+	{
+		const FBlock& Block = Blocks[BlockIndex];
+		CurrentBlockIndex = BlockIndex;
+		Cursor = reinterpret_cast<UPTRINT>(Block.Memory);
+		End = Cursor + Block.Size;
+	}
+
+	void FFrameArena::FreeBlocks()
+	{
+		for (const FBlock& Block : Blocks)
+		{
+			FMemory::Free(Block.Memory);
+		}
+		Blocks.Reset();
+		CurrentBlockIndex = INDEX_NONE;
+		Cursor = 0;
+		End = 0;
+		BytesInPreviousBlocks = 0;
+		ReservedBytes.store(0, std::memory_order_relaxed);
+	}
+
+	void FFrameArena::PoisonRange(int32 FromBlockIndex, UPTRINT FromCursor) const
+	{
+#if OUU_FRAME_ARENA_POISONING
+		for (int32 BlockIndex = FromBlockIndex; BlockIndex <= CurrentBlockIndex; ++BlockIndex)
+		{
+			const FBlock& Block = Blocks[BlockIndex];
+			const UPTRINT BlockBegin = reinterpret_cast<UPTRINT>(Block.Memory);
+			const UPTRINT RangeBegin = BlockIndex == FromBlockIndex ? FromCursor : BlockBegin;
+			const UPTRINT RangeEnd = BlockIndex == CurrentBlockIndex ? Cursor : BlockBegin + Block.Size;
+			if (RangeEnd > RangeBegin)
+			{
+				FMemory::Memset(reinterpret_cast<void*>(RangeBegin), FreedPoison, RangeEnd - RangeBegin);
+			}
+		}
+#endif
+	}
+
+	FFrameArena::FMark FFrameArena::PushMark()
+	{
+		ConditionalResetForNewFrame();
+
+		FMark Mark;
+		Mark.BlockIndex = CurrentBlockIndex;
+		Mark.Cursor = Cursor;
+		Mark.BytesInPreviousBlocks = BytesInPreviousBlocks;
+		Mark.Depth = ++NumOpenMarks;
+		return Mark;
+	}
+
+	void FFrameArena::PopMark(const FMark& Mark)
+	{
+		checkf(
+			Mark.Depth == NumOpenMarks,
+			TEXT("Frame arena marks must be popped in reverse order (popped mark %i, but %i marks are open)"),
+			Mark.Depth,
+			NumOpenMarks);
+		--NumOpenMarks;
+
+		if (CurrentBlockIndex == INDEX_NONE)
+			return;
+
+		FramePeakBytes = FMath::Max(FramePeakBytes, GetNumBytesInUse());
+
+		// The mark was pushed before the first block was allocated
+		const int32 BlockIndex = Mark.BlockIndex == INDEX_NONE ? 0 : Mark.BlockIndex;
+		const UPTRINT MarkCursor =
+			Mark.BlockIndex == INDEX_NONE ? reinterpret_cast<UPTRINT>(Blocks[0].Memory) : Mark.Cursor;
+
+		PoisonRange(BlockIndex, MarkCursor);
+		ActivateBlock(BlockIndex);
+		Cursor = MarkCursor;
+		BytesInPreviousBlocks = Mark.BytesInPreviousBlocks;
+
+		// The outermost mark ends the "frame" of arenas that are not reset by the game thread's end of frame
+		if (!bIsGameThreadArena && NumOpenMarks == 0)
+		{
+			Reset();
+		}
+	}
+} // namespace OUU::Runtime
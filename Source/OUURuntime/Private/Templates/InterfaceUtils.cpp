@@ -0,0 +1,187 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "Templates/InterfaceUtils.h"
+
+#include "Templates/ReadMostlyVariable.h"
+#include "UObject/Class.h"
+#include "UObject/Interface.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+namespace OUU::Runtime::InterfaceUtils
+{
+	namespace
+	{
+		// Weak pointers can't be confused with new classes that are allocated at the address of an unloaded class
+		using FCacheKey = TPair<TWeakObjectPtr<const UClass>, TWeakObjectPtr<const UClass>>;
+		using FCacheShard = TMap<FCacheKey, FInterfaceImplementation>;
+
+		// Misses only copy and lock a single shard, so filling the cache doesn't serialize all threads on one mutex
+		constexpr int32 NumCacheShards = 32;
+
+		struct FCacheState
+		{
+			TRcuVariable<FCacheShard> Shards[NumCacheShards];
+
+			// Incremented on every invalidation. Lookups that started before an invalidation must not be cached,
+			// because they may have been computed from stale class data.
+			std::atomic<uint32> Generation{0};
+		};
+
+		FCacheState& GetCache()
+		{
+			static FCacheState Cache;
+			return Cache;
+		}
+
+		TRcuVariable<FCacheShard>& GetShard(const FCacheKey& Key)
+		{
+			return GetCache().Shards[GetTypeHash(Key) % NumCacheShards];
+		}
+
+		bool IsStale(const FCacheKey& Key) { return Key.Key.IsStale() || Key.Value.IsStale(); }
+
+		FDelegateHandle OnObjectsReinstancedHandle;
+		FDelegateHandle OnReloadCompleteHandle;
+		FDelegateHandle OnPostGarbageCollectHandle;
+	} // namespace
+
+	FInterfaceImplementation FInterfaceImplementationCache::Find(const UClass* Class, const UClass* InterfaceClass)
+	{
+		if (Class == nullptr || InterfaceClass == nullptr)
+			return {};
+
+		const FCacheKey Key{Class, InterfaceClass};
+		TRcuVariable<FCacheShard>& Shard = GetShard(Key);
+		const uint32 Generation = GetCache().Generation.load();
+		{
+			const auto ReadRef = Shard.Read();
+			if (const FInterfaceImplementation* CachedResult = ReadRef->Find(Key))
+				return *CachedResult;
+		}
+
+		const FInterfaceImplementation Result = FindUncached(Class, InterfaceClass);
+
+		auto WriteRef = Shard.Write();
+		if (GetCache().Generation.load() == Generation)
+		{
+			WriteRef->Add(Key, Result);
+		}
+		return Result;
+	}
+
+	FInterfaceImplementation FInterfaceImplementationCache::FindUncached(
+		const UClass* Class,
+		const UClass* InterfaceClass)
+	{
+		FInterfaceImplementation Result;
+		if (Class == nullptr || InterfaceClass == nullptr || !InterfaceClass->HasAnyClassFlags(CLASS_Interface)
+			|| InterfaceClass == UInterface::StaticClass())
+		{
+			return Result;
+		}
+
+		// Same logic as UObjectBaseUtility::GetInterfaceAddress(): Search the hierarchy from the most derived class
+		// and use the first native implementation.
+		const bool bIsNativeInterface = InterfaceClass->HasAnyClassFlags(CLASS_Native);
+		for (const UClass* CurrentClass = Class; CurrentClass; CurrentClass = CurrentClass->GetSuperClass())
+		{
+			for (const FImplementedInterface& ImplementedInterface : CurrentClass->Interfaces)
+			{
+				if (ImplementedInterface.Class == nullptr || !ImplementedInterface.Class->IsChildOf(InterfaceClass))
+					continue;
+
+				if (bIsNativeInterface && !ImplementedInterface.bImplementedByK2)
+				{
+					Result.Type = EInterfaceImplementation::Native;
+					Result.NativePointerOffset = ImplementedInterface.PointerOffset;
+					return Result;
+				}
+				else if (Result.Type == EInterfaceImplementation::None)
+				{
+					Result.Type = EInterfaceImplementation::Blueprint;
+				}
+			}
+		}
+		return Result;
+	}
+
+	void FInterfaceImplementationCache::Invalidate()
+	{
+		FCacheState& Cache = GetCache();
+		// Increment before clearing, so misses that are added concurrently are either cleared or not added at all
+		Cache.Generation++;
+		for (TRcuVariable<FCacheShard>& Shard : Cache.Shards)
+		{
+			Shard.Set({});
+		}
+	}
+
+	void FInterfaceImplementationCache::RemoveUnloadedClasses()
+	{
+		for (TRcuVariable<FCacheShard>& Shard : GetCache().Shards)
+		{
+			bool bHasStaleEntries = false;
+			{
+				const auto ReadRef = Shard.Read();
+				for (const auto& Entry : ReadRef.Get())
+				{
+					if (IsStale(Entry.Key))
+					{
+						bHasStaleEntries = true;
+						break;
+					}
+				}
+			}
+
+			// Only copy shards that actually contain unloaded classes
+			if (bHasStaleEntries)
+			{
+				auto WriteRef = Shard.Write();
+				for (auto It = WriteRef->CreateIterator(); It; ++It)
+				{
+					if (IsStale(It->Key))
+					{
+						It.RemoveCurrent();
+					}
+				}
+			}
+		}
+	}
+
+	int32 FInterfaceImplementationCache::GetNumCachedEntries()
+	{
+		int32 Result = 0;
+		for (const TRcuVariable<FCacheShard>& Shard : GetCache().Shards)
+		{
+			Result += Shard.Read()->Num();
+		}
+		return Result;
+	}
+
+	void FInterfaceImplementationCache::RegisterInvalidationDelegates()
+	{
+#if WITH_EDITOR
+		OnObjectsReinstancedHandle = FCoreUObjectDelegates::OnObjectsReinstanced.AddLambda(
+			[](const TMap<UObject*, UObject*>&) { Invalidate(); });
+#endif
+		OnReloadCompleteHandle =
+			FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason) { Invalidate(); });
+		OnPostGarbageCollectHandle =
+			FCoreUObjectDelegates::GetPostGarbageCollect().AddLambda([]() { RemoveUnloadedClasses(); });
+	}
+
+	void FInterfaceImplementationCache::UnregisterInvalidationDelegates()
+	{
+#if WITH_EDITOR
+		FCoreUObjectDelegates::OnObjectsReinstanced.Remove(OnObjectsReinstancedHandle);
+#endif
+		FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(OnReloadCompleteHandle);
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(OnPostGarbageCollectHandle);
+		OnObjectsReinstancedHandle.Reset();
+		OnReloadCompleteHandle.Reset();
+		OnPostGarbageCollectHandle.Reset();
+
+		Invalidate();
+	}
+} // namespace OUU::Runtime::InterfaceUtils
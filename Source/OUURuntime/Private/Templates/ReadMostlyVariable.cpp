@@ -0,0 +1,148 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "Templates/ReadMostlyVariable.h"
+
+namespace OUU::Runtime::Private::ReadMostly
+{
+	namespace
+	{
+		// Upper limit of threads that can be inside a read section at the same time without falling back to the
+		// shared overflow counter.
+		constexpr int32 MaxReaderSlots = 256;
+
+		// Epoch value of slots that are not inside a read section
+		constexpr uint64 QuiescentEpoch = 0;
+
+		struct alignas(PLATFORM_CACHE_LINE_SIZE) FReaderSlot
+		{
+			std::atomic<uint64> ActiveEpoch{QuiescentEpoch};
+			std::atomic<bool> bInUse{false};
+		};
+
+		struct FEpochState
+		{
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> GlobalEpoch{1};
+
+			// Number of readers that could not get a slot. While this is non-zero, nothing can be reclaimed.
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> NumOverflowReaders{0};
+
+			// Highest slot index that was ever handed out + 1. Limits the range writers have to scan.
+			alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<int32> NumUsedSlots{0};
+
+			FReaderSlot Slots[MaxReaderSlots];
+		};
+
+		FEpochState& GetEpochState()
+		{
+			// Intentionally leaked, so threads that exit during static destruction can still release their slot.
+			static FEpochState* State = new FEpochState();
+			return *State;
+		}
+
+		/** Per-thread reader state. Acquires a slot lazily and releases it when the thread exits. */
+		struct FThreadReaderState
+		{
+			static constexpr int32 SlotNotAcquired = INDEX_NONE;
+			static constexpr int32 OverflowSlot = -2;
+
+			int32 SlotIndex = SlotNotAcquired;
+			int32 Depth = 0;
+
+			~FThreadReaderState()
+			{
+				if (SlotIndex >= 0)
+				{
+					FReaderSlot& Slot = GetEpochState().Slots[SlotIndex];
+					Slot.ActiveEpoch.store(QuiescentEpoch, std::memory_order_release);
+					Slot.bInUse.store(false, std::memory_order_release);
+				}
+			}
+
+			void AcquireSlot()
+			{
+				FEpochState& State = GetEpochState();
+				for (int32 Idx = 0; Idx < MaxReaderSlots; Idx++)
+				{
+					bool bExpected = false;
+					if (State.Slots[Idx].bInUse.load(std::memory_order_relaxed) == false
+						&& State.Slots[Idx].bInUse.compare_exchange_strong(bExpected, true))
+					{
+						SlotIndex = Idx;
+						int32 NumUsed = State.NumUsedSlots.load();
+						while (NumUsed < Idx + 1 && !State.NumUsedSlots.compare_exchange_weak(NumUsed, Idx + 1)) {}
+						return;
+					}
+				}
+				SlotIndex = OverflowSlot;
+			}
+		};
+
+		thread_local FThreadReaderState ThreadReaderState;
+	} // namespace
+
+	void FEpochManager::EnterRead()
+	{
+		FThreadReaderState& ThreadState = ThreadReaderState;
+		if (ThreadState.Depth++ > 0)
+			return;
+
+		if (ThreadState.SlotIndex == FThreadReaderState::SlotNotAcquired)
+		{
+			ThreadState.AcquireSlot();
+		}
+
+		FEpochState& State = GetEpochState();
+		if (ThreadState.SlotIndex >= 0)
+		{
+			// seq_cst store so it's ordered before the subsequent seq_cst load of the variable pointer.
+			// The slot is only ever written by this thread and doesn't share a cache line with other slots.
+			State.Slots[ThreadState.SlotIndex].ActiveEpoch.store(
+				State.GlobalEpoch.load(std::memory_order_seq_cst),
+				std::memory_order_seq_cst);
+		}
+		else
+		{
+			State.NumOverflowReaders.fetch_add(1, std::memory_order_seq_cst);
+		}
+	}
+
+	void FEpochManager::ExitRead()
+	{
+		FThreadReaderState& ThreadState = ThreadReaderState;
+		checkf(ThreadState.Depth > 0, TEXT("ExitRead() called without matching EnterRead()"));
+		if (--ThreadState.Depth > 0)
+			return;
+
+		FEpochState& State = GetEpochState();
+		if (ThreadState.SlotIndex >= 0)
+		{
+			State.Slots[ThreadState.SlotIndex].ActiveEpoch.store(QuiescentEpoch, std::memory_order_release);
+		}
+		else
+		{
+			State.NumOverflowReaders.fetch_sub(1, std::memory_order_release);
+		}
+	}
+
+	uint64 FEpochManager::AdvanceEpoch()
+	{
+		return GetEpochState().GlobalEpoch.fetch_add(1, std::memory_order_seq_cst) + 1;
+	}
+
+	bool FEpochManager::CanReclaim(uint64 RetireEpoch)
+	{
+		const FEpochState& State = GetEpochState();
+		if (State.NumOverflowReaders.load(std::memory_order_seq_cst) > 0)
+			return false;
+
+		const int32 NumUsedSlots = State.NumUsedSlots.load(std::memory_order_acquire);
+		for (int32 Idx = 0; Idx < NumUsedSlots; Idx++)
+		{
+			// Readers that entered at RetireEpoch or later can only have seen the new value.
+			const uint64 ActiveEpoch = State.Slots[Idx].ActiveEpoch.load(std::memory_order_seq_cst);
+			if (ActiveEpoch != QuiescentEpoch && ActiveEpoch < RetireEpoch)
+				return false;
+		}
+		return true;
+	}
+} // namespace OUU::Runtime::Private::ReadMostly
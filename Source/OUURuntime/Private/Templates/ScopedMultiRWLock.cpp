@@ -0,0 +1,61 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "Templates/ScopedMultiRWLock.h"
+
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+
+namespace OUU::Runtime::Private::ScopedMultiRWLock
+{
+	namespace
+	{
+		// Locks held by multi-locks on this thread. Usually only very few multi-locks are nested.
+		thread_local TArray<const FRWLock*, TInlineAllocator<16>> HeldLocks;
+	} // namespace
+
+	void FLockOrderValidation::ValidateBeforeLock(TArrayView<const FLockEntry> SortedLocks, bool bIsBlocking)
+	{
+		for (int32 Idx = 1; Idx < SortedLocks.Num(); Idx++)
+		{
+			checkf(
+				SortedLocks[Idx - 1].Lock != SortedLocks[Idx].Lock,
+				TEXT("The same TRWLockedVariable was passed to a TScopedMultiRWLock multiple times. This would "
+					 "deadlock."));
+		}
+
+		for (const FRWLock* HeldLock : HeldLocks)
+		{
+			for (const FLockEntry& Entry : SortedLocks)
+			{
+				checkf(
+					HeldLock != Entry.Lock,
+					TEXT("TScopedMultiRWLock tries to acquire a lock that is already held by another TScopedMultiRWLock "
+						 "on the same thread. This would deadlock."));
+			}
+
+			ensureMsgf(
+				!bIsBlocking || HeldLock < SortedLocks[0].Lock,
+				TEXT("Lock order violation: TScopedMultiRWLock acquires a lock with a lower address than a lock "
+					 "already held by an outer TScopedMultiRWLock on the same thread. This may deadlock if another "
+					 "thread acquires the same locks in opposite order. Combine both multi-locks into one or use "
+					 "TryMakeScopedMultiRWLock instead."));
+		}
+	}
+
+	void FLockOrderValidation::OnLocked(TArrayView<const FLockEntry> SortedLocks)
+	{
+		for (const FLockEntry& Entry : SortedLocks)
+		{
+			HeldLocks.Add(Entry.Lock);
+		}
+	}
+
+	void FLockOrderValidation::OnUnlocked(TArrayView<const FLockEntry> SortedLocks)
+	{
+		for (const FLockEntry& Entry : SortedLocks)
+		{
+			HeldLocks.RemoveSingleSwap(Entry.Lock, EAllowShrinking::No);
+		}
+	}
+} // namespace OUU::Runtime::Private::ScopedMultiRWLock
+
+#endif
@@ -0,0 +1,283 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "Templates/StructSerializationHelpers.h"
+
+#include "LogOpenUnrealUtilities.h"
+#include "Misc/StringBuilder.h"
+#include "Serialization/StructuredArchive.h"
+#include "UObject/Class.h"
+#include "UObject/UnrealType.h"
+
+namespace OUU::Runtime::Private::StructSerialization
+{
+	namespace
+	{
+		using FPropertyList = TArray<const FProperty*, TInlineAllocator<64>>;
+		using FChangedMask = TBitArray<TInlineAllocator<2>>;
+
+		void GatherSerializedProperties(const UScriptStruct& Struct, FArchive& Ar, FPropertyList& OutProperties)
+		{
+			for (const FProperty* Property = Struct.PropertyLink; Property; Property = Property->PropertyLinkNext)
+			{
+				if (Property->ShouldSerializeValue(Ar))
+				{
+					OutProperties.Add(Property);
+				}
+			}
+		}
+
+		bool IsPlainOldData(const UScriptStruct& Struct, bool bAllowPodFastPath)
+		{
+			return bAllowPodFastPath && (Struct.StructFlags & STRUCT_IsPlainOldData) != 0;
+		}
+
+		// Only values whose bytes mean the same in another process can be copied as raw bytes.
+		// This excludes object / interface pointers and names even in POD structs. Bitfield bools share their memory
+		// with other properties.
+		bool IsRawBytesSafe(const FProperty& Property)
+		{
+			if (Property.IsA<FNumericProperty>() || Property.IsA<FEnumProperty>())
+				return true;
+
+			if (const FBoolProperty* BoolProperty = CastField<FBoolProperty>(&Property))
+				return BoolProperty->IsNativeBool();
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(&Property))
+			{
+				const UScriptStruct& NestedStruct = *StructProperty->Struct;
+				if ((NestedStruct.StructFlags & STRUCT_IsPlainOldData) == 0)
+					return false;
+
+				for (const FProperty* Nested = NestedStruct.PropertyLink; Nested; Nested = Nested->PropertyLinkNext)
+				{
+					if (!IsRawBytesSafe(*Nested))
+						return false;
+				}
+				return true;
+			}
+
+			return false;
+		}
+
+		bool CanUseRawBytes(const FProperty& Property, bool bIsPlainOldData)
+		{
+			return bIsPlainOldData && IsRawBytesSafe(Property);
+		}
+
+		void AppendToSchemaHash(uint32& SchemaHash, FName Name)
+		{
+			TStringBuilder<128> Builder;
+			Name.AppendString(Builder);
+			SchemaHash = FCrc::StrCrc32(*Builder, SchemaHash);
+		}
+
+		/**
+		 * Hash of the property names and types. Uses the name strings instead of FName hashes, so the hash is
+		 * stable between processes. Raw byte properties also hash their size, as the bytes are read without
+		 * any conversion.
+		 */
+		uint32 CalculateSchemaHash(const FPropertyList& Properties, bool bIsPlainOldData)
+		{
+			uint32 SchemaHash = 0;
+			for (const FProperty* Property : Properties)
+			{
+				AppendToSchemaHash(SchemaHash, Property->GetFName());
+				AppendToSchemaHash(SchemaHash, Property->GetClass()->GetFName());
+				if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+				{
+					AppendToSchemaHash(SchemaHash, StructProperty->Struct->GetFName());
+				}
+
+				const int32 Size = CanUseRawBytes(*Property, bIsPlainOldData) ? Property->GetSize() : 0;
+				SchemaHash = FCrc::TypeCrc32(Property->ArrayDim, SchemaHash);
+				SchemaHash = FCrc::TypeCrc32(Size, SchemaHash);
+			}
+			return SchemaHash;
+		}
+
+		// Nested structs with custom serializers must be serialized as a whole.
+		const UScriptStruct* GetNestedDeltaStruct(const FProperty& Property)
+		{
+			const FStructProperty* StructProperty = CastField<FStructProperty>(&Property);
+			if (StructProperty == nullptr || StructProperty->ArrayDim != 1)
+				return nullptr;
+
+			const UScriptStruct* NestedStruct = StructProperty->Struct;
+			return (NestedStruct->StructFlags & STRUCT_SerializeNative) == 0 ? NestedStruct : nullptr;
+		}
+
+		bool IsIdentical(const FProperty& Property, const uint8* Data, const uint8* Baseline, bool bRawBytes)
+		{
+			if (bRawBytes)
+			{
+				return FMemory::Memcmp(
+						   Property.ContainerPtrToValuePtr<void>(Data),
+						   Property.ContainerPtrToValuePtr<void>(Baseline),
+						   Property.GetSize())
+					== 0;
+			}
+
+			for (int32 ArrayIdx = 0; ArrayIdx < Property.ArrayDim; ArrayIdx++)
+			{
+				if (!Property.Identical_InContainer(Data, Baseline, ArrayIdx, PPF_None))
+					return false;
+			}
+			return true;
+		}
+
+		void SerializeChangedMask(FArchive& Ar, FChangedMask& ChangedMask)
+		{
+			const int32 NumBytes = FMath::DivideAndRoundUp(ChangedMask.Num(), 8);
+			for (int32 ByteIdx = 0; ByteIdx < NumBytes; ByteIdx++)
+			{
+				uint8 Byte = 0;
+				const int32 FirstBit = ByteIdx * 8;
+				const int32 NumBits = FMath::Min(8, ChangedMask.Num() - FirstBit);
+				if (Ar.IsSaving())
+				{
+					for (int32 BitIdx = 0; BitIdx < NumBits; BitIdx++)
+					{
+						Byte |= ChangedMask[FirstBit + BitIdx] ? (1 << BitIdx) : 0;
+					}
+				}
+
+				Ar << Byte;
+
+				if (Ar.IsLoading())
+				{
+					for (int32 BitIdx = 0; BitIdx < NumBits; BitIdx++)
+					{
+						ChangedMask[FirstBit + BitIdx] = (Byte & (1 << BitIdx)) != 0;
+					}
+				}
+			}
+		}
+
+		/**
+		 * Save or load the delta of one struct level.
+		 * When loading, Data must already contain the baseline values.
+		 */
+		void SerializeDelta(
+			const UScriptStruct& Struct,
+			FArchive& Ar,
+			FStructuredArchive::FStream& Stream,
+			uint8* Data,
+			const uint8* Baseline,
+			bool bAllowPodFastPath)
+		{
+			FPropertyList Properties;
+			GatherSerializedProperties(Struct, Ar, Properties);
+
+			// Data written for another version of the struct can't be interpreted without the matching property list.
+			// The property count is checked first to give a more helpful error message.
+			uint32 NumProperties = Properties.Num();
+			Ar.SerializeIntPacked(NumProperties);
+			if (NumProperties != static_cast<uint32>(Properties.Num()))
+			{
+				UE_LOG(
+					LogOpenUnrealUtilities,
+					Error,
+					TEXT("Struct delta for %s was written with %i properties, but the struct has %i serialized "
+						 "properties"),
+					*Struct.GetName(),
+					static_cast<int32>(NumProperties),
+					Properties.Num());
+				Ar.SetError();
+				return;
+			}
+
+			const bool bIsPlainOldData = IsPlainOldData(Struct, bAllowPodFastPath);
+
+			const uint32 ExpectedSchemaHash = CalculateSchemaHash(Properties, bIsPlainOldData);
+			uint32 SchemaHash = ExpectedSchemaHash;
+			Ar << SchemaHash;
+			if (SchemaHash != ExpectedSchemaHash)
+			{
+				UE_LOG(
+					LogOpenUnrealUtilities,
+					Error,
+					TEXT("Struct delta for %s was written for different property names or types"),
+					*Struct.GetName());
+				Ar.SetError();
+				return;
+			}
+
+			FChangedMask ChangedMask(false, Properties.Num());
+			if (Ar.IsSaving())
+			{
+				for (int32 PropertyIdx = 0; PropertyIdx < Properties.Num(); PropertyIdx++)
+				{
+					const FProperty& Property = *Properties[PropertyIdx];
+					const bool bRawBytes = CanUseRawBytes(Property, bIsPlainOldData);
+					ChangedMask[PropertyIdx] = !IsIdentical(Property, Data, Baseline, bRawBytes);
+				}
+			}
+			SerializeChangedMask(Ar, ChangedMask);
+
+			for (TConstSetBitIterator<TInlineAllocator<2>> It(ChangedMask); It && !Ar.IsError(); ++It)
+			{
+				const FProperty& Property = *Properties[It.GetIndex()];
+				if (CanUseRawBytes(Property, bIsPlainOldData))
+				{
+					Ar.Serialize(Property.ContainerPtrToValuePtr<void>(Data), Property.GetSize());
+				}
+				else if (const UScriptStruct* NestedStruct = GetNestedDeltaStruct(Property))
+				{
+					SerializeDelta(
+						*NestedStruct,
+						Ar,
+						Stream,
+						Property.ContainerPtrToValuePtr<uint8>(Data),
+						Baseline ? Property.ContainerPtrToValuePtr<uint8>(Baseline) : nullptr,
+						bAllowPodFastPath);
+				}
+				else
+				{
+					for (int32 ArrayIdx = 0; ArrayIdx < Property.ArrayDim; ArrayIdx++)
+					{
+						Property.SerializeItem(
+							Stream.EnterElement(),
+							Property.ContainerPtrToValuePtr<void>(Data, ArrayIdx));
+					}
+				}
+			}
+		}
+	} // namespace
+} // namespace OUU::Runtime::Private::StructSerialization
+
+namespace OUU::Runtime
+{
+	bool SerializeStructDelta(
+		const UScriptStruct* Struct,
+		FArchive& Ar,
+		void* Data,
+		const void* Baseline,
+		bool bAllowPodFastPath)
+	{
+		check(Struct && Data && Baseline);
+
+		if (!ensureMsgf(!Ar.IsTextFormat(), TEXT("Struct delta serialization only supports binary archives")))
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		if (Ar.IsLoading() && Data != Baseline)
+		{
+			Struct->CopyScriptStruct(Data, Baseline);
+		}
+
+		FStructuredArchiveFromArchive StructuredArchive(Ar);
+		FStructuredArchive::FStream Stream = StructuredArchive.GetSlot().EnterStream();
+		Private::StructSerialization::SerializeDelta(
+			*Struct,
+			Ar,
+			Stream,
+			static_cast<uint8*>(Data),
+			// Loading doesn't need the baseline anymore: Data already contains its values.
+			Ar.IsSaving() ? static_cast<const uint8*>(Baseline) : nullptr,
+			bAllowPodFastPath);
+
+		return !Ar.IsError();
+	}
+} // namespace OUU::Runtime
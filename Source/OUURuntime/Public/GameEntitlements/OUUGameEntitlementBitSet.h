@@ -0,0 +1,94 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Dense set of entitlements, indexed by the entitlement indices of UOUUGameEntitlementsSubsystem.
+ * Used for the active entitlements and for precompiled requirement masks, so checking a single entitlement is a bit
+ * test and checking multiple entitlements at once is a word-wise AND.
+ */
+struct FOUUGameEntitlementBitSet
+{
+public:
+	FOUUGameEntitlementBitSet() = default;
+
+	/** Remove all entitlements and reserve space for the given number of entitlement indices */
+	void Reset(int32 NumIndices = 0)
+	{
+		Words.Reset();
+		Words.SetNumZeroed(FMath::DivideAndRoundUp(NumIndices, NumBitsPerWord));
+	}
+
+	void Add(int32 Index)
+	{
+		check(Index >= 0);
+		const int32 WordIndex = Index / NumBitsPerWord;
+		if (WordIndex >= Words.Num())
+		{
+			Words.SetNumZeroed(WordIndex + 1);
+		}
+		Words[WordIndex] |= GetBitMask(Index);
+	}
+
+	/** @returns if the entitlement is in the set. Negative indices are never in the set. */
+	FORCEINLINE bool Contains(int32 Index) const
+	{
+		const int32 WordIndex = Index / NumBitsPerWord;
+		return Index >= 0 && WordIndex < Words.Num() && (Words[WordIndex] & GetBitMask(Index)) != 0;
+	}
+
+	/** @returns if all entitlements of the other set are also in this set. True if the other set is empty. */
+	bool ContainsAll(const FOUUGameEntitlementBitSet& Other) const
+	{
+		for (int32 WordIndex = 0; WordIndex < Other.Words.Num(); WordIndex++)
+		{
+			const uint64 ThisWord = WordIndex < Words.Num() ? Words[WordIndex] : 0;
+			if ((Other.Words[WordIndex] & ~ThisWord) != 0)
+				return false;
+		}
+		return true;
+	}
+
+	/** @returns if any entitlement of the other set is also in this set */
+	bool ContainsAny(const FOUUGameEntitlementBitSet& Other) const
+	{
+		const int32 NumCommonWords = FMath::Min(Words.Num(), Other.Words.Num());
+		for (int32 WordIndex = 0; WordIndex < NumCommonWords; WordIndex++)
+		{
+			if ((Words[WordIndex] & Other.Words[WordIndex]) != 0)
+				return true;
+		}
+		return false;
+	}
+
+	/** @returns the number of entitlements in the set */
+	int32 Num() const
+	{
+		int32 Result = 0;
+		for (const uint64 Word : Words)
+		{
+			Result += FMath::CountBits(Word);
+		}
+		return Result;
+	}
+
+	bool IsEmpty() const
+	{
+		for (const uint64 Word : Words)
+		{
+			if (Word != 0)
+				return false;
+		}
+		return true;
+	}
+
+private:
+	static constexpr int32 NumBitsPerWord = 64;
+
+	// Most projects have less than 256 modules and collections
+	TArray<uint64, TInlineAllocator<4>> Words;
+
+	static FORCEINLINE uint64 GetBitMask(int32 Index) { return uint64(1) << (Index % NumBitsPerWord); }
+};
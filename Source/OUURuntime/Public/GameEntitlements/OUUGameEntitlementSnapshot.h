@@ -0,0 +1,132 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GameEntitlements/OUUGameEntitlementBitSet.h"
+#include "GameEntitlements/OUUGameEntitlementsTags.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/SoftObjectPath.h"
+
+class FOUUGameEntitlementSnapshot;
+struct FOUUGameEntitlementContentRule;
+
+using FOUUGameEntitlementSnapshotRef = TSharedRef<const FOUUGameEntitlementSnapshot, ESPMode::ThreadSafe>;
+
+/**
+ * Immutable copy of the active entitlements that is published by UOUUGameEntitlementsSubsystem whenever the active
+ * entitlements are refreshed. Use GetCurrent() to access the most recently published snapshot.
+ * Snapshots can be used from any thread (e.g. async loading code) and stay valid as long as they are referenced,
+ * even if newer snapshots are published in the meantime.
+ *
+ * Content rules from UOUUGameEntitlementSettings are evaluated once when the snapshot is created, so filtering content
+ * only has to check the paths and types that are blocked by inactive modules.
+ */
+class OUURUNTIME_API FOUUGameEntitlementSnapshot
+{
+public:
+	/** Uninitialized snapshot without any entitlements that doesn't block any content */
+	FOUUGameEntitlementSnapshot() = default;
+
+	/**
+	 * Create an initialized snapshot and evaluate the content rules against the active entitlements.
+	 * Called by UOUUGameEntitlementsSubsystem. The state is copied, so the snapshot is independent of the subsystem.
+	 * @param	ActiveEntitlementBits	Active entitlements including parents, indexed by EntitlementIndices
+	 */
+	static FOUUGameEntitlementSnapshotRef Create(
+		uint32 SerialNumber,
+		const FOUUGameEntitlementVersion& ActiveVersion,
+		const FGameplayTagContainer& ActiveEntitlements,
+		const FOUUGameEntitlementBitSet& ActiveEntitlementBits,
+		const TMap<FGameplayTag, int32>& EntitlementIndices,
+		TConstArrayView<FOUUGameEntitlementContentRule> ContentRules);
+
+	/**
+	 * Get the most recently published snapshot.
+	 * Safe to call from any thread and never blocks, so async loading code can filter content without synchronizing
+	 * with the game thread. Does not depend on the engine or the subsystem and returns an uninitialized snapshot
+	 * until the first snapshot was published.
+	 * Hold on to the snapshot for the duration of a load request to get consistent results.
+	 */
+	static FOUUGameEntitlementSnapshotRef GetCurrent();
+
+	/** @returns if the snapshot was created after the subsystem initialized the active entitlements */
+	bool IsInitialized() const { return bIsInitialized; }
+
+	/** Incremented for every published snapshot. Can be used to invalidate caches of filtered content. */
+	uint32 GetSerialNumber() const { return SerialNumber; }
+
+	FOUUGameEntitlementVersion GetActiveVersion() const { return ActiveVersion; }
+	const FGameplayTagContainer& GetActiveEntitlements() const { return ActiveEntitlements; }
+
+	/**
+	 * Check a module or collection tag. Hierarchical like FGameplayTagContainer::HasTag.
+	 * Invalid tags are treated as "no requirements" like in UOUUGameEntitlementsSubsystem::IsEntitled().
+	 */
+	bool IsEntitled(const FGameplayTag& ModuleOrCollection) const;
+
+	/** Check a mask created with MakeEntitlementMask() of this snapshot or of a snapshot with the same indices. */
+	bool IsEntitled(const FOUUGameEntitlementBitSet& RequiredEntitlements) const;
+
+	/**
+	 * Precompile a set of required modules for repeated checks with IsEntitled(RequiredEntitlements).
+	 * Safe to call from any thread, because it only uses the indices copied into the snapshot.
+	 * Tags that are not modules or collections make the mask unsatisfiable.
+	 */
+	FOUUGameEntitlementBitSet MakeEntitlementMask(const FOUUGameEntitlementModules_Ref& Modules) const;
+	FOUUGameEntitlementBitSet MakeEntitlementMask(const FGameplayTagContainer& ModulesAndCollections) const;
+
+	/** @returns if no content rule with inactive required modules matches the package of the path */
+	bool IsEntitledToContent(const FSoftObjectPath& Path) const;
+
+	/** @returns if no content rule with inactive required modules matches the primary asset type */
+	bool IsEntitledToContent(const FPrimaryAssetId& AssetId) const;
+
+	template <typename SoftPtrType>
+	bool IsEntitledToContent(const SoftPtrType& SoftPtr) const
+	{
+		return IsEntitledToContent(SoftPtr.ToSoftObjectPath());
+	}
+
+	/**
+	 * Remove all content that is blocked by inactive modules, e.g. before requesting async loads.
+	 * Also works for arrays of TSoftObjectPtr and TSoftClassPtr.
+	 * @returns the number of removed elements
+	 */
+	int32 RemoveUnentitledContent(TArray<FSoftObjectPath>& Paths) const;
+	int32 RemoveUnentitledContent(TArray<FPrimaryAssetId>& AssetIds) const;
+
+	template <typename SoftPtrType>
+	int32 RemoveUnentitledContent(TArray<SoftPtrType>& SoftPtrs) const
+	{
+		if (BlockedContentDirectories.Num() == 0)
+			return 0;
+
+		return SoftPtrs.RemoveAll(
+			[this](const SoftPtrType& SoftPtr) { return IsEntitledToContent(SoftPtr.ToSoftObjectPath()) == false; });
+	}
+
+	/** @returns if any content rule blocks content in this snapshot */
+	bool HasBlockedContent() const { return BlockedContentDirectories.Num() > 0 || BlockedPrimaryAssetTypes.Num() > 0; }
+
+private:
+	friend class UOUUGameEntitlementsSubsystem;
+
+	/** Replace the snapshot returned by GetCurrent(). Only called by the subsystem registered with the engine. */
+	static void Publish(const FOUUGameEntitlementSnapshotRef& Snapshot);
+
+	bool bIsInitialized = false;
+	uint32 SerialNumber = 0;
+
+	FOUUGameEntitlementVersion ActiveVersion;
+	FGameplayTagContainer ActiveEntitlements;
+
+	// Copies of the subsystem's state at the time the snapshot was created. Tags without index are never active.
+	FOUUGameEntitlementBitSet ActiveEntitlementBits;
+	TMap<FGameplayTag, int32> EntitlementIndices;
+
+	// Long package names of content directories without trailing slash
+	TArray<FString> BlockedContentDirectories;
+	TArray<FPrimaryAssetType> BlockedPrimaryAssetTypes;
+};
@@ -3,12 +3,20 @@
 #pragma once
 
 #include "Engine/DeveloperSettings.h"
+#include "GameEntitlements/OUUGameEntitlementBitSet.h"
+#include "GameEntitlements/OUUGameEntitlementSnapshot.h"
 #include "GameEntitlements/OUUGameEntitlementsTags.h"
 #include "Subsystems/EngineSubsystem.h"
 
 #include "OUUGameEntitlements.generated.h"
 
-/** Central subsystem to track entitlements */
+class UOUUGameEntitlementSettings;
+
+/**
+ * Central subsystem to track entitlements.
+ * Publishes a FOUUGameEntitlementSnapshot whenever the active entitlements change. Use
+ * FOUUGameEntitlementSnapshot::GetCurrent() to check entitlements outside of the game thread.
+ */
 UCLASS(BlueprintType)
 class OUURUNTIME_API UOUUGameEntitlementsSubsystem : public UEngineSubsystem
 {
@@ -20,10 +28,36 @@ public:
 public:
 	static UOUUGameEntitlementsSubsystem& Get();
 
+	/** Index that is never in the active entitlements. Used for tags that are not modules or collections. */
+	static constexpr int32 UnknownEntitlementIndex = 0;
+
 	UFUNCTION(BlueprintPure)
 	bool IsEntitled(const FOUUGameEntitlementModule& Module) const;
 	bool IsEntitled(const FOUUGameEntitlementModules_Ref& Modules) const;
 
+	/** Check a mask created with MakeEntitlementMask(). This is a word-wise AND of the mask and active entitlements. */
+	bool IsEntitled(const FOUUGameEntitlementBitSet& RequiredEntitlements) const;
+
+	/** Check an index returned from GetEntitlementIndex(). This is a single bit test. */
+	bool IsEntitledToIndex(int32 EntitlementIndex) const;
+
+	/**
+	 * Dense index of a module or collection tag for IsEntitledToIndex().
+	 * Indices are stable as long as no entitlement tags are added or removed, so they should be updated in
+	 * OnActiveEntitlementsChanged if the tags may change at runtime (e.g. in the editor).
+	 * @returns UnknownEntitlementIndex if the tag is not a module or collection tag
+	 */
+	int32 GetEntitlementIndex(const FGameplayTag& Tag) const;
+
+	/**
+	 * Precompile a set of required modules for repeated checks with IsEntitled(RequiredEntitlements).
+	 * The same stability rules as for GetEntitlementIndex() apply.
+	 */
+	FOUUGameEntitlementBitSet MakeEntitlementMask(const FOUUGameEntitlementModules_Ref& Modules) const;
+
+	/** Same as above for any tags. Tags that are not modules or collections make the mask unsatisfiable. */
+	FOUUGameEntitlementBitSet MakeEntitlementMask(const FGameplayTagContainer& ModulesAndCollections) const;
+
 	bool HasInitializedActiveEntitlements() const;
 	FOUUGameEntitlementModules_Value GetActiveEntitlements() const;
 
@@ -36,6 +70,17 @@ public:
 	// Restrict Blueprint access for now.
 	void SetOverrideVersion(const FOUUGameEntitlementVersion& Version);
 
+#if WITH_DEV_AUTOMATION_TESTS
+	/**
+	 * Activate a version with explicit settings instead of the project settings, ignoring override versions.
+	 * Only intended for automated tests of subsystem instances that are not registered with the engine.
+	 * @returns the snapshot of the activated version. Snapshots of unregistered instances are never published.
+	 */
+	FOUUGameEntitlementSnapshotRef ActivateVersion_ForTesting(
+		const FOUUGameEntitlementVersion& Version,
+		const UOUUGameEntitlementSettings& Settings);
+#endif
+
 	// - USubsystem
 	void Initialize(FSubsystemCollectionBase& Collection) override;
 
@@ -53,6 +98,14 @@ private:
 #endif
 	void RefreshActiveVersionAndEntitlements();
 
+	/** Compute the active entitlements of ActiveVersion from the settings and notify listeners */
+	void RebuildActiveEntitlements(const UOUUGameEntitlementSettings& Settings);
+	void RebuildEntitlementIndices();
+	void PublishSnapshot(const UOUUGameEntitlementSettings& Settings);
+
+	/** Add the entitlement and its parent tags, so hierarchical checks behave like FGameplayTagContainer::HasTag */
+	void AddEntitlementWithParents(FOUUGameEntitlementBitSet& BitSet, int32 EntitlementIndex) const;
+
 	bool bHasInitializedActiveEntitlements = false;
 
 	UPROPERTY(EditAnywhere)
@@ -60,4 +113,15 @@ private:
 
 	FOUUGameEntitlementVersion ActiveVersion;
 	FOUUGameEntitlementModuleAndCollections_Value ActiveEntitlements;
+
+	// Closure of ActiveEntitlements including parent tags
+	FOUUGameEntitlementBitSet ActiveEntitlementBits;
+
+	// Dense indices of all module and collection tags. Index 0 is reserved for UnknownEntitlementIndex.
+	TMap<FGameplayTag, int32> EntitlementIndices;
+	TArray<int32> ParentEntitlementIndices;
+
+	// Only the instance registered with the engine publishes its snapshots to FOUUGameEntitlementSnapshot::GetCurrent()
+	bool bPublishesSnapshots = false;
+	FOUUGameEntitlementSnapshotRef LatestSnapshot = MakeShared<FOUUGameEntitlementSnapshot, ESPMode::ThreadSafe>();
 };
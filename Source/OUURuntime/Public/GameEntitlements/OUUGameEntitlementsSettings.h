@@ -3,7 +3,9 @@
 #pragma once
 
 #include "Engine/DeveloperSettings.h"
+#include "Engine/EngineTypes.h"
 #include "GameEntitlements/OUUGameEntitlementsTags.h"
+#include "UObject/PrimaryAssetId.h"
 
 #include "OUUGameEntitlementsSettings.generated.h"
 
@@ -11,6 +13,24 @@
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnOUUGameEntitlementSettingsChanged, FPropertyChangedChainEvent&);
 #endif
 
+/** Content that is only available if all required modules are active */
+USTRUCT(BlueprintType)
+struct OUURUNTIME_API FOUUGameEntitlementContentRule
+{
+	GENERATED_BODY()
+public:
+	// All assets in this directory and its sub-directories require the modules. Ignored if empty.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (ContentDir, LongPackageName))
+	FDirectoryPath ContentDirectory;
+
+	// All primary assets of this type require the modules. Ignored if empty.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly)
+	FPrimaryAssetType PrimaryAssetType;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, meta = (Categories = "TypedTag{OUUGameEntitlementModule}"))
+	FGameplayTagContainer RequiredModules;
+};
+
 UCLASS(BlueprintType, Config = "Game", DefaultConfig)
 class OUURUNTIME_API UOUUGameEntitlementSettings : public UDeveloperSettings
 {
@@ -46,6 +66,11 @@ public:
 	UPROPERTY(Config, EditAnywhere, meta = (Categories = "TypedTag{OUUGameEntitlementModule}"))
 	TMap<FOUUGameEntitlementCollection, FGameplayTagContainer> ModuleCollections;
 
+	// Content that requires entitlements. Used to filter soft references and primary asset IDs before loading them.
+	// See FOUUGameEntitlementSnapshot.
+	UPROPERTY(Config, EditAnywhere)
+	TArray<FOUUGameEntitlementContentRule> ContentRules;
+
 #if WITH_EDITOR
 	FOnOUUGameEntitlementSettingsChanged OnSettingsChanged;
 #endif
@@ -0,0 +1,442 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/StaticArray.h"
+#include "Math/SpiralIdUtilities.h"
+#include "Templates/TypeCompatibleBytes.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * Sparse 2D grid container keyed by spiral IDs (see USpiralIdUtilities).
+ *
+ * Cells are stored in dense pages of PageSize cells that are indexed directly by the spiral ID, so no hashing is
+ * involved in any lookup. Because spiral IDs grow with the distance from the origin, cells close to the origin share
+ * the same few pages and all cells of a ring / of a square radius around the origin form one contiguous ID range:
+ * - Ring K (all cells with max(|X|, |Y|) == K) contains the IDs [(2K-1)^2, (2K+1)^2)
+ * - All cells within radius R around the origin have the IDs [0, (2R+1)^2)
+ * Queries for rings and radii around the origin therefore iterate the occupied cells in spiral ID order by scanning the
+ * occupancy bits of the pages in that range.
+ *
+ * Pages are allocated on demand and freed once their last cell is removed. The page table grows with the highest
+ * spiral ID in the grid, so the container is best suited for grids centered around the origin and not for a few
+ * scattered cells far away from it.
+ */
+template <typename InElementType, int32 InPageSizeLog2 = 10>
+class TSpiralIdGrid
+{
+public:
+	using ElementType = InElementType;
+
+	static constexpr int32 PageSizeLog2 = InPageSizeLog2;
+	static constexpr int32 PageSize = 1 << PageSizeLog2;
+
+	static_assert(PageSizeLog2 >= 6 && PageSizeLog2 <= 16, "Page size must be between 64 and 65536 cells");
+
+	TSpiralIdGrid() = default;
+
+	TSpiralIdGrid(TSpiralIdGrid&& Other) : Pages(MoveTemp(Other.Pages)), NumElements(Other.NumElements)
+	{
+		Other.NumElements = 0;
+	}
+	TSpiralIdGrid& operator=(TSpiralIdGrid&& Other)
+	{
+		if (this != &Other)
+		{
+			Pages = MoveTemp(Other.Pages);
+			NumElements = Other.NumElements;
+			Other.Empty();
+		}
+		return *this;
+	}
+
+	TSpiralIdGrid(const TSpiralIdGrid& Other) { CopyFrom(Other); }
+	TSpiralIdGrid& operator=(const TSpiralIdGrid& Other)
+	{
+		if (this != &Other)
+		{
+			Empty();
+			CopyFrom(Other);
+		}
+		return *this;
+	}
+
+	// - Spiral ID helpers
+
+	FORCEINLINE static int32 ToSpiralId(const FIntPoint& Coordinates)
+	{
+		return USpiralIdUtilities::ConvertCoordinatePointToSpiralId(Coordinates);
+	}
+
+	FORCEINLINE static FIntPoint ToCoordinates(int32 SpiralId)
+	{
+		return USpiralIdUtilities::ConvertSpiralIdToCoordinates(SpiralId);
+	}
+
+	/** First spiral ID of a ring. Ring 0 only contains the origin cell. */
+	FORCEINLINE static constexpr int64 GetFirstSpiralIdOfRing(int32 Ring)
+	{
+		return Ring == 0 ? 0 : static_cast<int64>(2 * Ring - 1) * (2 * Ring - 1);
+	}
+
+	/** Spiral ID after the last ID of a ring. */
+	FORCEINLINE static constexpr int64 GetEndSpiralIdOfRing(int32 Ring)
+	{
+		return static_cast<int64>(2 * Ring + 1) * (2 * Ring + 1);
+	}
+
+	/** Spiral ID of the cell at the given coordinate offset from another cell */
+	FORCEINLINE static int32 GetNeighborId(int32 SpiralId, const FIntPoint& Offset)
+	{
+		return ToSpiralId(ToCoordinates(SpiralId) + Offset);
+	}
+
+	/** Spiral IDs of the 8 surrounding cells, starting with +X and going around counter clockwise */
+	static TStaticArray<int32, 8> GetNeighborIds(int32 SpiralId)
+	{
+		static const FIntPoint Offsets[8] =
+			{{1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1}};
+
+		const FIntPoint Coordinates = ToCoordinates(SpiralId);
+		TStaticArray<int32, 8> Result;
+		for (int32 Idx = 0; Idx < 8; ++Idx)
+		{
+			Result[Idx] = ToSpiralId(Coordinates + Offsets[Idx]);
+		}
+		return Result;
+	}
+
+	// - Element access
+
+	/** Number of occupied cells */
+	FORCEINLINE int32 Num() const { return NumElements; }
+	FORCEINLINE bool IsEmpty() const { return NumElements == 0; }
+
+	/** Number of allocated pages. For diagnostics. */
+	int32 GetNumAllocatedPages() const
+	{
+		int32 Result = 0;
+		for (const TUniquePtr<FPage>& Page : Pages)
+		{
+			Result += Page.IsValid() ? 1 : 0;
+		}
+		return Result;
+	}
+
+	/**
+	 * Set the value of a cell. Replaces an existing value.
+	 * The arguments may alias the value that is replaced (e.g. Grid.Add(Id, *Grid.Find(Id))).
+	 */
+	template <typename... ArgTypes>
+	ElementType& Emplace(int32 SpiralId, ArgTypes&&... Args)
+	{
+		FPage& Page = GetOrAllocatePage(SpiralId);
+		const int32 LocalIdx = GetLocalIndex(SpiralId);
+		if (Page.IsOccupied(LocalIdx))
+		{
+			// Construct the new value before destroying the old one, so aliasing arguments are still alive
+			ElementType NewValue(Forward<ArgTypes>(Args)...);
+			ElementType& Existing = Page.Get(LocalIdx);
+			DestructItem(&Existing);
+			return *new (&Existing) ElementType(MoveTemp(NewValue));
+		}
+
+		Page.SetOccupied(LocalIdx);
+		++NumElements;
+		return *new (Page.Elements[LocalIdx].GetTypedPtr()) ElementType(Forward<ArgTypes>(Args)...);
+	}
+
+	FORCEINLINE ElementType& Add(int32 SpiralId, const ElementType& Value) { return Emplace(SpiralId, Value); }
+	FORCEINLINE ElementType& Add(int32 SpiralId, ElementType&& Value) { return Emplace(SpiralId, MoveTemp(Value)); }
+	FORCEINLINE ElementType& Add(const FIntPoint& Coordinates, const ElementType& Value)
+	{
+		return Emplace(ToSpiralId(Coordinates), Value);
+	}
+	FORCEINLINE ElementType& Add(const FIntPoint& Coordinates, ElementType&& Value)
+	{
+		return Emplace(ToSpiralId(Coordinates), MoveTemp(Value));
+	}
+
+	/** Find the value of a cell or add a default constructed value if the cell is not occupied. */
+	ElementType& FindOrAdd(int32 SpiralId)
+	{
+		FPage& Page = GetOrAllocatePage(SpiralId);
+		const int32 LocalIdx = GetLocalIndex(SpiralId);
+		if (!Page.IsOccupied(LocalIdx))
+		{
+			Page.SetOccupied(LocalIdx);
+			++NumElements;
+			new (Page.Elements[LocalIdx].GetTypedPtr()) ElementType();
+		}
+		return Page.Get(LocalIdx);
+	}
+	FORCEINLINE ElementType& FindOrAdd(const FIntPoint& Coordinates) { return FindOrAdd(ToSpiralId(Coordinates)); }
+
+	FORCEINLINE ElementType* Find(int32 SpiralId)
+	{
+		return const_cast<ElementType*>(static_cast<const TSpiralIdGrid*>(this)->Find(SpiralId));
+	}
+	const ElementType* Find(int32 SpiralId) const
+	{
+		const FPage* Page = FindPage(SpiralId);
+		const int32 LocalIdx = GetLocalIndex(SpiralId);
+		return (Page && Page->IsOccupied(LocalIdx)) ? &Page->Get(LocalIdx) : nullptr;
+	}
+	FORCEINLINE ElementType* Find(const FIntPoint& Coordinates) { return Find(ToSpiralId(Coordinates)); }
+	FORCEINLINE const ElementType* Find(const FIntPoint& Coordinates) const { return Find(ToSpiralId(Coordinates)); }
+
+	FORCEINLINE bool Contains(int32 SpiralId) const { return Find(SpiralId) != nullptr; }
+	FORCEINLINE bool Contains(const FIntPoint& Coordinates) const { return Find(Coordinates) != nullptr; }
+
+	/** Find a cell at the given coordinate offset from another cell */
+	FORCEINLINE ElementType* FindNeighbor(int32 SpiralId, const FIntPoint& Offset)
+	{
+		return Find(GetNeighborId(SpiralId, Offset));
+	}
+	FORCEINLINE const ElementType* FindNeighbor(int32 SpiralId, const FIntPoint& Offset) const
+	{
+		return Find(GetNeighborId(SpiralId, Offset));
+	}
+
+	/**
+	 * Remove a cell.
+	 * @returns if the cell was occupied
+	 */
+	bool Remove(int32 SpiralId)
+	{
+		FPage* Page = const_cast<FPage*>(FindPage(SpiralId));
+		const int32 LocalIdx = GetLocalIndex(SpiralId);
+		if (Page == nullptr || !Page->IsOccupied(LocalIdx))
+			return false;
+
+		DestructItem(&Page->Get(LocalIdx));
+		Page->ClearOccupied(LocalIdx);
+		--NumElements;
+
+		if (Page->NumOccupied == 0)
+		{
+			Pages[GetPageIndex(SpiralId)].Reset();
+		}
+		return true;
+	}
+	FORCEINLINE bool Remove(const FIntPoint& Coordinates) { return Remove(ToSpiralId(Coordinates)); }
+
+	/** Remove all cells and free all pages */
+	void Empty()
+	{
+		Pages.Empty();
+		NumElements = 0;
+	}
+
+	// - Queries
+	// All queries call Func(int32 SpiralId, ElementType& Element) for each occupied cell.
+
+	/** Iterate all occupied cells in spiral ID order */
+	template <typename FuncType>
+	void ForEach(FuncType&& Func)
+	{
+		ForEachInSpiralIdRangeImpl(*this, 0, GetEndSpiralId(), Func);
+	}
+	template <typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		ForEachInSpiralIdRangeImpl(*this, 0, GetEndSpiralId(), Func);
+	}
+
+	/** Iterate all occupied cells with spiral IDs in [BeginSpiralId, EndSpiralId) in spiral ID order */
+	template <typename FuncType>
+	void ForEachInSpiralIdRange(int64 BeginSpiralId, int64 EndSpiralId, FuncType&& Func)
+	{
+		ForEachInSpiralIdRangeImpl(*this, BeginSpiralId, EndSpiralId, Func);
+	}
+	template <typename FuncType>
+	void ForEachInSpiralIdRange(int64 BeginSpiralId, int64 EndSpiralId, FuncType&& Func) const
+	{
+		ForEachInSpiralIdRangeImpl(*this, BeginSpiralId, EndSpiralId, Func);
+	}
+
+	/** Iterate all occupied cells of the rings [MinRing, MaxRing] around the origin in spiral ID order */
+	template <typename FuncType>
+	void ForEachInRings(int32 MinRing, int32 MaxRing, FuncType&& Func)
+	{
+		ForEachInSpiralIdRangeImpl(*this, GetFirstSpiralIdOfRing(MinRing), GetEndSpiralIdOfRing(MaxRing), Func);
+	}
+	template <typename FuncType>
+	void ForEachInRings(int32 MinRing, int32 MaxRing, FuncType&& Func) const
+	{
+		ForEachInSpiralIdRangeImpl(*this, GetFirstSpiralIdOfRing(MinRing), GetEndSpiralIdOfRing(MaxRing), Func);
+	}
+
+	/** Iterate all occupied cells within a square radius around the origin (= all rings up to Radius) */
+	template <typename FuncType>
+	FORCEINLINE void ForEachInRadius(int32 Radius, FuncType&& Func)
+	{
+		ForEachInRings(0, Radius, Func);
+	}
+	template <typename FuncType>
+	FORCEINLINE void ForEachInRadius(int32 Radius, FuncType&& Func) const
+	{
+		ForEachInRings(0, Radius, Func);
+	}
+
+	/**
+	 * Iterate all occupied cells within a square radius around an arbitrary center cell.
+	 * The cells are visited row by row. Every cell is converted to its spiral ID, which is O(1) and doesn't hash.
+	 */
+	template <typename FuncType>
+	void ForEachInRadius(const FIntPoint& Center, int32 Radius, FuncType&& Func)
+	{
+		ForEachInRadiusImpl(*this, Center, Radius, Func);
+	}
+	template <typename FuncType>
+	void ForEachInRadius(const FIntPoint& Center, int32 Radius, FuncType&& Func) const
+	{
+		ForEachInRadiusImpl(*this, Center, Radius, Func);
+	}
+
+private:
+	static constexpr int32 NumMaskWords = PageSize / 64;
+
+	struct FPage
+	{
+		uint64 OccupiedMask[NumMaskWords] = {};
+		int32 NumOccupied = 0;
+		TTypeCompatibleBytes<ElementType> Elements[PageSize];
+
+		FPage() = default;
+		UE_NONCOPYABLE(FPage);
+
+		~FPage()
+		{
+			if constexpr (!TIsTriviallyDestructible<ElementType>::Value)
+			{
+				for (int32 WordIdx = 0; WordIdx < NumMaskWords; ++WordIdx)
+				{
+					for (uint64 Word = OccupiedMask[WordIdx]; Word != 0; Word &= Word - 1)
+					{
+						const int32 LocalIdx = WordIdx * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+						DestructItem(&Get(LocalIdx));
+					}
+				}
+			}
+		}
+
+		FORCEINLINE bool IsOccupied(int32 LocalIdx) const
+		{
+			return (OccupiedMask[LocalIdx >> 6] & (uint64(1) << (LocalIdx & 63))) != 0;
+		}
+		FORCEINLINE void SetOccupied(int32 LocalIdx)
+		{
+			OccupiedMask[LocalIdx >> 6] |= (uint64(1) << (LocalIdx & 63));
+			++NumOccupied;
+		}
+		FORCEINLINE void ClearOccupied(int32 LocalIdx)
+		{
+			OccupiedMask[LocalIdx >> 6] &= ~(uint64(1) << (LocalIdx & 63));
+			--NumOccupied;
+		}
+
+		FORCEINLINE ElementType& Get(int32 LocalIdx) { return *Elements[LocalIdx].GetTypedPtr(); }
+		FORCEINLINE const ElementType& Get(int32 LocalIdx) const { return *Elements[LocalIdx].GetTypedPtr(); }
+	};
+
+	TArray<TUniquePtr<FPage>> Pages;
+	int32 NumElements = 0;
+
+	FORCEINLINE static int32 GetPageIndex(int32 SpiralId) { return SpiralId >> PageSizeLog2; }
+	FORCEINLINE static int32 GetLocalIndex(int32 SpiralId) { return SpiralId & (PageSize - 1); }
+
+	FORCEINLINE int64 GetEndSpiralId() const { return static_cast<int64>(Pages.Num()) << PageSizeLog2; }
+
+	FORCEINLINE const FPage* FindPage(int32 SpiralId) const
+	{
+		const int32 PageIdx = GetPageIndex(SpiralId);
+		return (SpiralId >= 0 && PageIdx < Pages.Num()) ? Pages[PageIdx].Get() : nullptr;
+	}
+
+	FPage& GetOrAllocatePage(int32 SpiralId)
+	{
+		checkf(SpiralId >= 0, TEXT("Spiral IDs must not be negative (got %i)"), SpiralId);
+		const int32 PageIdx = GetPageIndex(SpiralId);
+		if (PageIdx >= Pages.Num())
+		{
+			Pages.SetNum(PageIdx + 1);
+		}
+
+		TUniquePtr<FPage>& Page = Pages[PageIdx];
+		if (!Page.IsValid())
+		{
+			Page = MakeUnique<FPage>();
+		}
+		return *Page;
+	}
+
+	void CopyFrom(const TSpiralIdGrid& Other)
+	{
+		Other.ForEach([this](int32 SpiralId, const ElementType& Element) { Emplace(SpiralId, Element); });
+	}
+
+	// Shared implementation for const and non-const queries
+	template <typename SelfType, typename FuncType>
+	static void ForEachInSpiralIdRangeImpl(SelfType& Self, int64 BeginSpiralId, int64 EndSpiralId, FuncType& Func)
+	{
+		// TUniquePtr::Get() is const, so we have to restore constness of the pages ourselves
+		using PageType = std::conditional_t<std::is_const_v<SelfType>, const FPage, FPage>;
+
+		BeginSpiralId = FMath::Max<int64>(BeginSpiralId, 0);
+		EndSpiralId = FMath::Min<int64>(EndSpiralId, Self.GetEndSpiralId());
+
+		int64 PageBegin = BeginSpiralId;
+		while (PageBegin < EndSpiralId)
+		{
+			const int32 PageIdx = static_cast<int32>(PageBegin >> PageSizeLog2);
+			const int64 PageBaseId = static_cast<int64>(PageIdx) << PageSizeLog2;
+			const int64 PageEnd = FMath::Min<int64>(PageBaseId + PageSize, EndSpiralId);
+
+			if (PageType* Page = Self.Pages[PageIdx].Get())
+			{
+				const int32 LocalBegin = static_cast<int32>(PageBegin - PageBaseId);
+				const int32 LocalEnd = static_cast<int32>(PageEnd - PageBaseId);
+				const int32 LastWordIdx = (LocalEnd - 1) >> 6;
+				for (int32 WordIdx = LocalBegin >> 6; WordIdx <= LastWordIdx; ++WordIdx)
+				{
+					uint64 Word = Page->OccupiedMask[WordIdx];
+					// Mask out bits outside of the range in the first and last word
+					if (WordIdx == (LocalBegin >> 6))
+					{
+						Word &= ~uint64(0) << (LocalBegin & 63);
+					}
+					if (WordIdx == LastWordIdx && (LocalEnd & 63) != 0)
+					{
+						Word &= ~(~uint64(0) << (LocalEnd & 63));
+					}
+
+					for (; Word != 0; Word &= Word - 1)
+					{
+						const int32 LocalIdx = WordIdx * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Word));
+						Func(static_cast<int32>(PageBaseId) + LocalIdx, Page->Get(LocalIdx));
+					}
+				}
+			}
+			PageBegin = PageEnd;
+		}
+	}
+
+	template <typename SelfType, typename FuncType>
+	static void ForEachInRadiusImpl(SelfType& Self, const FIntPoint& Center, int32 Radius, FuncType& Func)
+	{
+		for (int32 Y = Center.Y - Radius; Y <= Center.Y + Radius; ++Y)
+		{
+			for (int32 X = Center.X - Radius; X <= Center.X + Radius; ++X)
+			{
+				const int32 SpiralId = USpiralIdUtilities::ConvertCoordinatesToSpiralId(X, Y);
+				if (auto* Element = Self.Find(SpiralId))
+				{
+					Func(SpiralId, *Element);
+				}
+			}
+		}
+	}
+};
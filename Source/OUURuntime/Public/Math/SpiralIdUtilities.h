@@ -70,8 +70,9 @@ enum class ESpiralCoordinateSystemType : uint8
  * For all of the distance based conversions, the grid cells are assumed to be squares,
  * even though the grid to spiral ID conversion would work just as well with rectangular cells.
  *
- * Note: Functions converting spiral IDs to points, locations, bounds, etc are more expensive O(n)
- * than conversions in the opposite direction (e.g. from coordinate to ID) that have runtime O(1).
+ * Conversions in both directions have runtime O(1). Converting spiral IDs to points, locations, bounds, etc is
+ * slightly more expensive than the opposite direction, because it requires an integer square root.
+ * Use ConvertSpiralIdsToCoordinates() to decode many IDs at once.
  */
 UCLASS(BlueprintType)
 class OUURUNTIME_API USpiralIdUtilities : public UBlueprintFunctionLibrary
@@ -124,14 +125,25 @@ public:
 
 	/**
 	 * Convert a spiral ID to grid coordinates.
-	 * Note: This function is more expensive O(n) compared to the opposite conversion from coordinate to ID O(1).
+	 * Negative IDs are invalid and return the origin.
 	 */
 	UFUNCTION(BlueprintPure,Category="OUU|Math|SpiralIdUtilities")
 	static FIntPoint ConvertSpiralIdToCoordinates(const int32 SpiralId);
 
+	/**
+	 * Convert an array of spiral IDs to grid coordinates.
+	 * The conversion loop is branch free, so the compiler can vectorize it.
+	 * @param	SpiralIds		IDs to convert
+	 * @param	OutCoordinates	Receives the coordinates. Must have the same size as SpiralIds.
+	 */
+	static void ConvertSpiralIdsToCoordinates(TConstArrayView<int32> SpiralIds, TArrayView<FIntPoint> OutCoordinates);
+
+	/** Convert an array of spiral IDs to grid coordinates. */
+	UFUNCTION(BlueprintPure,Category="OUU|Math|SpiralIdUtilities")
+	static TArray<FIntPoint> ConvertSpiralIdArrayToCoordinates(const TArray<int32>& SpiralIds);
+
 	/**
 	 * Convert a spiral ID to the center location of a grid cell in world space.
-	 * Note: This function is more expensive O(n) compared to the opposite conversion from location to ID O(1).
 	 *
 	 * @param	SpiralId			Spiral Id of the cell to convert
 	 * @param	GridSize			Width of the grid cells
@@ -146,7 +158,6 @@ public:
 
 	/**
 	 * Convert a spiral ID to the 2D bounds of a cell in world space.
-	 * Note: This function is more expensive O(n) compared to conversions from coordinate to ID O(1).
 	 *
 	 * @param	SpiralId			Spiral Id of the cell to convert
 	 * @param	GridSize			Width of the grid cells
@@ -163,7 +174,6 @@ public:
 	 * Convert a spiral ID to the 3D bounds of a cell in world space.
 	 * Because the spiral ID only describes the 2D location of the cell,
 	 * the height and elevation have to be supplied by the function caller.
-	 * Note: This function is more expensive O(n) compared to conversions from coordinate to ID O(1).
 	 *
 	 * @param	SpiralId			Spiral Id of the cell to convert
 	 * @param	GridSize			Width of the grid cells
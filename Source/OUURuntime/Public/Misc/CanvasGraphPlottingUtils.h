@@ -27,7 +27,20 @@ namespace OUU::Runtime::CanvasGraphPlottingUtils
 					return static_cast<const T*>(ContainerPtr)->operator[](Idx);
 				}),
 				GetNumDelegate(
-					[](const void* ContainerPtr) -> int32 { return static_cast<const T*>(ContainerPtr)->Num(); })
+					[](const void* ContainerPtr) -> int32 { return static_cast<const T*>(ContainerPtr)->Num(); }),
+				CopyValuesDelegate([](const void* ContainerPtr, TArray<float>& OutValues) {
+					// Bulk access via contiguous views instead of one delegate call per element
+					const auto Views = static_cast<const T*>(ContainerPtr)->GetContiguousViews();
+					OutValues.Reset(Views.Num());
+					for (const auto& Value : Views.First)
+					{
+						OutValues.Add(static_cast<float>(Value));
+					}
+					for (const auto& Value : Views.Second)
+					{
+						OutValues.Add(static_cast<float>(Value));
+					}
+				})
 			{
 			}
 
@@ -42,9 +55,28 @@ namespace OUU::Runtime::CanvasGraphPlottingUtils
 			const void* ValueContainer = nullptr;
 			TFunction<float(const void*, int32)> GetValueDelegate;
 			TFunction<int32(const void*)> GetNumDelegate;
+			// Optional: Copy all values in chronological order at once
+			TFunction<void(const void*, TArray<float>&)> CopyValuesDelegate;
 
 			float operator[](int32 Idx) const { return GetValueDelegate(ValueContainer, Idx); }
 			int32 Num() const { return GetNumDelegate(ValueContainer); }
+
+			/** Copy all values in chronological order. Uses bulk access if available. */
+			void CopyValues(TArray<float>& OutValues) const
+			{
+				if (CopyValuesDelegate)
+				{
+					CopyValuesDelegate(ValueContainer, OutValues);
+					return;
+				}
+
+				const int32 NumValues = Num();
+				OutValues.Reset(NumValues);
+				for (int32 Idx = 0; Idx < NumValues; Idx++)
+				{
+					OutValues.Add(GetValueDelegate(ValueContainer, Idx));
+				}
+			}
 		};
 
 		FGraphStatData(const FValueRangeRef& InValueRangeRef, FLinearColor InColor, const FString& InTitle) :
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "Internationalization/Regex.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "Templates/StringUtils.h"
 
@@ -9,6 +10,29 @@
 
 class FRegexMatcher;
 
+/**
+ * Regex pattern that is compiled once on construction.
+ * Keep one around for patterns that are used in hot paths and pass it to the RegexUtils overloads,
+ * so the pattern cache lookup (hashing the pattern string + lock) is skipped as well.
+ * Copies share the compiled pattern and can be used from multiple threads concurrently.
+ */
+class OUURUNTIME_API FCompiledRegexPattern
+{
+public:
+	explicit FCompiledRegexPattern(
+		const FString& InPatternString,
+		ERegexPatternFlags InFlags = ERegexPatternFlags::None);
+
+	FORCEINLINE const FString& GetPatternString() const { return PatternString; }
+	FORCEINLINE ERegexPatternFlags GetFlags() const { return Flags; }
+	FORCEINLINE const FRegexPattern& GetPattern() const { return Pattern; }
+
+private:
+	FString PatternString;
+	ERegexPatternFlags Flags;
+	FRegexPattern Pattern;
+};
+
 /** A single regex match */
 USTRUCT(BlueprintType)
 struct OUURUNTIME_API FRegexMatch
@@ -128,11 +152,253 @@ public:
 		const FString& RegexPattern,
 		const FString& InputString,
 		const FString& ReplaceString);
+
+	// Overloads for precompiled patterns. Same semantics as the string pattern versions above.
+	static bool MatchesRegex(const FCompiledRegexPattern& RegexPattern, const FString& TestString);
+	static bool MatchesRegexExact(const FCompiledRegexPattern& RegexPattern, const FString& TestString);
+	static int32 CountRegexMatches(const FCompiledRegexPattern& RegexPattern, const FString& TestString);
+	static TArray<FRegexMatch> GetRegexMatches(const FCompiledRegexPattern& RegexPattern, const FString& TestString);
+	static TArray<FRegexGroups> GetRegexMatchesAndGroups(
+		const FCompiledRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString);
+	static FRegexGroups GetFirstRegexMatchAndGroups(
+		const FCompiledRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString);
+	static FRegexGroups GetRegexMatchAndGroupsExact(
+		const FCompiledRegexPattern& RegexPattern,
+		int32 GroupCount,
+		const FString& TestString);
+	static FString ReplaceFirstRegexMatch(
+		const FCompiledRegexPattern& RegexPattern,
+		const FString& InputString,
+		const FString& ReplaceString);
+	static FString ReplaceAllRegexMatches(
+		const FCompiledRegexPattern& RegexPattern,
+		const FString& InputString,
+		const FString& ReplaceString);
 };
 
 namespace OUU::Runtime
 {
 	using RegexUtils = URegexFunctionLibrary;
+
+	struct FRegexPatternCacheStats
+	{
+		uint64 NumHits = 0;
+		uint64 NumMisses = 0;
+		int32 NumEntries = 0;
+		int32 MaxNumEntries = 0;
+	};
+
+	/**
+	 * Thread-safe LRU cache of compiled regex patterns keyed by pattern string and flags.
+	 * All RegexUtils functions that take a pattern string look up the compiled pattern here instead of compiling it
+	 * on every call. The capacity is controlled by ouu.Regex.PatternCacheSize.
+	 */
+	class OUURUNTIME_API FRegexPatternCache
+	{
+	public:
+		/** Compiled pattern for the pattern string. Compiles and caches the pattern on a miss. */
+		static FRegexPattern FindOrCompile(
+			const FString& PatternString,
+			ERegexPatternFlags Flags = ERegexPatternFlags::None);
+
+		static FRegexPatternCacheStats GetStats();
+
+		/** Drop all cached patterns. Does not reset the hit/miss counters. */
+		static void Empty();
+
+		static void ResetStats();
+	};
+
+	/** Character range [Beginning, Ending) of a match or capture group in the input string. */
+	struct FRegexSpan
+	{
+		// INDEX_NONE if the capture group did not participate in the match
+		int32 Beginning = INDEX_NONE;
+		int32 Ending = INDEX_NONE;
+
+		FORCEINLINE bool IsValid() const { return Beginning != INDEX_NONE && Ending >= Beginning; }
+		FORCEINLINE int32 Len() const { return IsValid() ? Ending - Beginning : 0; }
+
+		/** View of the span in the input string the span was created for. Empty view for invalid spans. */
+		FORCEINLINE FStringView GetView(const FString& Input) const
+		{
+			return IsValid() ? FStringView(Input).Mid(Beginning, Len()) : FStringView();
+		}
+		// The view would dangle once the temporary input is destroyed
+		FStringView GetView(FString&& Input) const = delete;
+
+		FORCEINLINE bool operator==(const FRegexSpan& Other) const
+		{
+			return Beginning == Other.Beginning && Ending == Other.Ending;
+		}
+		FORCEINLINE bool operator!=(const FRegexSpan& Other) const { return !(*this == Other); }
+	};
+
+	/**
+	 * Enumerates all non-empty matches of a pattern in a single pass over the input.
+	 * One matcher is created up-front and every FindNext() continues where the previous match ended, so enumerating
+	 * all matches is linear in the input length. The input must outlive the enumerator.
+	 *
+	 *	FRegexMatchEnumerator Matches(Pattern, Input);
+	 *	while (Matches.FindNext())
+	 *	{
+	 *		const FRegexSpan Span = Matches.GetMatchSpan();
+	 *	}
+	 */
+	class OUURUNTIME_API FRegexMatchEnumerator
+	{
+	public:
+		FRegexMatchEnumerator(const FRegexPattern& Pattern, const FString& InInput);
+		FRegexMatchEnumerator(const FCompiledRegexPattern& Pattern, const FString& InInput);
+		// The enumerator keeps a reference to the input, so it must not be constructed from a temporary
+		FRegexMatchEnumerator(const FRegexPattern& Pattern, FString&& InInput) = delete;
+		FRegexMatchEnumerator(const FCompiledRegexPattern& Pattern, FString&& InInput) = delete;
+
+		/** Advance to the next non-empty match. Returns false once there are no more matches. */
+		bool FindNext();
+
+		/** Span of the current match. Only valid after FindNext() returned true. */
+		FORCEINLINE FRegexSpan GetMatchSpan() const { return CurrentMatch; }
+
+		/** Span of a capture group of the current match. Group 0 is the entire match. */
+		FRegexSpan GetGroupSpan(int32 GroupIndex);
+
+		/** View into the input of the current match. Does not copy any characters. */
+		FORCEINLINE FStringView GetMatchView() const { return CurrentMatch.GetView(Input); }
+
+		/** View into the input of a capture group of the current match. Does not copy any characters. */
+		FORCEINLINE FStringView GetGroupView(int32 GroupIndex) { return GetGroupSpan(GroupIndex).GetView(Input); }
+
+		FORCEINLINE const FString& GetInput() const { return Input; }
+
+	private:
+		const FString& Input;
+		FRegexMatcher Matcher;
+		FRegexSpan CurrentMatch;
+	};
+
+	/**
+	 * Call Func(FRegexMatchEnumerator&) for every non-empty match of the pattern in the input.
+	 * PatternType may be FRegexPattern or FCompiledRegexPattern.
+	 */
+	template <typename PatternType, typename FuncType>
+	void ForEachRegexMatch(const PatternType& Pattern, const FString& Input, FuncType&& Func)
+	{
+		FRegexMatchEnumerator Matches(Pattern, Input);
+		while (Matches.FindNext())
+		{
+			Func(Matches);
+		}
+	}
+
+	// Zero-copy variants of the RegexUtils functions:
+	// Results are spans or views into the input instead of one FString per match / capture group, so the input must
+	// outlive the results. The view-returning functions can't be called with temporary inputs.
+	// Pass FFrameArenaAllocator (Templates/FrameArena.h) as AllocatorType to keep the result arrays off the heap as
+	// well, e.g. GetRegexMatchSpans<FFrameArenaAllocator>(Pattern, Input).
+
+	/** Spans of all matches. */
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FRegexSpan, AllocatorType> GetRegexMatchSpans(const PatternType& Pattern, const FString& Input)
+	{
+		TArray<FRegexSpan, AllocatorType> Result;
+		ForEachRegexMatch(Pattern, Input, [&Result](FRegexMatchEnumerator& Matches) {
+			Result.Add(Matches.GetMatchSpan());
+		});
+		return Result;
+	}
+
+	/** Views of all matches. */
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FStringView, AllocatorType> GetRegexMatchViews(const PatternType& Pattern, const FString& Input)
+	{
+		TArray<FStringView, AllocatorType> Result;
+		ForEachRegexMatch(Pattern, Input, [&Result](FRegexMatchEnumerator& Matches) {
+			Result.Add(Matches.GetMatchView());
+		});
+		return Result;
+	}
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FStringView, AllocatorType> GetRegexMatchViews(const PatternType& Pattern, FString&& Input) = delete;
+
+	/**
+	 * Spans of all matches and their capture groups, flattened into a single array.
+	 * Each match adds (GroupCount + 1) spans: The entire match followed by capture groups 1 to GroupCount.
+	 */
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FRegexSpan, AllocatorType> GetRegexGroupSpans(
+		const PatternType& Pattern,
+		int32 GroupCount,
+		const FString& Input)
+	{
+		TArray<FRegexSpan, AllocatorType> Result;
+		ForEachRegexMatch(Pattern, Input, [&Result, GroupCount](FRegexMatchEnumerator& Matches) {
+			for (int32 i = 0; i < (GroupCount + 1); i++)
+			{
+				Result.Add(Matches.GetGroupSpan(i));
+			}
+		});
+		return Result;
+	}
+
+	/** Same as GetRegexGroupSpans, but with views into the input. Groups that did not participate are empty views. */
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FStringView, AllocatorType> GetRegexGroupViews(
+		const PatternType& Pattern,
+		int32 GroupCount,
+		const FString& Input)
+	{
+		TArray<FStringView, AllocatorType> Result;
+		ForEachRegexMatch(Pattern, Input, [&Result, GroupCount](FRegexMatchEnumerator& Matches) {
+			for (int32 i = 0; i < (GroupCount + 1); i++)
+			{
+				Result.Add(Matches.GetGroupView(i));
+			}
+		});
+		return Result;
+	}
+	template <typename AllocatorType = FDefaultAllocator, typename PatternType>
+	TArray<FStringView, AllocatorType> GetRegexGroupViews(
+		const PatternType& Pattern,
+		int32 GroupCount,
+		FString&& Input) = delete;
+
+	enum class ERegexBatchMatchMode : uint8
+	{
+		// Same as MatchesRegex: The pattern is found anywhere in the string
+		Contains,
+		// Same as MatchesRegexExact: The pattern matches the entire string
+		Exact
+	};
+
+	// Batch matching of one pattern against many strings or names.
+	// Strings are distributed over the task graph workers in contiguous chunks. Each worker creates its own matchers
+	// from the shared compiled pattern, so the pattern is never recompiled or looked up in the pattern cache.
+	// Small batches are matched on the calling thread.
+
+	/** @returns bit mask with one bit per string that is set if the string matches the pattern */
+	OUURUNTIME_API TBitArray<> MatchesRegexBatch(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FString> Strings,
+		ERegexBatchMatchMode Mode = ERegexBatchMatchMode::Contains);
+	OUURUNTIME_API TBitArray<> MatchesRegexBatch(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FName> Names,
+		ERegexBatchMatchMode Mode = ERegexBatchMatchMode::Contains);
+
+	/** @returns ascending indices of all strings that match the pattern */
+	OUURUNTIME_API TArray<int32> FindRegexMatchIndices(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FString> Strings,
+		ERegexBatchMatchMode Mode = ERegexBatchMatchMode::Contains);
+	OUURUNTIME_API TArray<int32> FindRegexMatchIndices(
+		const FCompiledRegexPattern& Pattern,
+		TArrayView<const FName> Names,
+		ERegexBatchMatchMode Mode = ERegexBatchMatchMode::Contains);
 } // namespace OUU::Runtime
 
 class UE_DEPRECATED(5.0, "FRegexUtils has been deprecated in favor of OUU::Runtime::RegexUtils.") FRegexUtils :
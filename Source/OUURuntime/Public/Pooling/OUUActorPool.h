@@ -130,10 +130,44 @@ public:
 	// If enabled the spawned actor's construction script is not run and must be executed by user.
 	bool DelayFirstConstructionScript = false;
 
+	/**
+	 * If enabled, requests with the same Priority are ordered by their SpatialScore, which is derived from the
+	 * distance of Transform's location to the closest player view and whether it's inside the view cone.
+	 * Scores are re-evaluated in batches by the pool (see ouu.ActorPool.SpatialPriority.* cvars).
+	 */
+	bool PrioritizeByPlayerView = false;
+
+	/**
+	 * Normalized spatial relevance in [0, 1] that is updated by the pool, the lower the value is, the more relevant.
+	 * 0 at a player view location, 0.5 at ouu.ActorPool.SpatialPriority.ReferenceDistance inside the view cone and
+	 * approaching 1 for far away locations. Requests that don't use PrioritizeByPlayerView or that were scored while
+	 * no player views were available have a score of 1.
+	 */
+	float SpatialScore = 1.f;
+
+	/**
+	 * Spawn order of pending requests: Lower Priority first, then lower SpatialScore, then older requests.
+	 * Spatial scores never override explicit priorities.
+	 */
+	bool IsMoreImportantThan(const FOUUActorPoolSpawnRequest& Other) const
+	{
+		if (Priority != Other.Priority)
+		{
+			return Priority < Other.Priority;
+		}
+		if (SpatialScore != Other.SpatialScore)
+		{
+			return SpatialScore < Other.SpatialScore;
+		}
+		return SerialNumber < Other.SerialNumber;
+	}
+
 	void Reset()
 	{
 		Template = nullptr;
 		Priority = MAX_FLT;
+		PrioritizeByPlayerView = false;
+		SpatialScore = 1.f;
 		PostSpawnDelegate.Unbind();
 		Status = EOUUActorPoolSpawnRequestStatus::None;
 		SpawnedActor = nullptr;
@@ -170,6 +204,19 @@ public:
 	const FSpawnRequest& GetSpawnRequest(const FSpawnRequestHandle SpawnRequestHandle) const;
 	FSpawnRequest& GetMutableSpawnRequest(const FSpawnRequestHandle SpawnRequestHandle);
 
+	/**
+	 * Score a location against a set of player views (see FOUUActorPoolSpawnRequest::SpatialScore).
+	 * @param	OutOfViewDistanceScale	Distances outside of the view cone are scaled by this factor
+	 * @param	ReferenceDistance		Distance in the view cone that results in a score of 0.5
+	 * @returns 1 if there are no views
+	 */
+	static float ScoreLocationAgainstViews(
+		const FVector& Location,
+		TConstArrayView<FTransform> Views,
+		float ViewConeHalfAngle,
+		float OutOfViewDistanceScale,
+		float ReferenceDistance);
+
 	// - USubsystem
 	bool ShouldCreateSubsystem(UObject* Outer) const override;
 	// - FTickableGameObject
@@ -191,6 +238,16 @@ protected:
 	 */
 	virtual void DeactivateActorFast(AActor* Actor) const;
 
+	/**
+	 * Collect the view points that are used to compute spatial priorities of spawn requests.
+	 * Default implementation uses all player controllers that are present in the world, i.e. local players on clients
+	 * and all net viewers on servers.
+	 */
+	virtual void GatherPlayerViews(TArray<FTransform>& OutViews) const;
+
+	/** Compute the spatial score of a location against the cached player views (lower is more important). */
+	virtual float ComputeSpatialScore(const FVector& Location) const;
+
 private:
 	UPROPERTY()
 	TArray<FOUUActorPoolSpawnRequest> SpawnRequests;
@@ -207,6 +264,11 @@ private:
 	mutable int32 NumActorSpawned = 0;
 	mutable int32 NumActorPooled = 0;
 
+	// Player views cached during the last spatial score update
+	TArray<FTransform> CachedPlayerViews;
+	double LastSpatialPriorityUpdateTime = -MAX_dbl;
+
+	void UpdateSpatialPriorities();
 	void ProcessPendingSpawningRequest(const double MaxTimeSlicePerTick);
 	void ProcessPendingDestruction(const double MaxTimeSlicePerTick);
 	bool TryReleaseActorToPool(AActor* Actor);
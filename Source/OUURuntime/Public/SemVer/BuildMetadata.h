@@ -21,6 +21,8 @@ struct OUURUNTIME_API FSemVerBuildMetadata
 {
 	GENERATED_BODY()
 public:
+	friend OUURUNTIME_API uint32 GetTypeHash(const FSemVerBuildMetadata&);
+
 	FSemVerBuildMetadata() = default;
 
 	/**
@@ -58,3 +60,5 @@ protected:
 	UPROPERTY(BlueprintReadOnly,Category="OUU|Runtime|SemVer")
 	ESemVerParsingStrictness Strictness = ESemVerParsingStrictness::Strict;
 };
+
+OUURUNTIME_API uint32 GetTypeHash(const FSemVerBuildMetadata& Metadata);
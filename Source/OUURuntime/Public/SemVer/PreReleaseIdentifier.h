@@ -21,6 +21,8 @@ struct OUURUNTIME_API FSemVerPreReleaseIdentifier
 {
 	GENERATED_BODY()
 public:
+	friend OUURUNTIME_API uint32 GetTypeHash(const FSemVerPreReleaseIdentifier&);
+
 	FSemVerPreReleaseIdentifier() = default;
 
 	/**
@@ -45,6 +47,13 @@ public:
 	/** @returns the dot-separated identifiers that comprise the combined pre-release identifier */
 	const TArray<FString>& GetIdentifiers() const;
 
+	/**
+	 * Small rank that is consistent with the precedence order: If the rank of this identifier is lower than the rank
+	 * of the other one, this identifier has lower precedence. Equal ranks need a full comparison.
+	 * Derived from the first identifier only. No pre-release identifier has the max rank.
+	 */
+	uint8 GetPrecedenceRank() const;
+
 	/**
 	 * Try to increment this pre-release identifier. Only works if the last identifier has only digits or is empty.
 	 * @returns if incrementing the pre-release was successful
@@ -83,3 +92,5 @@ protected:
 
 	static int32 TryParseNumericIdentifier(const FString& Identifier);
 };
+
+OUURUNTIME_API uint32 GetTypeHash(const FSemVerPreReleaseIdentifier& PreRelease);
@@ -0,0 +1,51 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SemVer/SemVerParsingStrictness.h"
+
+/**
+ * Hand-written single pass parser for semantic version strings.
+ * Accepts exactly the same strings as the FSemVerRegex patterns for all parsing strictness levels and returns the same
+ * components, but without compiling or running a regex and without any allocations.
+ * Digits are ASCII digits only, whereas \d in the regex patterns also matched other Unicode decimal digits.
+ */
+namespace OUU::Runtime::SemVerParser
+{
+	/**
+	 * Components of a semantic version string.
+	 * All views point into the parsed string. Components that are not present in the string are empty.
+	 */
+	struct FSemVerStringComponents
+	{
+		FStringView Major;
+		FStringView Minor;
+		FStringView Patch;
+		FStringView PreRelease;
+		FStringView BuildMetadata;
+	};
+
+	/**
+	 * Split a semantic version string into its components.
+	 * Strict and Regular require the entire string to be a semantic version.
+	 * Liberal uses the first version-like substring and only fails if the string contains no digits.
+	 */
+	OUURUNTIME_API bool TryParse(
+		FStringView SourceString,
+		ESemVerParsingStrictness Strictness,
+		FSemVerStringComponents& OutComponents);
+
+	/** @returns if the entire string is a semantic version for the given strictness (also for Liberal). */
+	OUURUNTIME_API bool IsValidSemVer(FStringView SourceString, ESemVerParsingStrictness Strictness);
+
+	/** Parse a string of digits. Saturates at the maximum int32 value. Empty strings are 0. */
+	OUURUNTIME_API int32 ParseVersionNumber(FStringView Digits);
+
+	/** @returns if the identifier is a single spec compliant pre-release identifier (no leading zeroes) */
+	OUURUNTIME_API bool IsValidPreReleaseIdentifier(FStringView Identifier);
+
+	/** @returns if the string is spec compliant build metadata (dot separated, non-empty alphanumeric identifiers) */
+	OUURUNTIME_API bool IsValidStrictBuildMetadata(FStringView Metadata);
+} // namespace OUU::Runtime::SemVerParser
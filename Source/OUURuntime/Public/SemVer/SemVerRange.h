@@ -0,0 +1,152 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SemVer/SemanticVersion.h"
+
+#include "SemVerRange.generated.h"
+
+//////////////////////////////////////////////////////////////////////////
+// Version range expressions with the same syntax and semantics as the
+// node-semver ranges used by npm: https://github.com/npm/node-semver#ranges
+//////////////////////////////////////////////////////////////////////////
+
+/** Lower or upper bound of a FSemVerRangeInterval */
+struct OUURUNTIME_API FSemVerRangeBound
+{
+	FSemanticVersion Version;
+
+	/** Cached FSemanticVersion::GetPrecedenceKey() of Version */
+	uint64 Key = 0;
+
+	bool bInclusive = true;
+
+	FSemVerRangeBound() = default;
+	FSemVerRangeBound(const FSemanticVersion& InVersion, bool bInInclusive);
+
+	/**
+	 * Compare the precedence of another version to this bound's version.
+	 * @param	OtherKey	Precedence key of the other version, so it can be reused for all bounds of a range
+	 * @returns <0, 0 or >0 if the other version has lower, equal or higher precedence
+	 */
+	int32 ComparePrecedence(const FSemanticVersion& Other, uint64 OtherKey) const;
+
+	/** Does this bound allow pre-release versions of the other version's [major, minor, patch] tuple? */
+	bool AllowsPreReleasesOf(const FSemanticVersion& Other) const;
+};
+
+/**
+ * Interval of versions that is compiled from one comparator set of a range expression (e.g. ">=1.2.0 <2.0.0-0").
+ * Unset bounds are unbounded.
+ */
+struct OUURUNTIME_API FSemVerRangeInterval
+{
+	TOptional<FSemVerRangeBound> Lower;
+	TOptional<FSemVerRangeBound> Upper;
+
+	/** Narrow the interval so it only contains versions that also satisfy the bound */
+	void IntersectLower(const FSemVerRangeBound& Bound);
+	void IntersectUpper(const FSemVerRangeBound& Bound);
+
+	/** @returns if no version can be in this interval */
+	bool IsEmpty() const;
+
+	/**
+	 * @param	VersionKey			FSemanticVersion::GetPrecedenceKey() of the version
+	 * @param	bIncludePreReleases	If false, pre-release versions are only contained if one of the bounds is a
+	 *								pre-release of the same [major, minor, patch] tuple (like in npm).
+	 */
+	bool Contains(const FSemanticVersion& Version, uint64 VersionKey, bool bIncludePreReleases) const;
+};
+
+/**
+ * A version range expression that is compiled into a list of version intervals, e.g.
+ * - "^1.2.3" -> [1.2.3, 2.0.0-0)
+ * - "~1.2 || >=3.0.0 <3.5" -> [1.2.0, 1.3.0-0), [3.0.0, 3.5.0-0)
+ *
+ * Supported syntax:
+ * - Primitive comparators: <, <=, >, >=, = (or no operator)
+ * - X-ranges: *, x, X or omitted components (e.g. "1.x", "1.2.*", "1")
+ * - Tilde ranges: ~1.2.3, ~1.2, ~1 (and ~>)
+ * - Caret ranges: ^1.2.3, ^0.2.3, ^0.0.3, ^1.x
+ * - Hyphen ranges: 1.2.3 - 2.3.4
+ * - Comparator sets are separated by whitespace (intersection) and combined with || (union).
+ *
+ * Satisfying a range is a check against the compiled intervals that is mostly decided by comparing the precedence
+ * keys of the versions, so ranges should be parsed once and reused.
+ * Build metadata is ignored for all comparisons.
+ */
+USTRUCT(BlueprintType)
+struct OUURUNTIME_API FSemVerRange
+{
+	GENERATED_BODY()
+public:
+	/** The default range is "*", which is satisfied by all versions (except pre-releases). */
+	FSemVerRange();
+
+	/**
+	 * Try to create a range from a range expression.
+	 * If the expression cannot be parsed, the range is not satisfied by any version.
+	 */
+	explicit FSemVerRange(const FString& SourceString);
+
+	/**
+	 * Try to set this range from a range expression.
+	 * If the expression cannot be parsed, the range is reset to an empty range that is not satisfied by any version.
+	 * @returns if parsing the range expression was successful
+	 */
+	bool TryParseString(const FString& SourceString);
+
+	/** @returns the expression this range was parsed from */
+	FString ToString() const;
+
+	/** @returns the compiled intervals. Empty intervals are removed during parsing. */
+	const TArray<FSemVerRangeInterval>& GetIntervals() const;
+
+	/** @returns if no version can satisfy this range */
+	bool IsEmpty() const;
+
+	/**
+	 * Is the version in this range?
+	 * @param	bIncludePreReleases		If false, pre-release versions only satisfy the range if a comparator of the
+	 *									same comparator set has a pre-release of the same [major, minor, patch] tuple.
+	 */
+	bool IsSatisfiedBy(const FSemanticVersion& Version, bool bIncludePreReleases = false) const;
+
+	/**
+	 * Resolve the highest version that satisfies this range.
+	 * @returns the index of the candidate with the highest precedence or INDEX_NONE if no candidate satisfies the range
+	 */
+	int32 FindMaxSatisfying(TConstArrayView<FSemanticVersion> Candidates, bool bIncludePreReleases = false) const;
+
+	void PostSerialize(const FArchive& Ar);
+
+	/**
+	 * Import the default struct text format (e.g. "(Expression=\"^1.2.3\")") or a quoted range expression
+	 * (e.g. "\"^1.2.3\"") and compile the intervals. Used by config files, copy-paste and the details panel.
+	 */
+	bool ImportTextItem(const TCHAR*& Buffer, int32 PortFlags, UObject* Parent, FOutputDevice* ErrorText);
+
+protected:
+	UPROPERTY(BlueprintReadOnly, Category = "OUU|Runtime|SemVer")
+	FString Expression;
+
+	// Compiled from Expression
+	TArray<FSemVerRangeInterval> Intervals;
+
+private:
+	bool IsSatisfiedBy_Internal(const FSemanticVersion& Version, uint64 VersionKey, bool bIncludePreReleases) const;
+};
+
+template <>
+struct TStructOpsTypeTraits<FSemVerRange> : public TStructOpsTypeTraitsBase2<FSemVerRange>
+{
+	enum
+	{
+		// Compile the intervals after loading or importing the expression
+		WithPostSerialize = true,
+		WithImportTextItem = true,
+	};
+};
@@ -4,6 +4,10 @@
 
 #include "SemVer/SemVerParsingStrictness.h"
 
+/**
+ * Regex patterns that define the grammar for each parsing strictness.
+ * Parsing itself uses the hand-written parser in SemVerParser.h, which accepts exactly the same strings.
+ */
 template <ESemVerParsingStrictness Strictness>
 struct TSemVerRegex
 {
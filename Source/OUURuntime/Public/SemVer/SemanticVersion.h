@@ -45,6 +45,9 @@ struct OUURUNTIME_API FSemanticVersion
 {
 	GENERATED_BODY()
 public:
+	/** Consistent with operator==(), i.e. includes the build metadata. */
+	friend OUURUNTIME_API uint32 GetTypeHash(const FSemanticVersion&);
+
 	/**
 	 * The default constructed SemVer has 0.1.0 as version because the SemVer spec
 	 * recommends using it for beginning a new version history.
@@ -120,6 +123,21 @@ public:
 	/** Increments the pre-release version, if it ends in digits */
 	bool TryIncrementPreReleaseVersion();
 
+	/**
+	 * Packed 64-bit key for fast precedence comparisons: [Major:20][Minor:18][Patch:18][PreReleaseRank:8]
+	 * Components that exceed their bit range are saturated, so the key never contradicts the full comparison:
+	 * If the key is lower than the key of the other version, this version has lower precedence.
+	 * Equal keys do not imply equal precedence, use the comparison operators for that.
+	 * Computed on demand, because all members are exposed for editing and serialization.
+	 */
+	uint64 GetPrecedenceKey() const;
+
+	/**
+	 * Sort versions ascending by precedence. Computes the precedence keys only once per version and falls back to
+	 * the full comparison only for versions with equal keys. Not stable.
+	 */
+	static void SortByPrecedence(TArray<FSemanticVersion>& Versions);
+
 	/**
 	 * @returns Is the precedence of the other version equal to this version.
 	 * Ignores the build metadata.
@@ -150,4 +168,16 @@ public:
 private:
 	bool TryParseString_Internal(const FString& SourceString, ESemVerParsingStrictness Strictness);
 	bool ComparePrecedence_Internal(const FSemanticVersion& Other, bool bSmallerThan) const;
+	bool ComparePrecedenceFull_Internal(const FSemanticVersion& Other, bool bSmallerThan) const;
+};
+
+OUURUNTIME_API uint32 GetTypeHash(const FSemanticVersion& Version);
+
+/**
+ * Predicate for ordering semantic versions by precedence, e.g. for TSortedMap, Algo::Sort or Algo::LowerBound.
+ * Versions that only differ in build metadata are equivalent for this predicate.
+ */
+struct FSemanticVersionPrecedenceLess
+{
+	FORCEINLINE bool operator()(const FSemanticVersion& A, const FSemanticVersion& B) const { return A < B; }
 };
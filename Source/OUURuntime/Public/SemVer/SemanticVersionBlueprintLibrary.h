@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "SemVer/SemVerRange.h"
 #include "SemVer/SemanticVersion.h"
 
 #include "SemanticVersionBlueprintLibrary.generated.h"
@@ -287,4 +288,53 @@ public:
 			 BlueprintAutocast),
 		Category = "Open Unreal Utilities|Semantic Versioning|Build Metadata")
 	static FString Conv_BuildMetadataString(const FSemVerBuildMetadata& InBuildMetadata);
+
+	//----------------------
+	// FSemVerRange
+	//----------------------
+
+	/**
+	 * Try to create a version range from a range expression like "^1.2.3" or ">=1.0.0 <2.0.0 || 3.x".
+	 * If the expression cannot be parsed, the range is not satisfied by any version.
+	 * @param	SourceString	The range expression
+	 * @param	OutRange		The resulting version range
+	 * @returns					if parsing was successful
+	 */
+	UFUNCTION(BlueprintPure, Category = "Open Unreal Utilities|Semantic Versioning|Range")
+	static bool TryParseSemVerRangeString(const FString& SourceString, FSemVerRange& OutRange);
+
+	/**
+	 * Is the version in the range?
+	 * @param	bIncludePreReleases		If false, pre-release versions only satisfy the range if it explicitly
+	 *									mentions a pre-release of the same major, minor and patch version.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Open Unreal Utilities|Semantic Versioning|Range")
+	static bool SemVerSatisfiesRange(
+		const FSemanticVersion& Version,
+		const FSemVerRange& Range,
+		bool bIncludePreReleases = false);
+
+	/**
+	 * Resolve the highest version that satisfies the range.
+	 * @param	Candidates			The versions to pick from
+	 * @param	OutVersion			The candidate with the highest precedence that satisfies the range
+	 * @returns						if any candidate satisfies the range
+	 */
+	UFUNCTION(BlueprintPure, Category = "Open Unreal Utilities|Semantic Versioning|Range")
+	static bool TryFindMaxSatisfyingSemVer(
+		const TArray<FSemanticVersion>& Candidates,
+		const FSemVerRange& Range,
+		bool bIncludePreReleases,
+		FSemanticVersion& OutVersion);
+
+	/** Convert a version range to the expression it was parsed from */
+	UFUNCTION(
+		BlueprintPure,
+		meta =
+			(DisplayName = "ToString (SemVer Range)",
+			 CompactNodeTitle = "->",
+			 Keywords = "cast convert",
+			 BlueprintAutocast),
+		Category = "Open Unreal Utilities|Semantic Versioning|Range")
+	static FString Conv_SemVerRangeString(const FSemVerRange& InRange);
 };
@@ -6,6 +6,7 @@
 
 #include "Misc/EngineVersionComparison.h"
 #include "SequentialFrameScheduler/SequentialFrameTask.h"
+#include "Templates/CircularQuantileAggregator.h"
 #include "Templates/RingAggregator.h"
 
 /**
@@ -155,7 +156,7 @@ protected:
 
 	// Store the delta times of last 60 frames to better predict delta time for next frame
 	static constexpr int32 NumFramesBufferSize = 60;
-	TFixedSizeCircularAggregator<float, NumFramesBufferSize> DeltaTimeRingBuffer;
+	TFixedSizeRunningCircularAggregator<float, NumFramesBufferSize> DeltaTimeRingBuffer;
 
 #if WITH_GAMEPLAY_DEBUGGER
 	struct FDebugData
@@ -168,11 +169,14 @@ protected:
 
 		// Various debugging metrics.
 		// Primarily used in gameplay debugger to show if the configuration of the scheduler is balanced appropriately.
-		TFixedSizeCircularAggregator<float, NumFramesBufferSize> MaxDelaySecondsRingBuffer;
-		TFixedSizeCircularAggregator<float, NumFramesBufferSize> AverageDelaySecondsRingBuffer;
-		TFixedSizeCircularAggregator<float, NumFramesBufferSize> MaxDelayFractionRingBuffer;
-		TFixedSizeCircularAggregator<float, NumFramesBufferSize> AverageDelayFractionRingBuffer;
-		TFixedSizeCircularAggregator<int32, NumFramesBufferSize> NumTasksExecutedRingBuffer;
+		TFixedSizeRunningCircularAggregator<float, NumFramesBufferSize> MaxDelaySecondsRingBuffer;
+		TFixedSizeRunningCircularAggregator<float, NumFramesBufferSize> AverageDelaySecondsRingBuffer;
+		TFixedSizeRunningCircularAggregator<float, NumFramesBufferSize> MaxDelayFractionRingBuffer;
+		TFixedSizeRunningCircularAggregator<float, NumFramesBufferSize> AverageDelayFractionRingBuffer;
+		TFixedSizeRunningCircularAggregator<int32, NumFramesBufferSize> NumTasksExecutedRingBuffer;
+
+		// Duration distribution of the last executed tasks in seconds (1us - 1s range).
+		TCircularQuantileAggregator<float> TaskDurationQuantiles{NumFramesBufferSize * 4, 1.e-6f, 1.f};
 
 		// Which tasks were actually executed in the last frames.
 		// TTuple: [TickCounter, TaskId, TimeBetweenUpdates, TaskDuration]
@@ -2,7 +2,12 @@
 
 #pragma once
 
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 #include "Containers/Array.h"
+#include "Templates/Less.h"
+
+#include <type_traits>
 
 namespace OUU::Runtime::ArrayUtils
 {
@@ -197,4 +202,397 @@ namespace OUU::Runtime::ArrayUtils
 
 		return TArray<ElementType, AllocatorType>(&SourceArray[StartIndex], EndIndex - StartIndex + 1);
 	}
+
+	//------------------------------------------------------------------------------------------------------------------
+	// Parallel algorithms
+	//------------------------------------------------------------------------------------------------------------------
+
+	/**
+	 * Default tuning parameters for the parallel algorithms below.
+	 * Tuned for cheap per-element functors (a few ns per element). Pass a lower sequential threshold for expensive
+	 * functors. See ArrayUtils.perf.cpp for a benchmark that shows the crossover point on the current machine.
+	 */
+	namespace ParallelDefaults
+	{
+		// Arrays with fewer elements are processed sequentially on the calling thread
+		constexpr int32 SequentialThreshold = 16 * 1024;
+
+		// Minimum number of elements processed by a single task
+		constexpr int32 MinChunkSize = 4 * 1024;
+
+		// Number of chunks per worker thread. More chunks improve load balancing for uneven per-element cost.
+		constexpr int32 ChunksPerWorker = 4;
+	} // namespace ParallelDefaults
+
+	/** Splits an index range into contiguous chunks that are processed by one ParallelFor iteration each. */
+	struct FParallelChunking
+	{
+		int32 Num = 0;
+		int32 NumChunks = 1;
+		int32 ChunkSize = 0;
+
+		FParallelChunking(
+			int32 InNum,
+			int32 SequentialThreshold = ParallelDefaults::SequentialThreshold,
+			int32 MinChunkSize = ParallelDefaults::MinChunkSize) :
+			Num(InNum)
+		{
+			if (Num >= SequentialThreshold && Num > 0)
+			{
+				// +1 for the calling thread, which participates in ParallelFor
+				const int32 NumWorkers = FTaskGraphInterface::IsRunning()
+					? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1
+					: 1;
+				const int32 MaxChunksBySize = FMath::DivideAndRoundUp(Num, FMath::Max(MinChunkSize, 1));
+				NumChunks = FMath::Clamp(NumWorkers * ParallelDefaults::ChunksPerWorker, 1, MaxChunksBySize);
+			}
+			ChunkSize = FMath::DivideAndRoundUp(FMath::Max(Num, 1), NumChunks);
+			// Rounding up the chunk size may leave trailing chunks empty
+			NumChunks = FMath::DivideAndRoundUp(FMath::Max(Num, 1), ChunkSize);
+		}
+
+		bool IsParallel() const { return NumChunks > 1; }
+		int32 GetChunkStart(int32 ChunkIdx) const { return ChunkIdx * ChunkSize; }
+		int32 GetChunkEnd(int32 ChunkIdx) const { return FMath::Min(Num, (ChunkIdx + 1) * ChunkSize); }
+
+		/** Call Body(ChunkIdx, StartIdx, EndIdx) for every chunk. Runs inline if there is only one chunk. */
+		template <typename BodyType>
+		void ForEachChunk(BodyType&& Body) const
+		{
+			if (!IsParallel())
+			{
+				Body(0, 0, Num);
+				return;
+			}
+
+			ParallelFor(NumChunks, [this, &Body](int32 ChunkIdx) {
+				Body(ChunkIdx, GetChunkStart(ChunkIdx), GetChunkEnd(ChunkIdx));
+			});
+		}
+	};
+
+	/**
+	 * Create a new array with the results of TransformFunc(Element) for every element of the source array.
+	 * Transformation is performed in parallel for big arrays, so TransformFunc must be thread-safe.
+	 */
+	template <typename ElementType, typename AllocatorType, typename TransformFuncType>
+	static auto ParallelTransform(
+		const TArray<ElementType, AllocatorType>& SourceArray,
+		TransformFuncType&& TransformFunc,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		using ResultElementType = std::decay_t<std::invoke_result_t<TransformFuncType, const ElementType&>>;
+
+		TArray<ResultElementType> Result;
+		Result.SetNumUninitialized(SourceArray.Num());
+
+		const ElementType* SourceData = SourceArray.GetData();
+		ResultElementType* ResultData = Result.GetData();
+		FParallelChunking(SourceArray.Num(), SequentialThreshold)
+			.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					new (ResultData + i) ResultElementType(TransformFunc(SourceData[i]));
+				}
+			});
+		return Result;
+	}
+
+	namespace Private
+	{
+		/**
+		 * Evaluate a predicate for all elements in parallel.
+		 * Writes the results into OutFlags and the number of matching elements per chunk into OutNumMatchesPerChunk.
+		 */
+		template <typename ElementType, typename PredicateType>
+		void EvaluatePredicateChunks(
+			const FParallelChunking& Chunking,
+			const ElementType* Data,
+			PredicateType& Predicate,
+			TArray<bool>& OutFlags,
+			TArray<int32>& OutNumMatchesPerChunk)
+		{
+			OutFlags.SetNumUninitialized(Chunking.Num);
+			OutNumMatchesPerChunk.SetNumZeroed(Chunking.NumChunks);
+			Chunking.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+				int32 NumMatches = 0;
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					const bool bMatches = !!Predicate(Data[i]);
+					OutFlags[i] = bMatches;
+					NumMatches += bMatches ? 1 : 0;
+				}
+				OutNumMatchesPerChunk[ChunkIdx] = NumMatches;
+			});
+		}
+
+		/** Turn per-chunk counts into exclusive prefix sums. Returns the total. */
+		inline int32 ExclusivePrefixSum(TArray<int32>& InOutCounts)
+		{
+			int32 Sum = 0;
+			for (int32& Count : InOutCounts)
+			{
+				const int32 ChunkCount = Count;
+				Count = Sum;
+				Sum += ChunkCount;
+			}
+			return Sum;
+		}
+
+		/**
+		 * Move or copy all elements into a new array, so that elements matching the predicate come first and both
+		 * groups retain their relative order. If bKeepNonMatching is false, non-matching elements are dropped.
+		 */
+		template <bool bMoveElements, typename ElementType, typename ResultArrayType, typename PredicateType>
+		int32 ParallelPartitionInto(
+			ElementType* SourceData,
+			int32 Num,
+			ResultArrayType& OutResult,
+			PredicateType& Predicate,
+			bool bKeepNonMatching,
+			int32 SequentialThreshold)
+		{
+			using ValueType = std::remove_const_t<ElementType>;
+			const FParallelChunking Chunking(Num, SequentialThreshold);
+
+			TArray<bool> Flags;
+			TArray<int32> MatchOffsets;
+			EvaluatePredicateChunks(Chunking, SourceData, Predicate, Flags, MatchOffsets);
+			const int32 NumMatches = ExclusivePrefixSum(MatchOffsets);
+
+			OutResult.Empty(bKeepNonMatching ? Num : NumMatches);
+			OutResult.SetNumUninitialized(bKeepNonMatching ? Num : NumMatches);
+			auto* ResultData = OutResult.GetData();
+
+			Chunking.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+				int32 MatchIdx = MatchOffsets[ChunkIdx];
+				// Non-matching elements before this chunk = elements before this chunk - matches before this chunk
+				int32 NonMatchIdx = NumMatches + StartIdx - MatchOffsets[ChunkIdx];
+				for (int32 i = StartIdx; i < EndIdx; i++)
+				{
+					int32 TargetIdx;
+					if (Flags[i])
+					{
+						TargetIdx = MatchIdx++;
+					}
+					else if (bKeepNonMatching)
+					{
+						TargetIdx = NonMatchIdx++;
+					}
+					else
+					{
+						continue;
+					}
+
+					if constexpr (bMoveElements)
+					{
+						new (ResultData + TargetIdx) ValueType(MoveTemp(SourceData[i]));
+					}
+					else
+					{
+						new (ResultData + TargetIdx) ValueType(SourceData[i]);
+					}
+				}
+			});
+			return NumMatches;
+		}
+	} // namespace Private
+
+	/**
+	 * Create a new array that contains copies of all elements for which the predicate returns true.
+	 * Order of elements is preserved. The predicate is evaluated exactly once per element (in parallel for big arrays).
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType>
+	static TArray<ElementType, AllocatorType> ParallelFilter(
+		const TArray<ElementType, AllocatorType>& SourceArray,
+		PredicateType&& Predicate,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		TArray<ElementType, AllocatorType> Result;
+		Private::ParallelPartitionInto<false>(
+			SourceArray.GetData(),
+			SourceArray.Num(),
+			Result,
+			Predicate,
+			false,
+			SequentialThreshold);
+		return Result;
+	}
+
+	/**
+	 * Remove all elements for which the predicate returns false. Order of the remaining elements is preserved.
+	 * Compacts in place without allocating a second array: Only the predicate is evaluated in parallel for big arrays.
+	 * The remaining elements are moved to the front in a single sequential pass, because the target range of one
+	 * chunk may overlap the source range of another chunk.
+	 * @returns the number of remaining elements
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType>
+	static int32 ParallelCompact(
+		TArray<ElementType, AllocatorType>& Array,
+		PredicateType&& Predicate,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		const FParallelChunking Chunking(Array.Num(), SequentialThreshold);
+
+		TArray<bool> Flags;
+		TArray<int32> NumMatchesPerChunk;
+		Private::EvaluatePredicateChunks(Chunking, Array.GetData(), Predicate, Flags, NumMatchesPerChunk);
+
+		ElementType* Data = Array.GetData();
+		int32 NumKept = 0;
+		for (int32 i = 0; i < Array.Num(); i++)
+		{
+			if (!Flags[i])
+				continue;
+
+			if (NumKept != i)
+			{
+				Data[NumKept] = MoveTemp(Data[i]);
+			}
+			NumKept++;
+		}
+		Array.SetNum(NumKept, EAllowShrinking::No);
+		return NumKept;
+	}
+
+	/**
+	 * Reorder the array so that all elements for which the predicate returns true precede the ones for which it
+	 * returns false. Relative order within both groups is preserved.
+	 * @returns the number of elements for which the predicate returned true (= index of the first element of the
+	 * second group)
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType>
+	static int32 ParallelStablePartition(
+		TArray<ElementType, AllocatorType>& Array,
+		PredicateType&& Predicate,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		TArray<ElementType, AllocatorType> Result;
+		const int32 NumMatches = Private::ParallelPartitionInto<true>(
+			Array.GetData(),
+			Array.Num(),
+			Result,
+			Predicate,
+			true,
+			SequentialThreshold);
+		Array = MoveTemp(Result);
+		return NumMatches;
+	}
+
+	/**
+	 * Transform all elements and combine the results with an associative reduce operation.
+	 * Every chunk starts its own partial result with Identity, so Identity must be the identity element of ReduceFunc
+	 * (e.g. 0 for sums). Partial results are combined in chunk order, so the result is deterministic for the same
+	 * machine, but floating point results may differ slightly from a sequential reduction.
+	 */
+	template <
+		typename ElementType,
+		typename AllocatorType,
+		typename ResultType,
+		typename TransformFuncType,
+		typename ReduceFuncType>
+	static ResultType ParallelTransformReduce(
+		const TArray<ElementType, AllocatorType>& Array,
+		ResultType Identity,
+		TransformFuncType&& TransformFunc,
+		ReduceFuncType&& ReduceFunc,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		const FParallelChunking Chunking(Array.Num(), SequentialThreshold);
+		TArray<ResultType, TInlineAllocator<64>> PartialResults;
+		PartialResults.Init(Identity, Chunking.NumChunks);
+
+		const ElementType* Data = Array.GetData();
+		Chunking.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+			ResultType Partial = Identity;
+			for (int32 i = StartIdx; i < EndIdx; i++)
+			{
+				Partial = ReduceFunc(MoveTemp(Partial), TransformFunc(Data[i]));
+			}
+			PartialResults[ChunkIdx] = MoveTemp(Partial);
+		});
+
+		ResultType Result = MoveTemp(Identity);
+		for (ResultType& Partial : PartialResults)
+		{
+			Result = ReduceFunc(MoveTemp(Result), MoveTemp(Partial));
+		}
+		return Result;
+	}
+
+	/** Combine all elements with an associative reduce operation. See ParallelTransformReduce(). */
+	template <typename ElementType, typename AllocatorType, typename ResultType, typename ReduceFuncType>
+	static ResultType ParallelReduce(
+		const TArray<ElementType, AllocatorType>& Array,
+		ResultType Identity,
+		ReduceFuncType&& ReduceFunc,
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		return ParallelTransformReduce(
+			Array,
+			MoveTemp(Identity),
+			[](const ElementType& Element) -> const ElementType& { return Element; },
+			ReduceFunc,
+			SequentialThreshold);
+	}
+
+	/**
+	 * Get the index of the smallest element according to the predicate.
+	 * If there are multiple smallest elements, the index of the first one is returned (same as std::min_element).
+	 * @returns INDEX_NONE if the array is empty
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType = TLess<>>
+	static int32 ParallelMinElementIndex(
+		const TArray<ElementType, AllocatorType>& Array,
+		PredicateType&& Less = PredicateType(),
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		const FParallelChunking Chunking(Array.Num(), SequentialThreshold);
+		TArray<int32, TInlineAllocator<64>> PartialResults;
+		PartialResults.Init(INDEX_NONE, Chunking.NumChunks);
+
+		const ElementType* Data = Array.GetData();
+		Chunking.ForEachChunk([&](int32 ChunkIdx, int32 StartIdx, int32 EndIdx) {
+			if (StartIdx >= EndIdx)
+				return;
+
+			int32 MinIdx = StartIdx;
+			for (int32 i = StartIdx + 1; i < EndIdx; i++)
+			{
+				if (Less(Data[i], Data[MinIdx]))
+				{
+					MinIdx = i;
+				}
+			}
+			PartialResults[ChunkIdx] = MinIdx;
+		});
+
+		// Chunks are in index order, so strict comparison keeps the first of equal elements
+		int32 Result = INDEX_NONE;
+		for (const int32 PartialIdx : PartialResults)
+		{
+			if (PartialIdx != INDEX_NONE && (Result == INDEX_NONE || Less(Data[PartialIdx], Data[Result])))
+			{
+				Result = PartialIdx;
+			}
+		}
+		return Result;
+	}
+
+	/**
+	 * Get the index of the biggest element according to the predicate.
+	 * If there are multiple biggest elements, the index of the first one is returned (same as std::max_element).
+	 * @returns INDEX_NONE if the array is empty
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType = TLess<>>
+	static int32 ParallelMaxElementIndex(
+		const TArray<ElementType, AllocatorType>& Array,
+		PredicateType&& Less = PredicateType(),
+		int32 SequentialThreshold = ParallelDefaults::SequentialThreshold)
+	{
+		return ParallelMinElementIndex(
+			Array,
+			[&Less](const ElementType& A, const ElementType& B) { return Less(B, A); },
+			SequentialThreshold);
+	}
 }; // namespace OUU::Runtime::ArrayUtils
@@ -291,3 +291,341 @@ namespace OUU::Runtime::Private::BitmaskUtils
 		x = x ^ y;                                                                                                     \
 		return x;                                                                                                      \
 	}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Enum bitsets
+//---------------------------------------------------------------------------------------------------------------------
+
+/**
+ * Trait that determines the number of bits required for a TEnumBitset of a natural sequence enum.
+ * By default the value of an EnumType::MAX case is used if the enum has one.
+ * For all other enums, declare the size with DECLARE_ENUM_BITSET_SIZE().
+ */
+template <class EnumType, typename = void>
+struct TEnumBitsetSize
+{
+	static constexpr int32 Value = 0;
+};
+
+template <class EnumType>
+struct TEnumBitsetSize<EnumType, std::void_t<decltype(EnumType::MAX)>>
+{
+	static constexpr int32 Value = static_cast<int32>(EnumType::MAX);
+};
+
+/** Macro to define the number of bits required for a TEnumBitset of an enum in a single line */
+#define DECLARE_ENUM_BITSET_SIZE(EnumClass, NumValues)                                                                 \
+	template <>                                                                                                        \
+	struct TEnumBitsetSize<EnumClass>                                                                                  \
+	{                                                                                                                  \
+		static constexpr int32 Value = NumValues;                                                                      \
+	};
+
+namespace OUU::Runtime::Private::BitmaskUtils
+{
+	/** constexpr population count. Compilers recognize the pattern and emit popcnt instructions where available. */
+	constexpr int32 CountBits(uint64 Word)
+	{
+		Word = Word - ((Word >> 1) & 0x5555555555555555ull);
+		Word = (Word & 0x3333333333333333ull) + ((Word >> 2) & 0x3333333333333333ull);
+		Word = (Word + (Word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+		return static_cast<int32>((Word * 0x0101010101010101ull) >> 56);
+	}
+} // namespace OUU::Runtime::Private::BitmaskUtils
+
+/**
+ * Fixed size set of enum values of natural sequence enums (see EEnumSequenceType::Natural) stored as a bitset.
+ * Supports enums with more than 64 cases, which can't be stored in a single integer bitmask.
+ *
+ * All modifying and testing operations are constexpr, set operations work on whole 64-bit words at once and
+ * iteration only visits set members via find-first-set.
+ * All enum values passed to the bitset must be in the range [0, NumBits).
+ * The bitset is trivially copyable and hashable, so it can be used as compact map key for queries.
+ *
+ * Example:
+ *     TEnumBitset<EAbilityTag> Tags{EAbilityTag::Fire, EAbilityTag::Ranged};
+ *     if (Tags.ContainsAll(RequiredTags)) { ... }
+ *     for (EAbilityTag Tag : Tags) { ... }
+ */
+template <class InEnumType, int32 InNumBits = TEnumBitsetSize<InEnumType>::Value>
+class TEnumBitset
+{
+public:
+	using EnumType = InEnumType;
+	using WordType = uint64;
+
+	static_assert(TIsEnum<EnumType>::Value, "EnumType must be an enum or enum class");
+	static_assert(
+		TEnumSequenceTraits<EnumType>::Type != EEnumSequenceType::Pow2,
+		"TEnumBitset requires natural sequence enums. Use regular bitmasks for Pow2 enums.");
+	static_assert(
+		InNumBits > 0,
+		"Number of bits could not be determined for EnumType. Either add a MAX case to the enum, declare the size via "
+		"DECLARE_ENUM_BITSET_SIZE() or pass it as template parameter.");
+
+	static constexpr int32 NumBits = InNumBits;
+	static constexpr int32 BitsPerWord = sizeof(WordType) * 8;
+	static constexpr int32 NumWords = (NumBits + BitsPerWord - 1) / BitsPerWord;
+
+	/** Iterates over all enum values contained in the set in ascending order */
+	class FIterator
+	{
+	public:
+		constexpr FIterator(const TEnumBitset& InBitset, int32 InWordIndex) :
+			Bitset(InBitset), WordIndex(InWordIndex), RemainingBits(0)
+		{
+			if (WordIndex < NumWords)
+			{
+				RemainingBits = Bitset.Words[WordIndex];
+				SkipEmptyWords();
+			}
+		}
+
+		EnumType operator*() const
+		{
+			return static_cast<EnumType>(
+				WordIndex * BitsPerWord + static_cast<int32>(FPlatformMath::CountTrailingZeros64(RemainingBits)));
+		}
+
+		FIterator& operator++()
+		{
+			// Clear lowest set bit
+			RemainingBits &= RemainingBits - 1;
+			SkipEmptyWords();
+			return *this;
+		}
+
+		bool operator==(const FIterator& Other) const
+		{
+			return WordIndex == Other.WordIndex && RemainingBits == Other.RemainingBits;
+		}
+		bool operator!=(const FIterator& Other) const { return !(*this == Other); }
+
+	private:
+		const TEnumBitset& Bitset;
+		int32 WordIndex;
+		WordType RemainingBits;
+
+		constexpr void SkipEmptyWords()
+		{
+			while (RemainingBits == 0 && ++WordIndex < NumWords)
+			{
+				RemainingBits = Bitset.Words[WordIndex];
+			}
+		}
+	};
+
+	constexpr TEnumBitset() = default;
+
+	constexpr TEnumBitset(std::initializer_list<EnumType> EnumValues)
+	{
+		for (EnumType Value : EnumValues)
+		{
+			Add(Value);
+		}
+	}
+
+	/** Create a bitset that contains all values of the enum */
+	static constexpr TEnumBitset All()
+	{
+		TEnumBitset Result;
+		for (WordType& Word : Result.Words)
+		{
+			Word = ~WordType(0);
+		}
+		Result.ClearUnusedBits();
+		return Result;
+	}
+
+	constexpr void Add(EnumType Value)
+	{
+		CheckIndex(Value);
+		Words[GetWordIndex(Value)] |= GetBitMask(Value);
+	}
+
+	constexpr void Remove(EnumType Value)
+	{
+		CheckIndex(Value);
+		Words[GetWordIndex(Value)] &= ~GetBitMask(Value);
+	}
+
+	constexpr void Set(EnumType Value, bool bContained)
+	{
+		if (bContained)
+		{
+			Add(Value);
+		}
+		else
+		{
+			Remove(Value);
+		}
+	}
+
+	constexpr void Reset()
+	{
+		for (WordType& Word : Words)
+		{
+			Word = 0;
+		}
+	}
+
+	constexpr bool Contains(EnumType Value) const
+	{
+		CheckIndex(Value);
+		return (Words[GetWordIndex(Value)] & GetBitMask(Value)) != 0;
+	}
+
+	/** Does this set contain all values of the other set? */
+	constexpr bool ContainsAll(const TEnumBitset& Other) const
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			if ((Words[i] & Other.Words[i]) != Other.Words[i])
+				return false;
+		}
+		return true;
+	}
+
+	/** Does this set contain any value of the other set? */
+	constexpr bool ContainsAny(const TEnumBitset& Other) const
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			if ((Words[i] & Other.Words[i]) != 0)
+				return true;
+		}
+		return false;
+	}
+
+	constexpr bool IsEmpty() const
+	{
+		for (const WordType Word : Words)
+		{
+			if (Word != 0)
+				return false;
+		}
+		return true;
+	}
+
+	/** Number of enum values contained in the set */
+	constexpr int32 Num() const
+	{
+		int32 Result = 0;
+		for (const WordType Word : Words)
+		{
+			Result += OUU::Runtime::Private::BitmaskUtils::CountBits(Word);
+		}
+		return Result;
+	}
+
+	/** Get the numerically smallest enum value in the set as integer or INDEX_NONE if the set is empty */
+	int32 FindFirstIndex() const
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			if (Words[i] != 0)
+				return i * BitsPerWord + static_cast<int32>(FPlatformMath::CountTrailingZeros64(Words[i]));
+		}
+		return INDEX_NONE;
+	}
+
+	// -- Word-parallel set operations
+
+	constexpr TEnumBitset& operator|=(const TEnumBitset& Other)
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			Words[i] |= Other.Words[i];
+		}
+		return *this;
+	}
+
+	constexpr TEnumBitset& operator&=(const TEnumBitset& Other)
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			Words[i] &= Other.Words[i];
+		}
+		return *this;
+	}
+
+	constexpr TEnumBitset& operator^=(const TEnumBitset& Other)
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			Words[i] ^= Other.Words[i];
+		}
+		return *this;
+	}
+
+	/** Remove all values contained in the other set */
+	constexpr TEnumBitset& operator-=(const TEnumBitset& Other)
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			Words[i] &= ~Other.Words[i];
+		}
+		return *this;
+	}
+
+	constexpr TEnumBitset operator~() const
+	{
+		TEnumBitset Result;
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			Result.Words[i] = ~Words[i];
+		}
+		Result.ClearUnusedBits();
+		return Result;
+	}
+
+	friend constexpr TEnumBitset operator|(TEnumBitset A, const TEnumBitset& B) { return A |= B; }
+	friend constexpr TEnumBitset operator&(TEnumBitset A, const TEnumBitset& B) { return A &= B; }
+	friend constexpr TEnumBitset operator^(TEnumBitset A, const TEnumBitset& B) { return A ^= B; }
+	friend constexpr TEnumBitset operator-(TEnumBitset A, const TEnumBitset& B) { return A -= B; }
+
+	friend constexpr bool operator==(const TEnumBitset& A, const TEnumBitset& B)
+	{
+		for (int32 i = 0; i < NumWords; i++)
+		{
+			if (A.Words[i] != B.Words[i])
+				return false;
+		}
+		return true;
+	}
+	friend constexpr bool operator!=(const TEnumBitset& A, const TEnumBitset& B) { return !(A == B); }
+
+	friend uint32 GetTypeHash(const TEnumBitset& Bitset)
+	{
+		uint32 Hash = ::GetTypeHash(Bitset.Words[0]);
+		for (int32 i = 1; i < NumWords; i++)
+		{
+			Hash = HashCombine(Hash, ::GetTypeHash(Bitset.Words[i]));
+		}
+		return Hash;
+	}
+
+	FIterator begin() const { return FIterator(*this, 0); }
+	FIterator end() const { return FIterator(*this, NumWords); }
+
+	/** Raw access to the underlying words. Bit N of the set is bit (N % 64) in word (N / 64). */
+	constexpr const WordType* GetWords() const { return Words; }
+
+private:
+	WordType Words[NumWords] = {};
+
+	static constexpr int32 GetIndex(EnumType Value) { return static_cast<int32>(Value); }
+	static constexpr int32 GetWordIndex(EnumType Value) { return GetIndex(Value) / BitsPerWord; }
+	static constexpr WordType GetBitMask(EnumType Value) { return WordType(1) << (GetIndex(Value) % BitsPerWord); }
+
+	// Values outside of the enum sequence would silently write past Words or alias bits of other values
+	static constexpr void CheckIndex(EnumType Value) { checkSlow(GetIndex(Value) >= 0 && GetIndex(Value) < NumBits); }
+
+	constexpr void ClearUnusedBits()
+	{
+		if constexpr (NumBits % BitsPerWord != 0)
+		{
+			Words[NumWords - 1] &= (WordType(1) << (NumBits % BitsPerWord)) - 1;
+		}
+	}
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "IteratorUtils.h"
+#include "Templates/InterfaceUtils.h"
 #include "Traits/ConditionalType.h"
 #include "Traits/IteratorTraits.h"
 
@@ -30,7 +31,18 @@ public:
 	constexpr TCastObjectIterator() : WrappedIterator() {}
 	constexpr explicit TCastObjectIterator(IteratorType It) : WrappedIterator(It) {}
 
-	constexpr CastElementType* operator*() const { return Cast<CastElementType>(*WrappedIterator); }
+	constexpr CastElementType* operator*() const
+	{
+		if constexpr (TIsIInterface<CastTargetType>::Value)
+		{
+			// Interface casts walk the class hierarchy, so use the cached lookup instead
+			return OUU::Runtime::InterfaceUtils::CastToInterface<CastElementType>(*WrappedIterator);
+		}
+		else
+		{
+			return Cast<CastElementType>(*WrappedIterator);
+		}
+	}
 
 	// preincrement
 	constexpr TCastObjectIterator& operator++()
@@ -6,6 +6,7 @@
 #include "Algo/MinElement.h"
 #include "CircularArrayAdaptor.h"
 #include "Containers/Array.h"
+#include "Templates/IsFloatingPoint.h"
 #include "Traits/IsInteger.h"
 
 /**
@@ -121,3 +122,241 @@ public:
 	TFixedSizeCircularAggregator() : Super(ElementNum) {}
 	// no constructor with MaxNum parameter, because it's a compile time constant ("ElementNum")
 };
+
+namespace OUU::Runtime::Private
+{
+	/**
+	 * Monotonic deque over the last N values of a stream that allows querying the min/max value of the window in
+	 * O(1) with amortized O(1) insertion.
+	 * The deque never holds more than N entries, so it's stored in a ring with the same allocator as the aggregator.
+	 */
+	template <typename ElementType, typename AllocatorType, typename PredicateType>
+	class TMonotonicWindowDeque
+	{
+	public:
+		struct FEntry
+		{
+			int64 SequenceIndex = 0;
+			ElementType Value = {};
+		};
+
+		explicit TMonotonicWindowDeque(int32 InWindowSize) : WindowSize(InWindowSize)
+		{
+			Entries.SetNum(WindowSize);
+		}
+
+		/** Add a value with a sequence index that must be greater than the one of all previously added values. */
+		void Add(int64 SequenceIndex, ElementType Value)
+		{
+			// Evict entries that left the window.
+			// This must happen before adding the new entry, so the ring can never overflow.
+			const int64 OldestSequenceIndexInWindow = SequenceIndex - WindowSize + 1;
+			while (Count > 0 && Front().SequenceIndex < OldestSequenceIndexInWindow)
+			{
+				Head = WrapIndex(Head + 1);
+				--Count;
+			}
+
+			// Evict all entries that are dominated by the new value. They can never become the extreme value again.
+			while (Count > 0 && !PredicateType()(Back().Value, Value))
+			{
+				--Count;
+			}
+			Entries[WrapIndex(Head + Count)] = FEntry{SequenceIndex, Value};
+			++Count;
+		}
+
+		bool HasData() const { return Count > 0; }
+
+		const ElementType& GetExtremeValue() const
+		{
+			check(HasData());
+			return Front().Value;
+		}
+
+		void Reset()
+		{
+			Head = 0;
+			Count = 0;
+		}
+
+	private:
+		TArray<FEntry, AllocatorType> Entries;
+		int32 WindowSize = 0;
+		int32 Head = 0;
+		int32 Count = 0;
+
+		int32 WrapIndex(int32 Index) const { return Index >= WindowSize ? Index - WindowSize : Index; }
+		const FEntry& Front() const { return Entries[Head]; }
+		const FEntry& Back() const { return Entries[WrapIndex(Head + Count - 1)]; }
+	};
+
+	template <typename ElementType>
+	struct TStrictlyGreater
+	{
+		bool operator()(const ElementType& A, const ElementType& B) const { return A > B; }
+	};
+
+	template <typename ElementType>
+	struct TStrictlyLess
+	{
+		bool operator()(const ElementType& A, const ElementType& B) const { return A < B; }
+	};
+} // namespace OUU::Runtime::Private
+
+/**
+ * Circular aggregator that updates its statistics incrementally on Add(), so Sum(), Average(), Max() and Min() are
+ * O(1) instead of iterating the whole buffer on every call.
+ * - Sums of floating point values use Kahan compensation and are re-synchronized from the buffer every time
+ *   the write index wraps around, so there is no drift over long runs.
+ * - Min/Max use monotonic deques over the window (amortized O(1) per Add).
+ * Elements can only be modified via Add(), so there is no mutable element access.
+ */
+template <class InChildClass, typename InElementType, typename InAllocatorType>
+class TRunningCircularAggregator_Base :
+	// Protected, so the base's Add() and mutable element access can't bypass the running statistics
+	protected TCircularAggregator_Base<InChildClass, InElementType, InAllocatorType>
+{
+public:
+	using ChildClass = InChildClass;
+	using ElementType = InElementType;
+	using AllocatorType = InAllocatorType;
+	using Super = TCircularAggregator_Base<ChildClass, ElementType, AllocatorType>;
+	using SizeType = typename Super::SizeType;
+
+	explicit TRunningCircularAggregator_Base(int32 MaxNum) :
+		Super(MaxNum), MaxDeque(MaxNum), MinDeque(MaxNum)
+	{
+	}
+	TRunningCircularAggregator_Base() : TRunningCircularAggregator_Base(32) {}
+
+	void Add(ElementType Element)
+	{
+		if (!Super::IsPreWrap())
+		{
+			// Element at the write index is the oldest one that is about to be overwritten
+			SubtractFromRunningSum(Super::GetStorage()[Super::WriteIndex]);
+		}
+
+		Super::Add(Element);
+		AddToRunningSum(Element);
+
+		MaxDeque.Add(NumAddedTotal, Element);
+		MinDeque.Add(NumAddedTotal, Element);
+		++NumAddedTotal;
+
+		if constexpr (TIsFloatingPoint<ElementType>::Value)
+		{
+			if (Super::WriteIndex == 0)
+			{
+				// Resync once per full cycle, which keeps this amortized O(1)
+				RunningSum = Super::Sum();
+				RunningSumCompensation = 0;
+			}
+		}
+	}
+
+	void Reset()
+	{
+		Super::Reset();
+		RunningSum = 0;
+		RunningSumCompensation = 0;
+		NumAddedTotal = 0;
+		MaxDeque.Reset();
+		MinDeque.Reset();
+	}
+
+	ElementType Sum() const { return RunningSum; }
+
+	ElementType Average() const { return Super::HasData() ? (Sum() / Super::Num()) : 0; }
+
+	ElementType Max() const { return MaxDeque.HasData() ? MaxDeque.GetExtremeValue() : 0; }
+
+	ElementType Min() const { return MinDeque.HasData() ? MinDeque.GetExtremeValue() : 0; }
+
+	// Only allow const element access. Modifying elements directly would invalidate the running statistics.
+	const ElementType& operator[](SizeType Index) const { return Super::operator[](Index); }
+
+	using TConstIterator = typename Super::TConstIterator;
+	FORCEINLINE TConstIterator begin() const { return Super::begin(); }
+	FORCEINLINE TConstIterator end() const { return Super::end(); }
+
+	// Read-only accessors of the base classes
+	using Super::GetContiguousViews;
+	using Super::GetStorage;
+	using Super::HasData;
+	using Super::IsValidIndex;
+	using Super::Last;
+	using Super::Num;
+	using Super::Oldest;
+
+private:
+	ElementType RunningSum = 0;
+	ElementType RunningSumCompensation = 0;
+	int64 NumAddedTotal = 0;
+
+	OUU::Runtime::Private::
+		TMonotonicWindowDeque<ElementType, AllocatorType, OUU::Runtime::Private::TStrictlyGreater<ElementType>>
+			MaxDeque;
+	OUU::Runtime::Private::
+		TMonotonicWindowDeque<ElementType, AllocatorType, OUU::Runtime::Private::TStrictlyLess<ElementType>>
+			MinDeque;
+
+	void AddToRunningSum(ElementType Value)
+	{
+		if constexpr (TIsFloatingPoint<ElementType>::Value)
+		{
+			// Kahan summation
+			const ElementType Y = Value - RunningSumCompensation;
+			const ElementType T = RunningSum + Y;
+			RunningSumCompensation = (T - RunningSum) - Y;
+			RunningSum = T;
+		}
+		else
+		{
+			Super::template AddNumbersEnsured<ElementType>(RunningSum, Value);
+		}
+	}
+
+	void SubtractFromRunningSum(ElementType Value)
+	{
+		if constexpr (TIsFloatingPoint<ElementType>::Value)
+		{
+			AddToRunningSum(-Value);
+		}
+		else
+		{
+			// Removing a value that was already part of the sum can't overflow
+			RunningSum -= Value;
+		}
+	}
+};
+
+/** Running circular aggregator that can be initialized with different size depending on dynamic conditions */
+template <typename ElementType>
+class TRunningCircularAggregator :
+	public TRunningCircularAggregator_Base<TRunningCircularAggregator<ElementType>, ElementType, FDefaultAllocator>
+{
+public:
+	using Super =
+		TRunningCircularAggregator_Base<TRunningCircularAggregator<ElementType>, ElementType, FDefaultAllocator>;
+	TRunningCircularAggregator() = default;
+	explicit TRunningCircularAggregator(int32 MaxNum) : Super(MaxNum) {}
+};
+
+/** Running circular aggregator that has a compile time fixed size of elements */
+template <typename ElementType, uint32 ElementNum>
+class TFixedSizeRunningCircularAggregator :
+	public TRunningCircularAggregator_Base<
+		TFixedSizeRunningCircularAggregator<ElementType, ElementNum>,
+		ElementType,
+		TFixedAllocator<ElementNum>>
+{
+public:
+	using Super = TRunningCircularAggregator_Base<
+		TFixedSizeRunningCircularAggregator<ElementType, ElementNum>,
+		ElementType,
+		TFixedAllocator<ElementNum>>;
+	TFixedSizeRunningCircularAggregator() : Super(ElementNum) {}
+	// no constructor with MaxNum parameter, because it's a compile time constant ("ElementNum")
+};
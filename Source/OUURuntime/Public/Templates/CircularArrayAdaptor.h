@@ -3,8 +3,34 @@
 #pragma once
 
 #include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "Math/UnrealMathUtility.h"
 #include "ReferenceWrapper.h"
 
+/**
+ * Contents of a circular array as (at most) two contiguous memory ranges in chronological order.
+ * Allows bulk operations (memcpy, vectorized reductions, etc) on the contents instead of element-wise access.
+ */
+template <typename ElementType>
+struct TCircularArrayViews
+{
+	// Older elements. Empty if the circular array has no data.
+	TArrayView<const ElementType> First;
+	// Newer elements. Empty if the circular array did not wrap around yet (or the write index is at the start).
+	TArrayView<const ElementType> Second;
+
+	int32 Num() const { return First.Num() + Second.Num(); }
+
+	/** Append all elements in chronological order */
+	template <typename AllocatorType>
+	void AppendTo(TArray<ElementType, AllocatorType>& OutArray) const
+	{
+		OutArray.Reserve(OutArray.Num() + Num());
+		OutArray.Append(First.GetData(), First.Num());
+		OutArray.Append(Second.GetData(), Second.Num());
+	}
+};
+
 template <class ChildClass, typename ElementType, typename AllocatorType>
 class TCircularArrayAdaptor_Base
 {
@@ -86,6 +112,19 @@ public:
 		WriteIndex = 0;
 	}
 
+	/** Get the contents as (at most) two contiguous views in chronological order. */
+	TCircularArrayViews<ElementType> GetContiguousViews() const
+	{
+		const ArrayType& Storage = GetStorage();
+		if (IsPreWrap())
+		{
+			return {TArrayView<const ElementType>(Storage.GetData(), Storage.Num()), {}};
+		}
+		return {
+			TArrayView<const ElementType>(Storage.GetData() + WriteIndex, Storage.Num() - WriteIndex),
+			TArrayView<const ElementType>(Storage.GetData(), WriteIndex)};
+	}
+
 	// Iterators
 	using TIterator = TIndexedContainerIterator<TCircularArrayAdaptor_Base, ElementType, SizeType>;
 	using TConstIterator = TIndexedContainerIterator<const TCircularArrayAdaptor_Base, const ElementType, SizeType>;
@@ -168,3 +207,112 @@ public:
 private:
 	ArrayType Storage;
 };
+
+/**
+ * Circular array with a power-of-two capacity.
+ * In contrast to TCircularArrayAdaptor_Base derived types all index wrapping is done with a bit mask instead of
+ * modulo / branches and the storage is owned directly (no reference wrapper indirection).
+ * Use GetContiguousViews() for bulk access.
+ */
+template <typename InElementType, typename InAllocatorType = FDefaultAllocator>
+class TMaskedCircularArray
+{
+public:
+	using ElementType = InElementType;
+	using AllocatorType = InAllocatorType;
+	using SizeType = typename AllocatorType::SizeType;
+	using ArrayType = TArray<ElementType, AllocatorType>;
+
+	/** @param	MinCapacity		Capacity is rounded up to the next power of two */
+	explicit TMaskedCircularArray(uint32 MinCapacity = 32) :
+		Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(MinCapacity, 1))), Mask(Capacity - 1)
+	{
+		Storage.Reserve(Capacity);
+	}
+
+	void Add(ElementType Element)
+	{
+		if (IsPreWrap())
+		{
+			Storage.Add(MoveTemp(Element));
+		}
+		else
+		{
+			Storage[WriteCount & Mask] = MoveTemp(Element);
+		}
+		++WriteCount;
+	}
+
+	SizeType Num() const { return Storage.Num(); }
+
+	bool HasData() const { return Num() > 0; }
+
+	uint32 GetCapacity() const { return Capacity; }
+
+	const ElementType& Last() const
+	{
+		check(HasData());
+		return Storage[(WriteCount - 1) & Mask];
+	}
+
+	const ElementType& Oldest() const
+	{
+		check(HasData());
+		return Storage[GetStartIndex()];
+	}
+
+	bool IsValidIndex(SizeType Index) const { return Storage.IsValidIndex(Index); }
+
+	/** Access elements in chronological order (0 = oldest) */
+	ElementType& operator[](SizeType Index) { return Storage[GetStorageIndex(Index)]; }
+	const ElementType& operator[](SizeType Index) const { return Storage[GetStorageIndex(Index)]; }
+
+	void Reset()
+	{
+		Storage.Reset();
+		WriteCount = 0;
+	}
+
+	/** Get the contents as (at most) two contiguous views in chronological order. */
+	TCircularArrayViews<ElementType> GetContiguousViews() const
+	{
+		const uint32 StartIndex = GetStartIndex();
+		return {
+			TArrayView<const ElementType>(Storage.GetData() + StartIndex, Storage.Num() - StartIndex),
+			TArrayView<const ElementType>(Storage.GetData(), StartIndex)};
+	}
+
+	/** Underlying storage in write order. Not chronological after wrap-around. */
+	const ArrayType& GetStorage() const { return Storage; }
+
+	// Iterators
+	using TIterator = TIndexedContainerIterator<TMaskedCircularArray, ElementType, SizeType>;
+	using TConstIterator = TIndexedContainerIterator<const TMaskedCircularArray, const ElementType, SizeType>;
+
+	FORCEINLINE TIterator begin() { return TIterator(*this, 0); }
+	FORCEINLINE TConstIterator begin() const { return TConstIterator(*this, 0); }
+	FORCEINLINE TIterator end() { return TIterator(*this, Num()); }
+	FORCEINLINE TConstIterator end() const { return TConstIterator(*this, Num()); }
+
+private:
+	ArrayType Storage;
+	uint32 Capacity;
+	uint32 Mask;
+	// Total number of elements written. Only the lower bits are used as index.
+	uint32 WriteCount = 0;
+
+	bool IsPreWrap() const { return static_cast<uint32>(Num()) < Capacity; }
+
+	uint32 GetStartIndex() const { return IsPreWrap() ? 0 : (WriteCount & Mask); }
+
+	SizeType GetStorageIndex(SizeType Index) const
+	{
+		checkf(
+			Storage.IsValidIndex(Index),
+			TEXT("%i is an invalid index for storage with size %i. "
+				 "You must stick to indices >= 0 and < Num just like with regular arrays!"),
+			Index,
+			Num());
+		return (GetStartIndex() + Index) & Mask;
+	}
+};
@@ -0,0 +1,208 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CircularArrayAdaptor.h"
+#include "Containers/Array.h"
+#include "Math/UnrealMathUtility.h"
+
+/**
+ * Histogram with logarithmically sized buckets between a min and max value.
+ * Values below the min / above the max value are collected in dedicated underflow / overflow buckets.
+ * Quantiles computed from the histogram have a bounded relative error (see GetMaxRelativeError()) as long as the
+ * values are within the [MinValue, MaxValue] range.
+ * Histograms with the same layout can be merged, e.g. to combine stats collected on multiple threads.
+ */
+template <typename InElementType>
+class TLogHistogram
+{
+public:
+	using ElementType = InElementType;
+
+	TLogHistogram(ElementType InMinValue, ElementType InMaxValue, int32 InNumBuckets) :
+		MinValue(InMinValue), MaxValue(InMaxValue), NumBuckets(InNumBuckets)
+	{
+		checkf(MinValue > 0, TEXT("Log histogram requires a positive min value"));
+		check(MaxValue > MinValue);
+		check(NumBuckets > 0);
+
+		const double LogRange = FMath::Loge(static_cast<double>(MaxValue) / static_cast<double>(MinValue));
+		LogGrowthFactor = LogRange / NumBuckets;
+		InvLogGrowthFactor = 1.0 / LogGrowthFactor;
+
+		// underflow + regular buckets + overflow
+		Counts.SetNumZeroed(NumBuckets + 2);
+		BucketValues.SetNumUninitialized(NumBuckets + 2);
+		BucketValues[0] = MinValue;
+		for (int32 i = 1; i <= NumBuckets; i++)
+		{
+			// Geometric center of the bucket
+			BucketValues[i] =
+				static_cast<ElementType>(static_cast<double>(MinValue) * FMath::Exp(LogGrowthFactor * (i - 0.5)));
+		}
+		BucketValues[NumBuckets + 1] = MaxValue;
+	}
+
+	int32 GetBucketIndex(ElementType Value) const
+	{
+		if (!(Value >= MinValue))
+		{
+			return 0;
+		}
+		if (Value >= MaxValue)
+		{
+			return NumBuckets + 1;
+		}
+		const int32 Index =
+			1 + static_cast<int32>(FMath::Loge(static_cast<double>(Value) / MinValue) * InvLogGrowthFactor);
+		return FMath::Min(Index, NumBuckets);
+	}
+
+	void Add(ElementType Value) { AddToBucket(GetBucketIndex(Value)); }
+
+	void AddToBucket(int32 BucketIndex, int64 Count = 1)
+	{
+		Counts[BucketIndex] += Count;
+		TotalCount += Count;
+	}
+
+	void RemoveFromBucket(int32 BucketIndex, int64 Count = 1)
+	{
+		checkSlow(Counts[BucketIndex] >= Count);
+		Counts[BucketIndex] -= Count;
+		TotalCount -= Count;
+	}
+
+	int64 GetTotalCount() const { return TotalCount; }
+
+	/**
+	 * Get the approximate value at the given quantile (nearest rank).
+	 * @param	Fraction	Quantile in [0, 1], e.g. 0.95 for p95
+	 * @returns the representative value of the bucket that contains the quantile or 0 if the histogram is empty.
+	 */
+	ElementType GetQuantile(double Fraction) const
+	{
+		if (TotalCount <= 0)
+		{
+			return 0;
+		}
+
+		const int64 TargetRank =
+			FMath::Clamp<int64>(static_cast<int64>(FMath::CeilToDouble(Fraction * TotalCount)), 1, TotalCount);
+		int64 CumulativeCount = 0;
+		for (int32 i = 0; i < Counts.Num(); i++)
+		{
+			CumulativeCount += Counts[i];
+			if (CumulativeCount >= TargetRank)
+			{
+				return BucketValues[i];
+			}
+		}
+		return MaxValue;
+	}
+
+	/** Maximum relative error of quantiles for values inside the [MinValue, MaxValue] range. */
+	double GetMaxRelativeError() const { return FMath::Exp(LogGrowthFactor * 0.5) - 1.0; }
+
+	bool HasSameLayout(const TLogHistogram& Other) const
+	{
+		return MinValue == Other.MinValue && MaxValue == Other.MaxValue && NumBuckets == Other.NumBuckets;
+	}
+
+	/** Add all samples of another histogram with the same layout to this one. */
+	void Merge(const TLogHistogram& Other)
+	{
+		checkf(HasSameLayout(Other), TEXT("Only histograms with the same layout can be merged"));
+		for (int32 i = 0; i < Counts.Num(); i++)
+		{
+			Counts[i] += Other.Counts[i];
+		}
+		TotalCount += Other.TotalCount;
+	}
+
+	void Reset()
+	{
+		FMemory::Memzero(Counts.GetData(), Counts.Num() * Counts.GetTypeSize());
+		TotalCount = 0;
+	}
+
+	ElementType GetMinValue() const { return MinValue; }
+	ElementType GetMaxValue() const { return MaxValue; }
+	int32 GetNumBuckets() const { return NumBuckets; }
+
+private:
+	ElementType MinValue;
+	ElementType MaxValue;
+	int32 NumBuckets;
+	double LogGrowthFactor = 0.0;
+	double InvLogGrowthFactor = 0.0;
+	int64 TotalCount = 0;
+	TArray<int64> Counts;
+	TArray<ElementType> BucketValues;
+};
+
+/**
+ * Aggregates quantiles (e.g. p50/p95/p99) of the last N values of a data stream.
+ * Useful e.g. for tracking frame times, latencies or task durations of the last X frames.
+ *
+ * Add() is O(1) and memory is bounded by the window size + number of histogram buckets.
+ * Quantile queries are O(NumBuckets) and independent of the window size.
+ * The aggregator is not thread-safe. To combine stats from multiple threads, aggregate per thread and merge
+ * copies of the histograms (see GetHistogram() and TLogHistogram::Merge()).
+ */
+template <typename InElementType>
+class TCircularQuantileAggregator
+{
+public:
+	using ElementType = InElementType;
+	using HistogramType = TLogHistogram<ElementType>;
+
+	/**
+	 * @param	MaxNum		Window size: Number of values to aggregate
+	 * @param	MinValue	Lower bound of the value range that is tracked with bounded error (must be > 0)
+	 * @param	MaxValue	Upper bound of the value range that is tracked with bounded error
+	 * @param	NumBuckets	Number of logarithmic buckets between min and max value. More buckets = lower error.
+	 */
+	TCircularQuantileAggregator(int32 MaxNum, ElementType MinValue, ElementType MaxValue, int32 NumBuckets = 128) :
+		WindowSize(MaxNum), BucketIndices(MaxNum), Histogram(MinValue, MaxValue, NumBuckets)
+	{
+		check(MaxNum > 0);
+		checkf(NumBuckets + 2 <= MAX_uint16, TEXT("Bucket indices are stored as uint16"));
+	}
+
+	void Add(ElementType Element)
+	{
+		if (BucketIndices.Num() == WindowSize)
+		{
+			// Oldest element is about to be overwritten
+			Histogram.RemoveFromBucket(BucketIndices.Oldest());
+		}
+
+		const int32 BucketIndex = Histogram.GetBucketIndex(Element);
+		BucketIndices.Add(static_cast<uint16>(BucketIndex));
+		Histogram.AddToBucket(BucketIndex);
+	}
+
+	int32 Num() const { return BucketIndices.Num(); }
+
+	bool HasData() const { return BucketIndices.HasData(); }
+
+	void Reset()
+	{
+		BucketIndices.Reset();
+		Histogram.Reset();
+	}
+
+	/** @param	Fraction	Quantile in [0, 1], e.g. 0.95 for p95 */
+	ElementType GetQuantile(double Fraction) const { return Histogram.GetQuantile(Fraction); }
+
+	ElementType Median() const { return GetQuantile(0.5); }
+
+	const HistogramType& GetHistogram() const { return Histogram; }
+
+private:
+	int32 WindowSize;
+	// Bucket index of every value in the window, so we know which bucket to decrement when a value is evicted.
+	TCircularArray<uint16> BucketIndices;
+	HistogramType Histogram;
+};
@@ -0,0 +1,357 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Containers/ContainerAllocationPolicies.h"
+
+#include <atomic>
+
+/**
+ * Fill memory handed out by and returned to the frame arena with garbage patterns, so reads of uninitialized or
+ * stale arena memory show up as obviously broken values.
+ */
+#ifndef OUU_FRAME_ARENA_POISONING
+	#define OUU_FRAME_ARENA_POISONING (DO_CHECK && !UE_BUILD_SHIPPING)
+#endif
+
+namespace OUU::Runtime
+{
+	/** Statistics of a single thread's frame arena. Published once per frame when the arena is reset. */
+	struct FFrameArenaStats
+	{
+		uint32 ThreadId = 0;
+
+		/** Peak number of bytes in use during the last completed frame */
+		SIZE_T LastFrameBytes = 0;
+
+		/** Peak number of bytes in use during any frame since the arena was created */
+		SIZE_T HighWaterMarkBytes = 0;
+
+		/** Size of all memory blocks currently owned by the arena */
+		SIZE_T ReservedBytes = 0;
+
+		/** Number of frames that did not fit into a single block. The arena grows its first block after these. */
+		uint64 NumOverflowFrames = 0;
+	};
+
+	/**
+	 * Thread-local linear allocator for data that does not outlive the current frame.
+	 * Allocations bump a pointer inside a block of memory that is reused every frame, so temporary arrays and strings
+	 * do not hit the global allocator. There is no per-allocation free: The whole arena is rewound at the end of the
+	 * frame or when the innermost FScopedFrameArenaMark goes out of scope.
+	 *
+	 * The game thread arena is reset on FCoreDelegates::OnEndFrame. Memory from it must not be kept beyond the end of
+	 * the frame in which it was allocated.
+	 * Work on other threads is not tied to the game thread's frames, so their arenas are never reset by the end of a
+	 * frame. Instead, every allocation off the game thread requires an open FScopedFrameArenaMark, and the arena is
+	 * rewound (and its stats are published) when the outermost mark is popped.
+	 *
+	 * Use via TFrameArenaArray / FFrameArenaAllocator or allocate raw memory from FFrameArena::Get().
+	 */
+	class OUURUNTIME_API FFrameArena
+	{
+	public:
+		FFrameArena();
+		~FFrameArena();
+
+		UE_NONCOPYABLE(FFrameArena);
+
+		/** Arena of the calling thread */
+		static FFrameArena& Get();
+
+		/** Alignment used by containers that do not pass the alignment of their elements */
+		static constexpr uint32 DefaultAlignment = 16;
+
+		/**
+		 * Allocate memory that is valid until the end of the frame or until the enclosing mark is popped.
+		 * Alignment must be a power of two.
+		 */
+		FORCEINLINE void* Allocate(SIZE_T Size, uint32 Alignment = DefaultAlignment)
+		{
+			checkSlow(FMath::IsPowerOfTwo(Alignment));
+			checkf(
+				bIsGameThreadArena || NumOpenMarks > 0,
+				TEXT("Frame arena allocations outside of the game thread require an open FScopedFrameArenaMark"));
+			ConditionalResetForNewFrame();
+
+			const UPTRINT Result = Align(Cursor, static_cast<UPTRINT>(Alignment));
+			if (Result + Size > End)
+				return AllocateSlow(Size, Alignment);
+
+			Cursor = Result + Size;
+#if OUU_FRAME_ARENA_POISONING
+			FMemory::Memset(reinterpret_cast<void*>(Result), AllocatedPoison, Size);
+#endif
+			return reinterpret_cast<void*>(Result);
+		}
+
+		template <typename T>
+		FORCEINLINE T* AllocateUninitialized(int32 Num)
+		{
+			return static_cast<T*>(Allocate(sizeof(T) * Num, alignof(T)));
+		}
+
+		/**
+		 * Resize an allocation. Grows and shrinks in place if Ptr is the most recent allocation of this arena,
+		 * otherwise copies the first NumBytesToCopy bytes into a new allocation. Returns nullptr for NewSize == 0.
+		 */
+		void* Reallocate(void* Ptr, SIZE_T OldSize, SIZE_T NumBytesToCopy, SIZE_T NewSize, uint32 Alignment);
+
+		/**
+		 * Give memory back to the arena. This only has an effect if Ptr is the most recent allocation,
+		 * which is the common case for short-lived temporary arrays.
+		 */
+		FORCEINLINE void Free(void* Ptr, SIZE_T Size)
+		{
+			if (Ptr && reinterpret_cast<UPTRINT>(Ptr) + Size == Cursor)
+			{
+				// Record the peak before rewinding, otherwise freed scratch memory never shows up in the stats
+				FramePeakBytes = FMath::Max(FramePeakBytes, GetNumBytesInUse());
+				Cursor = reinterpret_cast<UPTRINT>(Ptr);
+#if OUU_FRAME_ARENA_POISONING
+				FMemory::Memset(Ptr, FreedPoison, Size);
+#endif
+			}
+		}
+
+		/** Rewind the whole arena. Must not be called while a mark is open on this thread. */
+		void Reset();
+
+		/** Number of bytes currently allocated from this arena */
+		SIZE_T GetNumBytesInUse() const;
+
+		FFrameArenaStats GetStats() const;
+
+		/** Stats of all threads that have created an arena so far */
+		static TArray<FFrameArenaStats> GetAllThreadStats();
+
+		/** Mark the end of the frame. Resets the calling thread's arena and the other game thread arenas lazily. */
+		static void EndFrame();
+
+		/** Called by the runtime module to bind / unbind the end of frame delegate. */
+		static void RegisterEndFrameDelegate();
+		static void UnregisterEndFrameDelegate();
+
+	private:
+		friend class FScopedFrameArenaMark;
+
+		struct FBlock
+		{
+			uint8* Memory = nullptr;
+			SIZE_T Size = 0;
+		};
+
+		struct FMark
+		{
+			int32 BlockIndex = 0;
+			UPTRINT Cursor = 0;
+			SIZE_T BytesInPreviousBlocks = 0;
+			int32 Depth = 0;
+		};
+
+		static constexpr uint8 AllocatedPoison = 0xCD;
+		static constexpr uint8 FreedPoison = 0xDD;
+
+		/** Incremented by EndFrame(). Compared against LastFrameIndex by every game thread arena. */
+		static std::atomic<uint32> GlobalFrameIndex;
+
+		TArray<FBlock, TInlineAllocator<4>> Blocks;
+		int32 CurrentBlockIndex = INDEX_NONE;
+		UPTRINT Cursor = 0;
+		UPTRINT End = 0;
+		SIZE_T BytesInPreviousBlocks = 0;
+		SIZE_T FramePeakBytes = 0;
+		int32 NumOpenMarks = 0;
+		uint32 LastFrameIndex = 0;
+		uint32 ThreadId = 0;
+
+		// Only game thread arenas are reset at the end of the frame. All others are rewound by their outermost mark.
+		bool bIsGameThreadArena = false;
+
+		// Written by the owning thread on reset, read by any thread via GetAllThreadStats()
+		std::atomic<SIZE_T> LastFrameBytes{0};
+		std::atomic<SIZE_T> HighWaterMarkBytes{0};
+		std::atomic<SIZE_T> ReservedBytes{0};
+		std::atomic<uint64> NumOverflowFrames{0};
+
+		FORCEINLINE void ConditionalResetForNewFrame()
+		{
+			if (bIsGameThreadArena && LastFrameIndex != GlobalFrameIndex.load(std::memory_order_relaxed)
+				&& NumOpenMarks == 0)
+			{
+				Reset();
+			}
+		}
+
+		void* AllocateSlow(SIZE_T Size, uint32 Alignment);
+		void ActivateBlock(int32 BlockIndex);
+		void FreeBlocks();
+		void PoisonRange(int32 FromBlockIndex, UPTRINT FromCursor) const;
+
+		FMark PushMark();
+		void PopMark(const FMark& Mark);
+	};
+
+	/** Rewinds the calling thread's frame arena to its current state when this object goes out of scope. */
+	class OUURUNTIME_API FScopedFrameArenaMark
+	{
+	public:
+		FScopedFrameArenaMark() : Arena(FFrameArena::Get()), Mark(Arena.PushMark()) {}
+		~FScopedFrameArenaMark() { Arena.PopMark(Mark); }
+
+		UE_NONCOPYABLE(FScopedFrameArenaMark);
+
+	private:
+		FFrameArena& Arena;
+		FFrameArena::FMark Mark;
+	};
+
+	/**
+	 * Container allocation policy that allocates from the frame arena of the thread that (re)allocates.
+	 * Containers using this allocator must not outlive the current frame or the enclosing FScopedFrameArenaMark.
+	 * Freeing is a no-op, except for the most recent allocation of the arena, which is given back.
+	 */
+	template <int IndexSize>
+	class TSizedFrameArenaAllocator
+	{
+	public:
+		using SizeType = typename TBitsToSizeType<IndexSize>::Type;
+
+		static constexpr bool NeedsElementType = false;
+		static constexpr bool RequireRangeCheck = true;
+
+		class ForAnyElementType
+		{
+		public:
+			ForAnyElementType() = default;
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			FORCEINLINE ~ForAnyElementType()
+			{
+				if (Data)
+				{
+					FFrameArena::Get().Free(Data, NumAllocatedBytes);
+				}
+			}
+
+			FORCEINLINE void MoveToEmpty(ForAnyElementType& Other)
+			{
+				checkSlow(this != &Other);
+				if (Data)
+				{
+					FFrameArena::Get().Free(Data, NumAllocatedBytes);
+				}
+				Data = Other.Data;
+				NumAllocatedBytes = Other.NumAllocatedBytes;
+				Other.Data = nullptr;
+				Other.NumAllocatedBytes = 0;
+			}
+
+			FORCEINLINE FScriptContainerElement* GetAllocation() const { return Data; }
+
+			FORCEINLINE void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement)
+			{
+				ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, FFrameArena::DefaultAlignment);
+			}
+
+			void ResizeAllocation(
+				SizeType CurrentNum,
+				SizeType NewMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement)
+			{
+				const SIZE_T NewNumBytes = static_cast<SIZE_T>(NewMax) * NumBytesPerElement;
+				Data = static_cast<FScriptContainerElement*>(FFrameArena::Get().Reallocate(
+					Data,
+					NumAllocatedBytes,
+					static_cast<SIZE_T>(CurrentNum) * NumBytesPerElement,
+					NewNumBytes,
+					FMath::Max<uint32>(AlignmentOfElement, alignof(void*))));
+				NumAllocatedBytes = Data ? NewNumBytes : 0;
+			}
+
+			// Growing the most recent allocation is in place and no allocator buckets need to be hit,
+			// so quantization is disabled for all slack calculations.
+			FORCEINLINE SizeType CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement) const
+			{
+				return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false);
+			}
+			FORCEINLINE SizeType
+			CalculateSlackReserve(SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement) const
+			{
+				return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false, AlignmentOfElement);
+			}
+			FORCEINLINE SizeType
+			CalculateSlackShrink(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+			{
+				return DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, false);
+			}
+			FORCEINLINE SizeType CalculateSlackShrink(
+				SizeType NewMax,
+				SizeType CurrentMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement) const
+			{
+				return DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+			}
+			FORCEINLINE SizeType
+			CalculateSlackGrow(SizeType NewMax, SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+			{
+				return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false);
+			}
+			FORCEINLINE SizeType CalculateSlackGrow(
+				SizeType NewMax,
+				SizeType CurrentMax,
+				SIZE_T NumBytesPerElement,
+				uint32 AlignmentOfElement) const
+			{
+				return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+			}
+
+			FORCEINLINE SIZE_T GetAllocatedSize(SizeType CurrentMax, SIZE_T NumBytesPerElement) const
+			{
+				return static_cast<SIZE_T>(CurrentMax) * NumBytesPerElement;
+			}
+
+			FORCEINLINE bool HasAllocation() const { return Data != nullptr; }
+
+			FORCEINLINE SizeType GetInitialCapacity() const { return 0; }
+
+		private:
+			FScriptContainerElement* Data = nullptr;
+			SIZE_T NumAllocatedBytes = 0;
+		};
+
+		template <typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+			FORCEINLINE ElementType* GetAllocation() const
+			{
+				return reinterpret_cast<ElementType*>(ForAnyElementType::GetAllocation());
+			}
+		};
+	};
+
+	using FFrameArenaAllocator = TSizedFrameArenaAllocator<32>;
+
+	/** Set allocator for TSet / TMap that keeps elements, the sparse array bits and the hash in the frame arena. */
+	using FFrameArenaSetAllocator = TSetAllocator<
+		TSparseArrayAllocator<FFrameArenaAllocator, FFrameArenaAllocator>,
+		FFrameArenaAllocator>;
+
+	template <typename ElementType>
+	using TFrameArenaArray = TArray<ElementType, FFrameArenaAllocator>;
+} // namespace OUU::Runtime
+
+template <int IndexSize>
+struct TAllocatorTraits<OUU::Runtime::TSizedFrameArenaAllocator<IndexSize>>
+	: TAllocatorTraitsBase<OUU::Runtime::TSizedFrameArenaAllocator<IndexSize>>
+{
+	static constexpr bool SupportsMove = true;
+	static constexpr bool IsZeroConstruct = true;
+	static constexpr bool SupportsElementAlignment = true;
+};
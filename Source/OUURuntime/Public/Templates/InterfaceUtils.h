@@ -94,6 +94,110 @@ UObject* GetInterfaceObject(TWeakInterfacePtr<T> InterfaceObject)
 	return InterfaceObject.GetObject();
 }
 
+namespace OUU::Runtime::InterfaceUtils
+{
+	/** How a class implements an interface */
+	enum class EInterfaceImplementation : uint8
+	{
+		// The class does not implement the interface
+		None,
+		// At least one native (C++) class in the hierarchy implements the interface.
+		// Cast<IInterface>() returns a valid interface pointer.
+		Native,
+		// The interface is only implemented by Blueprint classes or is a Blueprint interface.
+		// Only the Execute_* functions can be used, Cast<IInterface>() returns nullptr.
+		Blueprint
+	};
+
+	/** Cached result of an interface lookup for a (class, interface) pair */
+	struct FInterfaceImplementation
+	{
+		EInterfaceImplementation Type = EInterfaceImplementation::None;
+
+		// Offset from the UObject address to the native interface address.
+		// Only meaningful for native implementations of native interfaces.
+		int32 NativePointerOffset = 0;
+
+		FORCEINLINE bool IsImplemented() const { return Type != EInterfaceImplementation::None; }
+		FORCEINLINE bool IsNative() const { return Type == EInterfaceImplementation::Native; }
+	};
+
+	/**
+	 * Lookup cache for interface implementations per (UClass, interface) pair.
+	 * UClass::ImplementsInterface() and UObject::GetInterfaceAddress() walk the complete class hierarchy and all
+	 * implemented interfaces on every call. This cache answers the same question with a single hash map lookup after
+	 * the first query for a class. Reads are lock-free (see TRcuVariable). The entries are split into shards and a miss
+	 * only copies the shard of its key, so the cache is meant for the small and stable set of classes that are queried
+	 * over and over again (e.g. per actor per frame).
+	 *
+	 * Classes are referenced weakly, so entries of unloaded classes can't be confused with new classes. They are
+	 * removed after garbage collection. The whole cache is invalidated when classes are reinstanced (Blueprint
+	 * compilation, live coding) and after hot reload.
+	 */
+	class OUURUNTIME_API FInterfaceImplementationCache
+	{
+	public:
+		/** Find how Class implements InterfaceClass. Both classes may be null. */
+		static FInterfaceImplementation Find(const UClass* Class, const UClass* InterfaceClass);
+
+		/** Find the implementation without consulting the cache. Walks the class hierarchy like the engine does. */
+		static FInterfaceImplementation FindUncached(const UClass* Class, const UClass* InterfaceClass);
+
+		/** Drop all cached entries. Lookups that are in flight while this is called will not be cached. */
+		static void Invalidate();
+
+		/** Drop the entries of classes and interfaces that were garbage collected. */
+		static void RemoveUnloadedClasses();
+
+		/** Number of cached (class, interface) pairs. For diagnostics and tests. */
+		static int32 GetNumCachedEntries();
+
+		/** Called by the runtime module to bind / unbind the engine delegates that invalidate the cache. */
+		static void RegisterInvalidationDelegates();
+		static void UnregisterInvalidationDelegates();
+	};
+
+	/** Does Class implement the interface (natively or in Blueprint)? Cached replacement for ImplementsInterface() */
+	FORCEINLINE bool ImplementsInterface(const UClass* Class, const UClass* InterfaceClass)
+	{
+		return FInterfaceImplementationCache::Find(Class, InterfaceClass).IsImplemented();
+	}
+
+	template <typename T, typename = TIsIInterface_T<T>>
+	FORCEINLINE bool ImplementsInterface(const UClass* Class)
+	{
+		return ImplementsInterface(Class, T::UClassType::StaticClass());
+	}
+
+	/** Is the interface implemented by a native class, so the object can be cast to the interface pointer? */
+	template <typename T, typename = TIsIInterface_T<T>>
+	FORCEINLINE bool ImplementsInterfaceNatively(const UClass* Class)
+	{
+		return FInterfaceImplementationCache::Find(Class, T::UClassType::StaticClass()).IsNative();
+	}
+
+	/** Cached equivalent of Cast<T>(Object) for native interface types */
+	template <typename T, typename = TIsIInterface_T<std::remove_const_t<T>>>
+	FORCEINLINE T* CastToInterface(UObject* Object)
+	{
+		if (Object == nullptr)
+			return nullptr;
+
+		const FInterfaceImplementation Implementation = FInterfaceImplementationCache::Find(
+			Object->GetClass(),
+			std::remove_const_t<T>::UClassType::StaticClass());
+		return Implementation.IsNative()
+			? reinterpret_cast<T*>(reinterpret_cast<uint8*>(Object) + Implementation.NativePointerOffset)
+			: nullptr;
+	}
+
+	template <typename T, typename = TIsIInterface_T<std::remove_const_t<T>>>
+	FORCEINLINE const T* CastToInterface(const UObject* Object)
+	{
+		return CastToInterface<const T>(const_cast<UObject*>(Object));
+	}
+} // namespace OUU::Runtime::InterfaceUtils
+
 /**
  * Validate an interface object based on it's underlying UObject, extending IsValid(UObject*) functionality.
  * Also checks if the object actually implements the target interface.
@@ -105,7 +209,10 @@ UObject* GetInterfaceObject(TWeakInterfacePtr<T> InterfaceObject)
 template <typename T>
 FORCEINLINE bool IsValidInterface(const UObject* InterfaceObject)
 {
-	return IsValid(InterfaceObject) && InterfaceObject->GetClass()->ImplementsInterface(T::UClassType::StaticClass());
+	return IsValid(InterfaceObject)
+		&& OUU::Runtime::InterfaceUtils::ImplementsInterface(
+			   InterfaceObject->GetClass(),
+			   T::UClassType::StaticClass());
 }
 
 /**
@@ -126,7 +233,7 @@ FORCEINLINE bool IsValidInterface(TScriptInterface<T>& InterfaceObject)
 {
 	UObject* ObjectPointer = InterfaceObject.GetObject();
 	bool bResult = IsValidInterface<T>(ObjectPointer);
-	InterfaceObject.SetInterface(bResult ? Cast<T>(ObjectPointer) : nullptr);
+	InterfaceObject.SetInterface(bResult ? OUU::Runtime::InterfaceUtils::CastToInterface<T>(ObjectPointer) : nullptr);
 	return bResult;
 }
 
@@ -0,0 +1,437 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Templates/UniquePtr.h"
+
+#include <atomic>
+
+namespace OUU::Runtime::Private
+{
+	/**
+	 * Memory order for the index/sequence stores that publish pushed elements or freed space.
+	 * Must be seq_cst, so the store and the waiter count load in FRingBufferWaitEvent::Notify() can't be reordered.
+	 * On ARM this is the same instruction as a release store, on x86 it costs about as much as a fence.
+	 */
+	constexpr std::memory_order RingBufferPublishOrder = std::memory_order_seq_cst;
+
+	/**
+	 * Wait support for the lock-free ring buffers.
+	 * Handshake between Notify() and Wait(), so no wake-up can be missed:
+	 * - Notify() is called after a seq_cst publish and loads the waiter count with seq_cst.
+	 * - Wait() registers with a seq_cst increment and a fence before re-checking the buffer.
+	 * Either the notifier sees the waiter or the waiter's re-check sees the published state.
+	 * Notify() only touches the event if there are waiters, so non-blocking usage stays free of syscalls.
+	 */
+	class FRingBufferWaitEvent
+	{
+	public:
+		FRingBufferWaitEvent() : Event(FPlatformProcess::GetSynchEventFromPool(false)) {}
+		~FRingBufferWaitEvent() { FPlatformProcess::ReturnSynchEventToPool(Event); }
+
+		UE_NONCOPYABLE(FRingBufferWaitEvent);
+
+		void Notify()
+		{
+			if (NumWaiters.load(std::memory_order_seq_cst) > 0)
+			{
+				Event->Trigger();
+			}
+		}
+
+		/**
+		 * Repeatedly call TryFunc until it succeeds or the timeout expired.
+		 * Spins for a short time before going to sleep on the event.
+		 * @param	TimeoutMs	Timeout in milliseconds. MAX_uint32 to wait indefinitely.
+		 */
+		template <typename TryFuncType>
+		bool Wait(TryFuncType&& TryFunc, uint32 TimeoutMs)
+		{
+			constexpr int32 NumSpins = 64;
+			for (int32 i = 0; i < NumSpins; i++)
+			{
+				if (TryFunc())
+				{
+					return true;
+				}
+				FPlatformProcess::Yield();
+			}
+
+			const bool bInfinite = TimeoutMs == MAX_uint32;
+			const double EndTime = FPlatformTime::Seconds() + TimeoutMs / 1000.0;
+			while (true)
+			{
+				NumWaiters.fetch_add(1, std::memory_order_seq_cst);
+				// Re-check after registering as waiter, so we can't miss a notification in-between.
+				// The fence makes the re-check see every publish that was ordered before a Notify() that missed us.
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (TryFunc())
+				{
+					NumWaiters.fetch_sub(1, std::memory_order_seq_cst);
+					return true;
+				}
+
+				const double RemainingMs = bInfinite ? 0.0 : (EndTime - FPlatformTime::Seconds()) * 1000.0;
+				if (!bInfinite && RemainingMs <= 0.0)
+				{
+					NumWaiters.fetch_sub(1, std::memory_order_seq_cst);
+					return false;
+				}
+
+				Event->Wait(bInfinite ? MAX_uint32 : static_cast<uint32>(FMath::CeilToDouble(RemainingMs)));
+				NumWaiters.fetch_sub(1, std::memory_order_seq_cst);
+			}
+		}
+
+	private:
+		FEvent* Event = nullptr;
+		std::atomic<int32> NumWaiters{0};
+	};
+} // namespace OUU::Runtime::Private
+
+/**
+ * Bounded lock-free single-producer/single-consumer ring buffer.
+ * - Capacity is rounded up to a power of two, so indices are wrapped with a bit mask.
+ * - Head and tail indices live on separate cache lines to avoid false sharing between producer and consumer.
+ * - Batch push/pop publish all elements with a single atomic store.
+ * - Push()/Pop() optionally block until space/data is available.
+ *
+ * Exactly one thread may push and exactly one (other) thread may pop at the same time.
+ * Elements must be default constructible and move assignable.
+ */
+template <typename InElementType>
+class TSpscRingBuffer
+{
+public:
+	using ElementType = InElementType;
+
+	explicit TSpscRingBuffer(uint32 MinCapacity) :
+		Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(MinCapacity, 2))), Mask(Capacity - 1),
+		Elements(MakeUnique<ElementType[]>(Capacity))
+	{
+	}
+
+	UE_NONCOPYABLE(TSpscRingBuffer);
+
+	uint32 GetCapacity() const { return Capacity; }
+
+	/** Approximate number of elements. Only exact when called from producer or consumer without concurrent access. */
+	uint32 Num() const
+	{
+		// Load Head first: The consumer only advances Head to values it read from Tail, so a Tail loaded afterwards is
+		// never older. Loading Tail first would allow Head > Tail from third threads, which wraps around to ~4 billion.
+		const uint32 Head = ConsumerState.Head.load(std::memory_order_acquire);
+		const uint32 Tail = ProducerState.Tail.load(std::memory_order_acquire);
+		return Tail - Head;
+	}
+
+	bool IsEmpty() const { return Num() == 0; }
+
+	// - Producer API
+
+	template <typename ArgType>
+	bool TryPush(ArgType&& Element)
+	{
+		const uint32 Tail = ProducerState.Tail.load(std::memory_order_relaxed);
+		if (Tail - ProducerState.CachedHead == Capacity)
+		{
+			ProducerState.CachedHead = ConsumerState.Head.load(std::memory_order_acquire);
+			if (Tail - ProducerState.CachedHead == Capacity)
+			{
+				return false;
+			}
+		}
+
+		Elements[Tail & Mask] = Forward<ArgType>(Element);
+		ProducerState.Tail.store(Tail + 1, OUU::Runtime::Private::RingBufferPublishOrder);
+		DataAvailableEvent.Notify();
+		return true;
+	}
+
+	/**
+	 * Push as many elements as there is space for.
+	 * @returns the number of elements that were pushed
+	 */
+	int32 PushBatch(TArrayView<const ElementType> InElements)
+	{
+		const uint32 Tail = ProducerState.Tail.load(std::memory_order_relaxed);
+		ProducerState.CachedHead = ConsumerState.Head.load(std::memory_order_acquire);
+		const uint32 NumFree = Capacity - (Tail - ProducerState.CachedHead);
+		const uint32 NumToPush = FMath::Min<uint32>(NumFree, static_cast<uint32>(InElements.Num()));
+		for (uint32 i = 0; i < NumToPush; i++)
+		{
+			Elements[(Tail + i) & Mask] = InElements[i];
+		}
+
+		if (NumToPush > 0)
+		{
+			ProducerState.Tail.store(Tail + NumToPush, OUU::Runtime::Private::RingBufferPublishOrder);
+			DataAvailableEvent.Notify();
+		}
+		return static_cast<int32>(NumToPush);
+	}
+
+	/**
+	 * Push an element. Blocks until there is space or the timeout expired.
+	 * @param	TimeoutMs	Timeout in milliseconds. MAX_uint32 to wait indefinitely.
+	 */
+	bool Push(const ElementType& Element, uint32 TimeoutMs = MAX_uint32)
+	{
+		return SpaceAvailableEvent.Wait([&]() { return TryPush(Element); }, TimeoutMs);
+	}
+
+	// - Consumer API
+
+	bool TryPop(ElementType& OutElement)
+	{
+		const uint32 Head = ConsumerState.Head.load(std::memory_order_relaxed);
+		if (Head == ConsumerState.CachedTail)
+		{
+			ConsumerState.CachedTail = ProducerState.Tail.load(std::memory_order_acquire);
+			if (Head == ConsumerState.CachedTail)
+			{
+				return false;
+			}
+		}
+
+		OutElement = MoveTemp(Elements[Head & Mask]);
+		ConsumerState.Head.store(Head + 1, OUU::Runtime::Private::RingBufferPublishOrder);
+		SpaceAvailableEvent.Notify();
+		return true;
+	}
+
+	/**
+	 * Pop up to OutElements.Num() elements.
+	 * @returns the number of elements that were popped into the front of OutElements
+	 */
+	int32 PopBatch(TArrayView<ElementType> OutElements)
+	{
+		const uint32 Head = ConsumerState.Head.load(std::memory_order_relaxed);
+		ConsumerState.CachedTail = ProducerState.Tail.load(std::memory_order_acquire);
+		const uint32 NumToPop =
+			FMath::Min<uint32>(ConsumerState.CachedTail - Head, static_cast<uint32>(OutElements.Num()));
+		for (uint32 i = 0; i < NumToPop; i++)
+		{
+			OutElements[i] = MoveTemp(Elements[(Head + i) & Mask]);
+		}
+
+		if (NumToPop > 0)
+		{
+			ConsumerState.Head.store(Head + NumToPop, OUU::Runtime::Private::RingBufferPublishOrder);
+			SpaceAvailableEvent.Notify();
+		}
+		return static_cast<int32>(NumToPop);
+	}
+
+	/**
+	 * Pop an element. Blocks until there is data or the timeout expired.
+	 * @param	TimeoutMs	Timeout in milliseconds. MAX_uint32 to wait indefinitely.
+	 */
+	bool Pop(ElementType& OutElement, uint32 TimeoutMs = MAX_uint32)
+	{
+		return DataAvailableEvent.Wait([&]() { return TryPop(OutElement); }, TimeoutMs);
+	}
+
+private:
+	const uint32 Capacity;
+	const uint32 Mask;
+	TUniquePtr<ElementType[]> Elements;
+
+	// State written by the producer. CachedHead avoids reading the consumer cache line on every push.
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FProducerState
+	{
+		std::atomic<uint32> Tail{0};
+		uint32 CachedHead = 0;
+	} ProducerState;
+
+	// State written by the consumer. CachedTail avoids reading the producer cache line on every pop.
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FConsumerState
+	{
+		std::atomic<uint32> Head{0};
+		uint32 CachedTail = 0;
+	} ConsumerState;
+
+	OUU::Runtime::Private::FRingBufferWaitEvent DataAvailableEvent;
+	OUU::Runtime::Private::FRingBufferWaitEvent SpaceAvailableEvent;
+};
+
+/**
+ * Bounded lock-free multi-producer/multi-consumer ring buffer (based on Dmitry Vyukov's bounded MPMC queue).
+ * - Capacity is rounded up to a power of two, so indices are wrapped with a bit mask.
+ * - Enqueue and dequeue positions live on separate cache lines.
+ * - Every cell has a sequence number, so producers and consumers only contend on the position counters.
+ * - Push()/Pop() optionally block until space/data is available.
+ *
+ * Batch operations are not atomic as a whole: Other producers/consumers may interleave with a batch.
+ * Elements must be default constructible and move assignable.
+ */
+template <typename InElementType>
+class TMpmcRingBuffer
+{
+public:
+	using ElementType = InElementType;
+
+	explicit TMpmcRingBuffer(uint32 MinCapacity) :
+		Capacity(FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(MinCapacity, 2))), Mask(Capacity - 1),
+		Cells(MakeUnique<FCell[]>(Capacity))
+	{
+		for (uint32 i = 0; i < Capacity; i++)
+		{
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	UE_NONCOPYABLE(TMpmcRingBuffer);
+
+	uint32 GetCapacity() const { return Capacity; }
+
+	/** Approximate number of elements. */
+	uint32 Num() const
+	{
+		const uint64 Enqueue = EnqueueState.Position.load(std::memory_order_acquire);
+		const uint64 Dequeue = DequeueState.Position.load(std::memory_order_acquire);
+		return Enqueue > Dequeue ? static_cast<uint32>(Enqueue - Dequeue) : 0;
+	}
+
+	bool IsEmpty() const { return Num() == 0; }
+
+	template <typename ArgType>
+	bool TryPush(ArgType&& Element)
+	{
+		uint64 Position = EnqueueState.Position.load(std::memory_order_relaxed);
+		FCell* Cell = nullptr;
+		while (true)
+		{
+			Cell = &Cells[Position & Mask];
+			const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position);
+			if (Difference == 0)
+			{
+				if (EnqueueState.Position.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// Cell still holds the element of the previous lap -> full
+				return false;
+			}
+			else
+			{
+				Position = EnqueueState.Position.load(std::memory_order_relaxed);
+			}
+		}
+
+		Cell->Data = Forward<ArgType>(Element);
+		Cell->Sequence.store(Position + 1, OUU::Runtime::Private::RingBufferPublishOrder);
+		DataAvailableEvent.Notify();
+		return true;
+	}
+
+	/**
+	 * Push as many elements as possible until the buffer is full.
+	 * @returns the number of elements that were pushed
+	 */
+	int32 PushBatch(TArrayView<const ElementType> InElements)
+	{
+		int32 NumPushed = 0;
+		while (NumPushed < InElements.Num() && TryPush(InElements[NumPushed]))
+		{
+			NumPushed++;
+		}
+		return NumPushed;
+	}
+
+	/**
+	 * Push an element. Blocks until there is space or the timeout expired.
+	 * @param	TimeoutMs	Timeout in milliseconds. MAX_uint32 to wait indefinitely.
+	 */
+	bool Push(const ElementType& Element, uint32 TimeoutMs = MAX_uint32)
+	{
+		return SpaceAvailableEvent.Wait([&]() { return TryPush(Element); }, TimeoutMs);
+	}
+
+	bool TryPop(ElementType& OutElement)
+	{
+		uint64 Position = DequeueState.Position.load(std::memory_order_relaxed);
+		FCell* Cell = nullptr;
+		while (true)
+		{
+			Cell = &Cells[Position & Mask];
+			const uint64 Sequence = Cell->Sequence.load(std::memory_order_acquire);
+			const int64 Difference = static_cast<int64>(Sequence) - static_cast<int64>(Position + 1);
+			if (Difference == 0)
+			{
+				if (DequeueState.Position.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (Difference < 0)
+			{
+				// Cell was not written in this lap yet -> empty
+				return false;
+			}
+			else
+			{
+				Position = DequeueState.Position.load(std::memory_order_relaxed);
+			}
+		}
+
+		OutElement = MoveTemp(Cell->Data);
+		Cell->Sequence.store(Position + Capacity, OUU::Runtime::Private::RingBufferPublishOrder);
+		SpaceAvailableEvent.Notify();
+		return true;
+	}
+
+	/**
+	 * Pop up to OutElements.Num() elements.
+	 * @returns the number of elements that were popped into the front of OutElements
+	 */
+	int32 PopBatch(TArrayView<ElementType> OutElements)
+	{
+		int32 NumPopped = 0;
+		while (NumPopped < OutElements.Num() && TryPop(OutElements[NumPopped]))
+		{
+			NumPopped++;
+		}
+		return NumPopped;
+	}
+
+	/**
+	 * Pop an element. Blocks until there is data or the timeout expired.
+	 * @param	TimeoutMs	Timeout in milliseconds. MAX_uint32 to wait indefinitely.
+	 */
+	bool Pop(ElementType& OutElement, uint32 TimeoutMs = MAX_uint32)
+	{
+		return DataAvailableEvent.Wait([&]() { return TryPop(OutElement); }, TimeoutMs);
+	}
+
+private:
+	struct FCell
+	{
+		std::atomic<uint64> Sequence{0};
+		ElementType Data = {};
+	};
+
+	struct alignas(PLATFORM_CACHE_LINE_SIZE) FPositionState
+	{
+		std::atomic<uint64> Position{0};
+	};
+
+	const uint32 Capacity;
+	const uint32 Mask;
+	TUniquePtr<FCell[]> Cells;
+
+	FPositionState EnqueueState;
+	FPositionState DequeueState;
+
+	OUU::Runtime::Private::FRingBufferWaitEvent DataAvailableEvent;
+	OUU::Runtime::Private::FRingBufferWaitEvent SpaceAvailableEvent;
+};
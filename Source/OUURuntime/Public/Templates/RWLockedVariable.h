@@ -89,12 +89,29 @@ public:
 	friend class TRWLockedVariable;
 
 	TScopedRWLockedVariableRef(TScopedRWLockedVariableRef&& Other) noexcept :
-		VariableRef(Other.VariableRef), Lock(Other.Lock), LockType(Other.LockType)
+		VariableRef(Other.VariableRef), Lock(Other.Lock), bOwnsLock(Other.bOwnsLock)
 	{
+		// Lock ownership is transferred to this instance
+		Other.bOwnsLock = false;
+	}
+
+	~TScopedRWLockedVariableRef()
+	{
+		if (!bOwnsLock)
+			return;
+
+		if constexpr (bIsWriteLock)
+		{
+			Lock.WriteUnlock();
+		}
+		else
+		{
+			Lock.ReadUnlock();
+		}
 	}
 
 	VariableType& Get() const { return VariableRef; }
-	VariableType& operator->() const { return Get(); }
+	VariableType* operator->() const { return &Get(); }
 	VariableType& operator*() const { return Get(); }
 
 	// ---------------------
@@ -154,8 +171,16 @@ public:
 
 private:
 	TScopedRWLockedVariableRef(VariableType& InVariableRef, FRWLock& InLock) :
-		VariableRef(InVariableRef), Lock(InLock), LockType()
+		VariableRef(InVariableRef), Lock(InLock), bOwnsLock(true)
 	{
+		if constexpr (bIsWriteLock)
+		{
+			Lock.WriteLock();
+		}
+		else
+		{
+			Lock.ReadLock();
+		}
 	}
 
 	// Reference to the variable value
@@ -164,8 +189,8 @@ private:
 	// Reference to the lock
 	FRWLock& Lock;
 
-	// LockType for RWScopeLocks
-	FRWScopeLockType LockType;
+	// Whether this instance is responsible for releasing the lock (false after it was moved from)
+	bool bOwnsLock = false;
 };
 
 #undef ASSERT_CONST_REF_CANT
@@ -0,0 +1,416 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
+
+/**
+ * Read-mostly alternatives to TRWLockedVariable.
+ *
+ * TRWLockedVariable acquires a FRWLock for every read, so all readers write to the same cache line and
+ * contend even if there is no writer at all. The containers in this file are intended for data that is read very
+ * frequently from many threads but only updated rarely:
+ * - TSeqLockedVariable:	Sequence lock for small trivially copyable values. Readers copy the value and retry if a
+ *							writer was active in the meantime. Readers never write to shared memory.
+ * - TRcuVariable:			Read-copy-update for arbitrary values. Writers copy the current value, modify the copy
+ *							and atomically publish it. Readers dereference the current pointer and only announce
+ *							themselves in a thread-local, cache-line-padded epoch slot. Old values are deleted once
+ *							no reader can observe them anymore.
+ *
+ * Both types offer the same Read() / Write() accessor ergonomics as TRWLockedVariable.
+ */
+
+namespace OUU::Runtime::Private::ReadMostly
+{
+	/**
+	 * Global epoch based reclamation state shared by all TRcuVariables.
+	 * Every reader thread gets its own cache-line-padded slot in which it stores the epoch it entered a read section
+	 * in. Writers advance the global epoch after publishing a new value and may only delete values that were retired
+	 * before the oldest epoch that is still in use by a reader.
+	 */
+	class OUURUNTIME_API FEpochManager
+	{
+	public:
+		/** Enter a read section on the calling thread. May be nested. */
+		static void EnterRead();
+
+		/** Exit a read section on the calling thread. */
+		static void ExitRead();
+
+		/**
+		 * Advance the global epoch. Must be called after a new value was published.
+		 * @returns the new epoch. Objects retired with this epoch may be deleted once CanReclaim() returns true.
+		 */
+		static uint64 AdvanceEpoch();
+
+		/** Are all readers that could still observe an object retired with the given epoch done? */
+		static bool CanReclaim(uint64 RetireEpoch);
+	};
+
+	/** Scope guard for a read section of the epoch manager. */
+	class FEpochReadScope
+	{
+	public:
+		FEpochReadScope() { FEpochManager::EnterRead(); }
+		FEpochReadScope(FEpochReadScope&& Other) noexcept : bActive(Other.bActive) { Other.bActive = false; }
+		~FEpochReadScope()
+		{
+			if (bActive)
+			{
+				FEpochManager::ExitRead();
+			}
+		}
+
+		FEpochReadScope(const FEpochReadScope&) = delete;
+		FEpochReadScope& operator=(const FEpochReadScope&) = delete;
+		FEpochReadScope& operator=(FEpochReadScope&&) = delete;
+
+	private:
+		bool bActive = true;
+	};
+} // namespace OUU::Runtime::Private::ReadMostly
+
+//---------------------------------------------------------------------------------------------------------------------
+// Seqlock
+//---------------------------------------------------------------------------------------------------------------------
+
+// Forward declaration
+template <typename VariableType>
+class TScopedSeqLockedVariableRef;
+
+/**
+ * Container for a small trivially copyable variable that is protected by a sequence lock.
+ * Read() returns a copy of the value and never blocks writers. Concurrent writers are serialized.
+ * Best suited for small values (a few cache lines at most) that are read far more often than they are written.
+ */
+template <typename InVariableType>
+class TSeqLockedVariable
+{
+public:
+	using VariableType = InVariableType;
+
+	static_assert(
+		TIsTriviallyCopyConstructible<VariableType>::Value && TIsTriviallyDestructible<VariableType>::Value,
+		"TSeqLockedVariable requires trivially copyable types. Use TRcuVariable for other types.");
+
+	friend class TScopedSeqLockedVariableRef<VariableType>;
+
+	/** Snapshot of the variable value returned by Read() */
+	class FSnapshot
+	{
+	public:
+		explicit FSnapshot(const VariableType& InValue) : Value(InValue) {}
+
+		const VariableType& Get() const { return Value; }
+		const VariableType* operator->() const { return &Value; }
+		const VariableType& operator*() const { return Value; }
+
+		bool operator==(const VariableType& Other) const { return Value == Other; }
+		bool operator!=(const VariableType& Other) const { return Value != Other; }
+
+	private:
+		VariableType Value;
+	};
+
+	TSeqLockedVariable() = default;
+	TSeqLockedVariable(VariableType InVariableValue) : Variable(InVariableValue) {}
+
+	/** Read a consistent copy of the variable. Spins while a writer is active. */
+	FSnapshot Read() const
+	{
+		alignas(VariableType) uint8 Buffer[sizeof(VariableType)];
+		while (true)
+		{
+			const uint32 SequenceBefore = Sequence.load(std::memory_order_acquire);
+			if (SequenceBefore & 1)
+			{
+				// Writer is active
+				FPlatformProcess::Yield();
+				continue;
+			}
+
+			// The copy may be torn if a writer is active concurrently. This is detected via the sequence check below,
+			// in which case the torn copy is discarded. The type is trivially copyable, so copying it is harmless.
+			FMemory::Memcpy(Buffer, &Variable, sizeof(VariableType));
+			std::atomic_thread_fence(std::memory_order_acquire);
+
+			if (Sequence.load(std::memory_order_relaxed) == SequenceBefore)
+			{
+				return FSnapshot(*reinterpret_cast<const VariableType*>(Buffer));
+			}
+		}
+	}
+
+	/** Acquire exclusive write access to the variable. Readers retry until the returned ref goes out of scope. */
+	TScopedSeqLockedVariableRef<VariableType> Write() { return TScopedSeqLockedVariableRef<VariableType>(*this); }
+
+	/** Overwrite the variable value */
+	void Set(const VariableType& NewValue) { Write().Get() = NewValue; }
+
+	/**
+	 * Get a reference to the underlying variable.
+	 * This does not lock the variable, so USE WITH CAUTION!
+	 */
+	FORCEINLINE const VariableType& GetRefWithoutLocking_USE_WITH_CAUTION() const { return Variable; }
+
+	/**
+	 * Get a reference to the underlying variable.
+	 * This does not lock the variable, so USE WITH CAUTION!
+	 */
+	FORCEINLINE VariableType& GetRefWithoutLocking_USE_WITH_CAUTION() { return Variable; }
+
+private:
+	// Even while no writer is active, odd while a writer is modifying the variable
+	mutable std::atomic<uint32> Sequence{0};
+
+	VariableType Variable = {};
+
+	void BeginWrite()
+	{
+		uint32 Expected = Sequence.load(std::memory_order_relaxed);
+		while (true)
+		{
+			if (Expected & 1)
+			{
+				// Another writer is active
+				FPlatformProcess::Yield();
+				Expected = Sequence.load(std::memory_order_relaxed);
+				continue;
+			}
+			if (Sequence.compare_exchange_weak(Expected, Expected + 1, std::memory_order_acquire))
+				break;
+		}
+		// Prevent writes to the variable from becoming visible before the odd sequence number
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+
+	void EndWrite() { Sequence.fetch_add(1, std::memory_order_release); }
+};
+
+/** Scoped write access to a TSeqLockedVariable. */
+template <typename VariableType>
+class TScopedSeqLockedVariableRef
+{
+public:
+	TScopedSeqLockedVariableRef(TScopedSeqLockedVariableRef&& Other) noexcept : Owner(Other.Owner)
+	{
+		Other.Owner = nullptr;
+	}
+
+	~TScopedSeqLockedVariableRef()
+	{
+		if (Owner)
+		{
+			Owner->EndWrite();
+		}
+	}
+
+	VariableType& Get() const { return Owner->Variable; }
+	VariableType* operator->() const { return &Get(); }
+	VariableType& operator*() const { return Get(); }
+
+	template <typename T>
+	VariableType& operator=(T Other)
+	{
+		return Get() = Other;
+	}
+
+private:
+	friend class TSeqLockedVariable<VariableType>;
+
+	explicit TScopedSeqLockedVariableRef(TSeqLockedVariable<VariableType>& InOwner) : Owner(&InOwner)
+	{
+		Owner->BeginWrite();
+	}
+
+	TSeqLockedVariable<VariableType>* Owner = nullptr;
+};
+
+//---------------------------------------------------------------------------------------------------------------------
+// RCU
+//---------------------------------------------------------------------------------------------------------------------
+
+// Forward declarations
+template <typename VariableType>
+class TRcuVariableReadRef;
+template <typename VariableType>
+class TScopedRcuVariableWriteRef;
+
+/**
+ * Container for a variable that is updated via read-copy-update.
+ * Readers get a const reference to an immutable version of the value that stays valid as long as the read ref is
+ * alive, even if writers publish new versions in the meantime.
+ * Writers are serialized, copy the current value and publish the modified copy when the write ref goes out of scope.
+ * Old versions are deleted lazily by subsequent writes or when the variable is destroyed.
+ */
+template <typename InVariableType>
+class TRcuVariable
+{
+public:
+	using VariableType = InVariableType;
+
+	friend class TScopedRcuVariableWriteRef<VariableType>;
+
+	TRcuVariable() : Current(new VariableType()) {}
+	TRcuVariable(VariableType InVariableValue) : Current(new VariableType(MoveTemp(InVariableValue))) {}
+
+	~TRcuVariable()
+	{
+		// Nobody may read a variable while it's destroyed (or hold read refs past its lifetime), so all versions can
+		// be deleted immediately.
+		for (const FRetiredValue& Retired : RetiredValues)
+		{
+			delete Retired.Value;
+		}
+		delete Current.load(std::memory_order_relaxed);
+	}
+
+	UE_NONCOPYABLE(TRcuVariable);
+
+	/** Acquire a read reference to the current version of the variable. Never blocks. */
+	TRcuVariableReadRef<VariableType> Read() const
+	{
+		OUU::Runtime::Private::ReadMostly::FEpochReadScope ReadScope;
+		// seq_cst load is required to order it after the epoch announcement in EnterRead()
+		const VariableType* Value = Current.load(std::memory_order_seq_cst);
+		return TRcuVariableReadRef<VariableType>(MoveTemp(ReadScope), Value);
+	}
+
+	/**
+	 * Acquire write access to a private copy of the current value.
+	 * The copy is published when the returned ref goes out of scope. Concurrent writers are serialized.
+	 */
+	TScopedRcuVariableWriteRef<VariableType> Write() { return TScopedRcuVariableWriteRef<VariableType>(*this); }
+
+	/** Publish a new value without copying the previous one. */
+	void Set(VariableType NewValue)
+	{
+		FScopeLock WriteLock(&WriteMutex);
+		Publish(new VariableType(MoveTemp(NewValue)));
+	}
+
+	/** Number of old versions that still wait to be deleted. For diagnostics and tests. */
+	int32 GetNumRetiredValues() const
+	{
+		FScopeLock WriteLock(&WriteMutex);
+		return RetiredValues.Num();
+	}
+
+	/**
+	 * Get a reference to the underlying variable.
+	 * This does not protect the value from being deleted by a concurrent writer, so USE WITH CAUTION!
+	 */
+	FORCEINLINE const VariableType& GetRefWithoutLocking_USE_WITH_CAUTION() const
+	{
+		return *Current.load(std::memory_order_acquire);
+	}
+
+private:
+	struct FRetiredValue
+	{
+		const VariableType* Value = nullptr;
+		uint64 RetireEpoch = 0;
+	};
+
+	std::atomic<const VariableType*> Current;
+
+	// Serializes writers and protects RetiredValues
+	mutable FCriticalSection WriteMutex;
+
+	TArray<FRetiredValue> RetiredValues;
+
+	// Must be called with WriteMutex locked
+	void Publish(const VariableType* NewValue)
+	{
+		using OUU::Runtime::Private::ReadMostly::FEpochManager;
+
+		const VariableType* OldValue = Current.exchange(NewValue, std::memory_order_seq_cst);
+		RetiredValues.Add(FRetiredValue{OldValue, FEpochManager::AdvanceEpoch()});
+
+		// Retired values are in ascending epoch order, so we can stop at the first one that's still in use.
+		int32 NumReclaimed = 0;
+		while (NumReclaimed < RetiredValues.Num() && FEpochManager::CanReclaim(RetiredValues[NumReclaimed].RetireEpoch))
+		{
+			delete RetiredValues[NumReclaimed].Value;
+			NumReclaimed++;
+		}
+		RetiredValues.RemoveAt(0, NumReclaimed, EAllowShrinking::No);
+	}
+};
+
+/** Read reference to a version of a TRcuVariable. Keeps the version alive for the lifetime of this object. */
+template <typename VariableType>
+class TRcuVariableReadRef
+{
+public:
+	TRcuVariableReadRef(TRcuVariableReadRef&& Other) noexcept = default;
+
+	const VariableType& Get() const { return *Value; }
+	const VariableType* operator->() const { return Value; }
+	const VariableType& operator*() const { return *Value; }
+
+	bool operator==(const VariableType& Other) const { return Get() == Other; }
+	bool operator!=(const VariableType& Other) const { return Get() != Other; }
+
+private:
+	friend class TRcuVariable<VariableType>;
+
+	TRcuVariableReadRef(OUU::Runtime::Private::ReadMostly::FEpochReadScope&& InReadScope, const VariableType* InValue) :
+		ReadScope(MoveTemp(InReadScope)), Value(InValue)
+	{
+	}
+
+	OUU::Runtime::Private::ReadMostly::FEpochReadScope ReadScope;
+	const VariableType* Value = nullptr;
+};
+
+/** Scoped write access to a private copy of a TRcuVariable value. Publishes the copy on destruction. */
+template <typename VariableType>
+class TScopedRcuVariableWriteRef
+{
+public:
+	TScopedRcuVariableWriteRef(TScopedRcuVariableWriteRef&& Other) noexcept :
+		Owner(Other.Owner), NewValue(Other.NewValue)
+	{
+		Other.Owner = nullptr;
+		Other.NewValue = nullptr;
+	}
+
+	~TScopedRcuVariableWriteRef()
+	{
+		if (Owner)
+		{
+			Owner->Publish(NewValue);
+			Owner->WriteMutex.Unlock();
+		}
+	}
+
+	VariableType& Get() const { return *NewValue; }
+	VariableType* operator->() const { return NewValue; }
+	VariableType& operator*() const { return *NewValue; }
+
+	template <typename T>
+	VariableType& operator=(T Other)
+	{
+		return Get() = Other;
+	}
+
+private:
+	friend class TRcuVariable<VariableType>;
+
+	explicit TScopedRcuVariableWriteRef(TRcuVariable<VariableType>& InOwner) : Owner(&InOwner)
+	{
+		Owner->WriteMutex.Lock();
+		// Writers are serialized, so the current value can't be retired while we copy it.
+		NewValue = new VariableType(*Owner->Current.load(std::memory_order_acquire));
+	}
+
+	TRcuVariable<VariableType>* Owner = nullptr;
+	VariableType* NewValue = nullptr;
+};
@@ -4,11 +4,30 @@
 
 #include "CoreMinimal.h"
 
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
 // ReSharper disable once CppUnusedIncludeDirective
 #include "Misc/EngineVersionComparison.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Templates/RWLockedVariable.h"
 #include "Traits/ConditionalType.h"
 
+/**
+ * Validate that multi-locks are always acquired in ascending lock address order on each thread.
+ * This catches potential deadlocks between nested multi-locks before they occur.
+ */
+#ifndef OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+	#define OUU_SCOPED_MULTI_RWLOCK_VALIDATION (DO_CHECK && !UE_BUILD_SHIPPING)
+#endif
+
+/**
+ * Emit CPU profiler trace events for the time spent waiting on contended locks.
+ * Uncontended locks are acquired via try-lock first, so they do not emit any events.
+ */
+#ifndef OUU_SCOPED_MULTI_RWLOCK_TRACE
+	#define OUU_SCOPED_MULTI_RWLOCK_TRACE CPUPROFILERTRACE_ENABLED
+#endif
+
 // Forward declaration
 template <typename...>
 class TScopedMultiRWLock;
@@ -16,6 +35,71 @@ class TScopedMultiRWLock;
 /** Implementation details for TScopedMultiRWLock */
 namespace OUU::Runtime::Private::ScopedMultiRWLock
 {
+	/** Lock held by a multi-lock. Stored inline and sorted by lock address. */
+	struct FLockEntry
+	{
+		FRWLock* Lock = nullptr;
+		bool bIsWriteLock = false;
+
+		bool TryLock() const { return bIsWriteLock ? Lock->TryWriteLock() : Lock->TryReadLock(); }
+
+		void Lock_Blocking() const
+		{
+#if OUU_SCOPED_MULTI_RWLOCK_TRACE
+			// Only trace the wait if the lock is contended
+			if (TryLock())
+				return;
+
+			if (bIsWriteLock)
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(TScopedMultiRWLock::WaitForWriteLock);
+				Lock->WriteLock();
+			}
+			else
+			{
+				TRACE_CPUPROFILER_EVENT_SCOPE(TScopedMultiRWLock::WaitForReadLock);
+				Lock->ReadLock();
+			}
+#else
+			if (bIsWriteLock)
+			{
+				Lock->WriteLock();
+			}
+			else
+			{
+				Lock->ReadLock();
+			}
+#endif
+		}
+
+		void Unlock() const
+		{
+			if (bIsWriteLock)
+			{
+				Lock->WriteUnlock();
+			}
+			else
+			{
+				Lock->ReadUnlock();
+			}
+		}
+	};
+
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+	/** Per-thread book keeping of locks held by multi-locks to validate lock order. */
+	struct OUURUNTIME_API FLockOrderValidation
+	{
+		/**
+		 * Check that the locks can be acquired without violating the lock order on this thread.
+		 * Blocking acquisitions must only acquire locks with higher addresses than all locks already held by the
+		 * thread. Try-locks can't deadlock, so they only check for locks that are already held.
+		 */
+		static void ValidateBeforeLock(TArrayView<const FLockEntry> SortedLocks, bool bIsBlocking);
+
+		static void OnLocked(TArrayView<const FLockEntry> SortedLocks);
+		static void OnUnlocked(TArrayView<const FLockEntry> SortedLocks);
+	};
+#endif
 	/**
 	 * Reference to FRWLockedVariable_Base.
 	 * Contains shared info that is required for all read/write locking operations but not for accessing the data.
@@ -113,59 +197,99 @@ namespace OUU::Runtime::Private::ScopedMultiRWLock
  *        IntRef = 3;
  *   }
  *   // after the multi-lock ran out of scope the read/write locks are automatically locked again
+ *
+ *    {
+ *        // Alternatively only try to acquire all locks for up to 1ms.
+ *        // If any of the locks can't be acquired in time, none of them are held.
+ *        auto ScopedMultiLock = TryMakeScopedMultiRWLock(0.001, Read(RWLockedArray), Write(RWLockedInt));
+ *        if (ScopedMultiLock.IsLocked())
+ *        {
+ *            ScopedMultiLock.GetByIdx<1>() = 3;
+ *        }
+ *    }
+ *
+ * Locks are sorted by their address and stored inline, so creating a multi-lock never allocates.
+ * See OUU_SCOPED_MULTI_RWLOCK_VALIDATION and OUU_SCOPED_MULTI_RWLOCK_TRACE for debugging lock order and contention.
  */
 template <typename... LockRefTypes>
 class TScopedMultiRWLock
 {
 public:
 	using FScopedMultiRWLockRef_Base = OUU::Runtime::Private::ScopedMultiRWLock::FScopedMultiRWLockRef_Base;
+	using FLockEntry = OUU::Runtime::Private::ScopedMultiRWLock::FLockEntry;
 	using ThisType = TScopedMultiRWLock<LockRefTypes...>;
 
 	// Number of variables / locks controlled by this multi lock
 	static const uint32 NumLocks = sizeof...(LockRefTypes);
 
-	TScopedMultiRWLock(const LockRefTypes&... InLockReferences) : LockReferences(InLockReferences...)
+	/** Tag type for the try-lock constructor */
+	struct FTryLock
 	{
-		// Add pointers to the locks to the array
-		VisitTupleElements([&](FScopedMultiRWLockRef_Base& LockRef) { LockPointers.Add(&LockRef); }, LockReferences);
+		// Time after which locking is given up. Zero means only a single attempt is made.
+		double TimeoutSeconds = 0.0;
+	};
 
-		// Sort locks by memory address
-		LockPointers.Sort([](const FScopedMultiRWLockRef_Base& Left, const FScopedMultiRWLockRef_Base& Right) -> bool {
-			const FScopedMultiRWLockRef_Base* LeftPtr = &Left;
-			const FScopedMultiRWLockRef_Base* RightPtr = &Right;
-			return LeftPtr < RightPtr;
-		});
+	/** Acquire all locks. Blocks until all of them are acquired. */
+	TScopedMultiRWLock(const LockRefTypes&... InLockReferences) : LockReferences(InLockReferences...)
+	{
+		InitLockEntries();
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+		OUU::Runtime::Private::ScopedMultiRWLock::FLockOrderValidation::ValidateBeforeLock(GetLockEntries(), true);
+#endif
 
 		// Go through all sorted locks and acquire the appropriate lock
-		for (const FScopedMultiRWLockRef_Base* LockRef : LockPointers)
+		for (const FLockEntry& Entry : LockEntries)
 		{
-			if (LockRef->bIsWriteLock)
-			{
-				LockRef->RWLockVariable_Base_Ref.Lock.WriteLock();
-			}
-			else
-			{
-				LockRef->RWLockVariable_Base_Ref.Lock.ReadLock();
-			}
+			Entry.Lock_Blocking();
+		}
+		OnLocked();
+	}
+
+	/**
+	 * Try to acquire all locks until the timeout expires.
+	 * If any lock can't be acquired, all locks acquired so far are released again before retrying, so a failed attempt
+	 * never holds a partial set of locks. Check IsLocked() before accessing any of the values!
+	 */
+	TScopedMultiRWLock(FTryLock TryLock, const LockRefTypes&... InLockReferences) : LockReferences(InLockReferences...)
+	{
+		InitLockEntries();
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+		OUU::Runtime::Private::ScopedMultiRWLock::FLockOrderValidation::ValidateBeforeLock(GetLockEntries(), false);
+#endif
+
+		const double EndTime = FPlatformTime::Seconds() + TryLock.TimeoutSeconds;
+		while (!TryLockAll())
+		{
+			if (FPlatformTime::Seconds() >= EndTime)
+				return;
+
+			FPlatformProcess::Yield();
 		}
+		OnLocked();
 	}
 
+	UE_NONCOPYABLE(TScopedMultiRWLock);
+
 	~TScopedMultiRWLock()
 	{
-		// Go through all sorted locks and release the appropriate lock
-		for (const FScopedMultiRWLockRef_Base* LockRef : LockPointers)
+		if (!bIsLocked)
+			return;
+
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+		OUU::Runtime::Private::ScopedMultiRWLock::FLockOrderValidation::OnUnlocked(GetLockEntries());
+#endif
+
+		// Release in reverse order of acquisition
+		for (int32 Idx = NumLocks - 1; Idx >= 0; Idx--)
 		{
-			if (LockRef->bIsWriteLock)
-			{
-				LockRef->RWLockVariable_Base_Ref.Lock.WriteUnlock();
-			}
-			else
-			{
-				LockRef->RWLockVariable_Base_Ref.Lock.ReadUnlock();
-			}
+			LockEntries[Idx].Unlock();
 		}
 	}
 
+	/** Are all locks held? Always true for blocking multi-locks. Only access values if this returns true. */
+	bool IsLocked() const { return bIsLocked; }
+	explicit operator bool() const { return bIsLocked; }
+
 	/**
 	 * Get a reference to the underlying data variables referenced by this multi lock by index.
 	 * Index order is determined by the order you used in the constructor for creating the scoped multi-lock.
@@ -179,6 +303,7 @@ public:
 			typename TConditionalType<LockRefType::IsWriteLock, VariableType, const VariableType>::Type>
 	ResultType& GetByIdx() const
 	{
+		checkf(bIsLocked, TEXT("Values of a TScopedMultiRWLock must only be accessed if all locks were acquired"));
 		const LockRefType& LockRef = LockReferences.template Get<Idx>();
 		return LockRef.RWLockedVariable_Ref.GetRefWithoutLocking_USE_WITH_CAUTION();
 	}
@@ -217,11 +342,59 @@ public:
 	auto GetPointers() const { return TTransformTuple_Impl<TMakeIntegerSequence<uint32, NumLocks>>::Do(*this); }
 
 private:
-	// Pointers to base types sorted by memory address
-	TArray<FScopedMultiRWLockRef_Base*, TFixedAllocator<NumLocks>> LockPointers;
+	// Locks sorted by lock address. Inline storage, so creating a multi-lock never allocates.
+	FLockEntry LockEntries[NumLocks];
 
 	// References to template instances sorted by same order as passed into constructor
 	TTuple<LockRefTypes...> LockReferences;
+
+	bool bIsLocked = false;
+
+	TArrayView<const FLockEntry> GetLockEntries() const { return MakeArrayView(LockEntries, NumLocks); }
+
+	void InitLockEntries()
+	{
+		int32 NumEntries = 0;
+		VisitTupleElements(
+			[&](FScopedMultiRWLockRef_Base& LockRef) {
+				// Insertion sort by lock address. Lock counts are tiny, so this beats any generic sort.
+				const FLockEntry NewEntry{&LockRef.RWLockVariable_Base_Ref.Lock, LockRef.bIsWriteLock};
+				int32 InsertIdx = NumEntries;
+				while (InsertIdx > 0 && LockEntries[InsertIdx - 1].Lock > NewEntry.Lock)
+				{
+					LockEntries[InsertIdx] = LockEntries[InsertIdx - 1];
+					InsertIdx--;
+				}
+				LockEntries[InsertIdx] = NewEntry;
+				NumEntries++;
+			},
+			LockReferences);
+	}
+
+	/** Try to acquire all locks once. Backs out and releases all acquired locks if any lock is not available. */
+	bool TryLockAll()
+	{
+		for (int32 Idx = 0; Idx < static_cast<int32>(NumLocks); Idx++)
+		{
+			if (!LockEntries[Idx].TryLock())
+			{
+				for (int32 UnlockIdx = Idx - 1; UnlockIdx >= 0; UnlockIdx--)
+				{
+					LockEntries[UnlockIdx].Unlock();
+				}
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void OnLocked()
+	{
+		bIsLocked = true;
+#if OUU_SCOPED_MULTI_RWLOCK_VALIDATION
+		OUU::Runtime::Private::ScopedMultiRWLock::FLockOrderValidation::OnLocked(GetLockEntries());
+#endif
+	}
 };
 
 /**
@@ -234,6 +407,18 @@ auto MakeScopedMultiRWLock(LockRefTypes... LockRefs)
 	return TScopedMultiRWLock<LockRefTypes...>(LockRefs...);
 }
 
+/**
+ * Create a TScopedMultiRWLock (see above) that only tries to acquire the locks until the timeout expires.
+ * The result must be checked with IsLocked() before accessing any values.
+ */
+template <typename... LockRefTypes>
+auto TryMakeScopedMultiRWLock(double TimeoutSeconds, LockRefTypes... LockRefs)
+{
+	return TScopedMultiRWLock<LockRefTypes...>(
+		typename TScopedMultiRWLock<LockRefTypes...>::FTryLock{TimeoutSeconds},
+		LockRefs...);
+}
+
 /**
  * Mark a TRWLockedVariable for WRITE access when passing to MakeScopedMultiRWLock()
  */
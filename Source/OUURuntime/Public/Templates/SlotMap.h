@@ -0,0 +1,253 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "IndexedHandle.h"
+#include "Templates/UnrealTypeTraits.h"
+
+/**
+ * Generational slot map: Associative container that hands out FIndexedHandleBase derived handles for its values.
+ * - Values are stored densely in a contiguous array, so iteration is as fast as iterating a TArray.
+ * - Handles index into a sparse slot table that maps to the dense array, so Add, Remove and Find are O(1)
+ *   without hashing.
+ * - Every slot has a generation counter that is stored in the SerialNumber of the handle and incremented when the
+ *   value is removed. Stale handles are detected and never resolve to a value that was added later.
+ *
+ * Removing swaps the last value into the freed dense index, so value pointers/references and the iteration order are
+ * not stable across removals, but handles are.
+ *
+ * HandleType must be derived from FIndexedHandleBase and constructible from (int32 Index, uint32 SerialNumber).
+ */
+template <typename InHandleType, typename InValueType, typename InAllocatorType = FDefaultAllocator>
+class TSlotMap
+{
+public:
+	using HandleType = InHandleType;
+	using ValueType = InValueType;
+	using AllocatorType = InAllocatorType;
+
+	static_assert(
+		TIsDerivedFrom<HandleType, FIndexedHandleBase>::Value,
+		"TSlotMap handles must be derived from FIndexedHandleBase");
+
+	TSlotMap() = default;
+
+	int32 Num() const { return Values.Num(); }
+	bool IsEmpty() const { return Values.Num() == 0; }
+
+	/** Number of slots (live and free). Handles are never invalidated by growing the slot table. */
+	int32 GetNumSlots() const { return Slots.Num(); }
+
+	void Reserve(int32 Number)
+	{
+		Values.Reserve(Number);
+		DenseToSlot.Reserve(Number);
+		Slots.Reserve(Number);
+	}
+
+	/** Remove all values. All handles that were handed out so far become stale. */
+	void Empty(int32 Slack = 0)
+	{
+		ResetImpl();
+		Values.Empty(Slack);
+		DenseToSlot.Empty(Slack);
+	}
+
+	/** Remove all values, but keep the allocations. All handles that were handed out so far become stale. */
+	void Reset()
+	{
+		ResetImpl();
+		Values.Reset();
+		DenseToSlot.Reset();
+	}
+
+	template <typename... ArgsType>
+	HandleType Emplace(ArgsType&&... Args)
+	{
+		const int32 DenseIndex = Values.Emplace(Forward<ArgsType>(Args)...);
+
+		int32 SlotIndex = FirstFreeSlot;
+		if (SlotIndex != INDEX_NONE)
+		{
+			FirstFreeSlot = Slots[SlotIndex].NextFreeSlot;
+		}
+		else
+		{
+			SlotIndex = Slots.AddDefaulted();
+		}
+
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.DenseIndex = DenseIndex;
+		Slot.NextFreeSlot = INDEX_NONE;
+		DenseToSlot.Add(SlotIndex);
+		return HandleType(SlotIndex, Slot.Generation);
+	}
+
+	FORCEINLINE HandleType Add(const ValueType& Value) { return Emplace(Value); }
+	FORCEINLINE HandleType Add(ValueType&& Value) { return Emplace(MoveTemp(Value)); }
+
+	/** Remove the value of the handle. Returns false if the handle is stale or invalid. */
+	bool Remove(const HandleType& Handle)
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		if (DenseIndex == INDEX_NONE)
+			return false;
+
+		RemoveAtDenseIndex(DenseIndex);
+		return true;
+	}
+
+	/** Remove the value of the handle and move it into OutValue. Returns false if the handle is stale or invalid. */
+	bool RemoveAndCopyValue(const HandleType& Handle, ValueType& OutValue)
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		if (DenseIndex == INDEX_NONE)
+			return false;
+
+		OutValue = MoveTemp(Values[DenseIndex]);
+		RemoveAtDenseIndex(DenseIndex);
+		return true;
+	}
+
+	FORCEINLINE bool Contains(const HandleType& Handle) const { return GetDenseIndex(Handle) != INDEX_NONE; }
+
+	FORCEINLINE ValueType* Find(const HandleType& Handle)
+	{
+		const int32 DenseIndex = GetDenseIndex(Handle);
+		return DenseIndex != INDEX_NONE ? &Values[DenseIndex] : nullptr;
+	}
+
+	FORCEINLINE const ValueType* Find(const HandleType& Handle) const
+	{
+		return const_cast<TSlotMap*>(this)->Find(Handle);
+	}
+
+	FORCEINLINE ValueType& FindChecked(const HandleType& Handle)
+	{
+		ValueType* Value = Find(Handle);
+		check(Value);
+		return *Value;
+	}
+
+	FORCEINLINE const ValueType& FindChecked(const HandleType& Handle) const
+	{
+		return const_cast<TSlotMap*>(this)->FindChecked(Handle);
+	}
+
+	FORCEINLINE ValueType& operator[](const HandleType& Handle) { return FindChecked(Handle); }
+	FORCEINLINE const ValueType& operator[](const HandleType& Handle) const { return FindChecked(Handle); }
+
+	/** All values in dense order. Not stable across removals. */
+	FORCEINLINE TArrayView<ValueType> GetValues() { return Values; }
+	FORCEINLINE TConstArrayView<ValueType> GetValues() const { return Values; }
+
+	/** Handle of the value at the given index of GetValues() */
+	FORCEINLINE HandleType GetHandleAtDenseIndex(int32 DenseIndex) const
+	{
+		const int32 SlotIndex = DenseToSlot[DenseIndex];
+		return HandleType(SlotIndex, Slots[SlotIndex].Generation);
+	}
+
+	/** Call Func(Handle, Value) for all values in dense order. Func must not add or remove values. */
+	template <typename FuncType>
+	void ForEach(FuncType&& Func)
+	{
+		for (int32 DenseIndex = 0; DenseIndex < Values.Num(); ++DenseIndex)
+		{
+			Func(GetHandleAtDenseIndex(DenseIndex), Values[DenseIndex]);
+		}
+	}
+
+	template <typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (int32 DenseIndex = 0; DenseIndex < Values.Num(); ++DenseIndex)
+		{
+			Func(GetHandleAtDenseIndex(DenseIndex), Values[DenseIndex]);
+		}
+	}
+
+	/** Remove all values for which Predicate(Handle, Value) returns true. Returns the number of removed values. */
+	template <typename PredicateType>
+	int32 RemoveAll(PredicateType&& Predicate)
+	{
+		const int32 NumBefore = Values.Num();
+		for (int32 DenseIndex = Values.Num() - 1; DenseIndex >= 0; --DenseIndex)
+		{
+			if (Predicate(GetHandleAtDenseIndex(DenseIndex), Values[DenseIndex]))
+			{
+				RemoveAtDenseIndex(DenseIndex);
+			}
+		}
+		return NumBefore - Values.Num();
+	}
+
+	// Ranged-for support over the dense values
+	FORCEINLINE auto begin() { return Values.begin(); }
+	FORCEINLINE auto begin() const { return Values.begin(); }
+	FORCEINLINE auto end() { return Values.end(); }
+	FORCEINLINE auto end() const { return Values.end(); }
+
+private:
+	struct FSlot
+	{
+		// Index into Values / DenseToSlot while the slot is occupied
+		int32 DenseIndex = INDEX_NONE;
+		// Next slot in the free list while the slot is free
+		int32 NextFreeSlot = INDEX_NONE;
+		// Starts at 1, so default constructed handles (serial number 0) never match
+		uint32 Generation = 1;
+	};
+
+	TArray<ValueType, AllocatorType> Values;
+	TArray<int32, AllocatorType> DenseToSlot;
+	TArray<FSlot, AllocatorType> Slots;
+	int32 FirstFreeSlot = INDEX_NONE;
+
+	FORCEINLINE int32 GetDenseIndex(const HandleType& Handle) const
+	{
+		const int32 SlotIndex = Handle.GetIndex();
+		if (!Slots.IsValidIndex(SlotIndex))
+			return INDEX_NONE;
+
+		const FSlot& Slot = Slots[SlotIndex];
+		return Slot.Generation == Handle.GetSerialNumber() ? Slot.DenseIndex : INDEX_NONE;
+	}
+
+	void RemoveAtDenseIndex(int32 DenseIndex)
+	{
+		const int32 SlotIndex = DenseToSlot[DenseIndex];
+		const int32 LastDenseIndex = Values.Num() - 1;
+		if (DenseIndex != LastDenseIndex)
+		{
+			const int32 LastSlotIndex = DenseToSlot[LastDenseIndex];
+			Slots[LastSlotIndex].DenseIndex = DenseIndex;
+			DenseToSlot[DenseIndex] = LastSlotIndex;
+		}
+		Values.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+		DenseToSlot.RemoveAtSwap(DenseIndex, 1, EAllowShrinking::No);
+
+		FreeSlot(SlotIndex);
+	}
+
+	void FreeSlot(int32 SlotIndex)
+	{
+		FSlot& Slot = Slots[SlotIndex];
+		Slot.DenseIndex = INDEX_NONE;
+		// Skip 0 on wrap around, so default constructed handles stay invalid
+		Slot.Generation = Slot.Generation == MAX_uint32 ? 1 : Slot.Generation + 1;
+		Slot.NextFreeSlot = FirstFreeSlot;
+		FirstFreeSlot = SlotIndex;
+	}
+
+	void ResetImpl()
+	{
+		// Keep the slots (and their generations), so handles from before the reset are detected as stale
+		for (const int32 SlotIndex : DenseToSlot)
+		{
+			FreeSlot(SlotIndex);
+		}
+	}
+};
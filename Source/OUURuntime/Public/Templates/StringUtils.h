@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 
 #include "InterfaceUtils.h"
+#include "Misc/StringBuilder.h"
 #include "Templates/IsArithmetic.h"
 #include "Traits/IsStringType.h"
 
@@ -100,30 +101,112 @@ FString LexToString_QuotedIfString(const T& Value)
 //----------------------------------------------------------------------------------------------------------------------
 
 /**
- * Interprets all elements of an array as LexToString-convertible objects and joins them
- * in a comma separated list enclosed by square brackets (similar to json arrays).
- * Any string types will be quoted.
+ * Append the string representation of a value to a string builder.
+ * Produces the same result as LexToString(Value), but writes directly into the builder, which avoids the intermediate
+ * FString allocation for arithmetic types, strings, names, texts and UObjects.
+ * All other types fall back to LexToString() / ToString().
+ */
+template <typename T>
+void LexAppend(FStringBuilderBase& Builder, const T& Value)
+{
+	if constexpr (std::is_same_v<T, bool>)
+	{
+		Builder << (Value ? TEXT("true") : TEXT("false"));
+	}
+	else if constexpr (TIsCharType<T>::Value)
+	{
+		Builder.AppendChar(Value);
+	}
+	else if constexpr (TIsArithmetic<T>::Value)
+	{
+		// Same format specifier as LexToString() for arithmetic types
+		Builder.Appendf(TFormatSpecifier<T>::GetFormatSpecifier(), Value);
+	}
+	else if constexpr (
+		std::is_same_v<T, FString> || std::is_same_v<T, FStringView> || std::is_same_v<T, const TCHAR*>
+		|| std::is_same_v<T, TCHAR*>)
+	{
+		Builder << Value;
+	}
+	else if constexpr (std::is_same_v<T, FName>)
+	{
+		Value.AppendString(Builder);
+	}
+	else if constexpr (std::is_same_v<T, FText>)
+	{
+		Builder << Value.ToString();
+	}
+	else if constexpr (
+		std::is_pointer_v<T> && TPointerIsConvertibleFromTo<std::remove_pointer_t<T>, const UObject>::Value)
+	{
+		if (IsValid(Value))
+		{
+			Value->GetFName().AppendString(Builder);
+		}
+		else
+		{
+			Builder << TEXT("None");
+		}
+	}
+	else
+	{
+		Builder << LexToString(Value);
+	}
+}
+
+/** LexAppend() variant that quotes string types. Equivalent to LexToString_QuotedIfString(). */
+template <typename T>
+void LexAppend_QuotedIfString(FStringBuilderBase& Builder, const T& Value)
+{
+	if constexpr (TIsStringType<T>::Value)
+	{
+		Builder.AppendChar(TEXT('"'));
+		LexAppend(Builder, Value);
+		Builder.AppendChar(TEXT('"'));
+	}
+	else
+	{
+		LexAppend(Builder, Value);
+	}
+}
+
+/**
+ * Append all elements of an array to a string builder in the same format as ArrayToString().
+ * Use this with a TStringBuilder<N> with sufficient inline storage to join arrays without any heap allocations.
  */
 template <typename ElementType, typename AllocatorType>
-FString ArrayToString(const TArray<ElementType, AllocatorType>& Array, const TCHAR* Separator = TEXT(", "))
+void AppendArrayToString(
+	FStringBuilderBase& Builder,
+	const TArray<ElementType, AllocatorType>& Array,
+	const TCHAR* Separator = TEXT(", "))
 {
 	static_assert(
 		TModels<CLexToStringConvertible, ElementType>::Value,
 		"ElementType must be string convertible with LexToString()!");
-	return FString::Printf(TEXT("[%s]"), *FString::JoinBy(Array, Separator, [](auto& Element) {
-							   return LexToString_QuotedIfString<ElementType>(Element);
-						   }));
-}
 
-//----------------------------------------------------------------------------------------------------------------------
+	Builder.AppendChar(TEXT('['));
+	bool bFirst = true;
+	for (const ElementType& Element : Array)
+	{
+		if (!bFirst)
+		{
+			Builder << Separator;
+		}
+		bFirst = false;
+		LexAppend_QuotedIfString<ElementType>(Builder, Element);
+	}
+	Builder.AppendChar(TEXT(']'));
+}
 
 /**
- * Interprets all elements of a map as LexToString-convertible objects and joins them
- * in a comma separated list enclosed by curly brackets (similar to json maps).
- * Any string types will be quoted.
+ * Append all elements of a map to a string builder in the same format as MapToString().
+ * Use this with a TStringBuilder<N> with sufficient inline storage to join maps without any heap allocations.
  */
 template <typename KeyType, typename ValueType, typename AllocatorType>
-FString MapToString(const TMap<KeyType, ValueType, AllocatorType>& Map, const TCHAR* Separator = TEXT(", "))
+void AppendMapToString(
+	FStringBuilderBase& Builder,
+	const TMap<KeyType, ValueType, AllocatorType>& Map,
+	const TCHAR* Separator = TEXT(", "))
 {
 	static_assert(
 		TModels<CLexToStringConvertible, KeyType>::Value,
@@ -132,10 +215,48 @@ FString MapToString(const TMap<KeyType, ValueType, AllocatorType>& Map, const TC
 		TModels<CLexToStringConvertible, ValueType>::Value,
 		"ValueType must be string convertible with LexToString()!");
 
-	return FString::Printf(TEXT("{%s}"), *FString::JoinBy(Map, Separator, [](auto& Element) {
-							   return FString::Printf(
-								   TEXT("%s : %s"),
-								   *LexToString_QuotedIfString<KeyType>(Element.Key),
-								   *LexToString_QuotedIfString<ValueType>(Element.Value));
-						   }));
+	Builder.AppendChar(TEXT('{'));
+	bool bFirst = true;
+	for (const auto& Pair : Map)
+	{
+		if (!bFirst)
+		{
+			Builder << Separator;
+		}
+		bFirst = false;
+		LexAppend_QuotedIfString<KeyType>(Builder, Pair.Key);
+		Builder << TEXT(" : ");
+		LexAppend_QuotedIfString<ValueType>(Builder, Pair.Value);
+	}
+	Builder.AppendChar(TEXT('}'));
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/**
+ * Interprets all elements of an array as LexToString-convertible objects and joins them
+ * in a comma separated list enclosed by square brackets (similar to json arrays).
+ * Any string types will be quoted.
+ */
+template <typename ElementType, typename AllocatorType>
+FString ArrayToString(const TArray<ElementType, AllocatorType>& Array, const TCHAR* Separator = TEXT(", "))
+{
+	TStringBuilder<256> Builder;
+	AppendArrayToString(Builder, Array, Separator);
+	return FString(Builder.ToView());
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+
+/**
+ * Interprets all elements of a map as LexToString-convertible objects and joins them
+ * in a comma separated list enclosed by curly brackets (similar to json maps).
+ * Any string types will be quoted.
+ */
+template <typename KeyType, typename ValueType, typename AllocatorType>
+FString MapToString(const TMap<KeyType, ValueType, AllocatorType>& Map, const TCHAR* Separator = TEXT(", "))
+{
+	TStringBuilder<256> Builder;
+	AppendMapToString(Builder, Map, Separator);
+	return FString(Builder.ToView());
 }
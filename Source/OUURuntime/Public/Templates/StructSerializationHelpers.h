@@ -4,6 +4,8 @@
 
 #include "CoreMinimal.h"
 
+class UScriptStruct;
+
 namespace OUU::Runtime
 {
 	template <typename StructType>
@@ -39,4 +41,44 @@ namespace OUU::Runtime
 				nullptr);
 		}
 	}
+
+	/**
+	 * Baseline-relative delta serialization of a struct for binary archives.
+	 *
+	 * When saving, only the properties of Data that differ from Baseline are written, prefixed by a bitmask of the
+	 * changed properties. Nested structs without native serializers are serialized as nested deltas, so a single
+	 * changed member of a nested struct does not cause the whole nested struct to be written.
+	 * When loading, Data is initialized from Baseline and the changed properties are read on top of it.
+	 * Data and Baseline may point to the same instance when loading.
+	 * The same baseline must be used for saving and loading, it is not part of the written data.
+	 *
+	 * Properties are filtered by FProperty::ShouldSerializeValue(), so e.g. Ar.ArIsSaveGame is respected.
+	 *
+	 * The data starts with a hash of the property names and types, so data written for a different version of the
+	 * struct fails to load instead of being misinterpreted.
+	 *
+	 * @param	bAllowPodFastPath	If true, numeric, enum and native bool properties of structs flagged as plain old
+	 *								data (STRUCT_IsPlainOldData) are compared with memcmp and serialized as raw bytes.
+	 *								Pointers and names are never copied as raw bytes. This is faster, but the
+	 *								resulting data is only portable between platforms with the same endianness.
+	 *								Saving and loading must use the same value.
+	 * @returns	false if the archive is in an error state afterwards, e.g. because the data was written for a
+	 *			different version of the struct.
+	 */
+	OUURUNTIME_API bool SerializeStructDelta(
+		const UScriptStruct* Struct,
+		FArchive& Ar,
+		void* Data,
+		const void* Baseline,
+		bool bAllowPodFastPath = false);
+
+	template <typename StructType>
+	bool SerializeStructDelta(
+		StructType& StructRef,
+		const StructType& Baseline,
+		FArchive& Ar,
+		bool bAllowPodFastPath = false)
+	{
+		return SerializeStructDelta(StructType::StaticStruct(), Ar, &StructRef, &Baseline, bAllowPodFastPath);
+	}
 } // namespace OUU::Runtime
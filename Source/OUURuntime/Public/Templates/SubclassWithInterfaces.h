@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Templates/InterfaceUtils.h"
 #include "Traits/IsSameWrapper.h"
 
 namespace OUU::Runtime::Private::SubclassWithInterface
@@ -104,7 +105,7 @@ private:
 		static_assert(
 			TOr<TIsSameWrapper<InterfaceClass, InterfaceClasses>...>::Value,
 			"InterfaceClass is not part of TSubclassWithInterfaces InterfaceClasses");
-		return Cast<InterfaceClass>(GetObjectPtr());
+		return OUU::Runtime::InterfaceUtils::CastToInterface<InterfaceClass>(GetObjectPtr());
 	}
 
 public:
@@ -226,10 +227,11 @@ public:
 	{
 	}
 
+	// Uses the cached interface lookup, so repeated checks for the same class are O(1)
 	template <typename InterfaceT>
 	static bool IsImplemented(ObjectBaseClass* Object)
 	{
-		return Cast<InterfaceT>(Object) != nullptr;
+		return Object && OUU::Runtime::InterfaceUtils::ImplementsInterfaceNatively<InterfaceT>(Object->GetClass());
 	}
 
 	template <typename InterfaceTypeA, typename InterfaceTypeB, typename... RemainingInterfaceTypes>
@@ -0,0 +1,168 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "AutomationAllocationCounter.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "HAL/MemoryBase.h"
+	#include "HAL/PlatformTLS.h"
+	#include "Misc/CommandLine.h"
+	#include "Misc/EngineVersionComparison.h"
+	#include "Misc/Parse.h"
+
+	#include <atomic>
+
+namespace OUU::TestUtilities
+{
+	namespace
+	{
+		/**
+		 * Proxy allocator that forwards everything to the wrapped allocator and counts allocations of one thread.
+		 * Outside of FScopedAllocationCounter scopes the overhead is a thread id comparison per allocation.
+		 * All FMalloc hooks are forwarded, so trimming, TLS caches, validation and stats keep working as before.
+		 */
+		class FAllocationCountingMalloc final : public FMalloc
+		{
+		public:
+			FMalloc* InnerMalloc = nullptr;
+			std::atomic<uint32> CountingThreadId{0};
+			std::atomic<int64> NumAllocations{0};
+
+			void* Malloc(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return InnerMalloc->Malloc(Count, Alignment);
+			}
+
+			void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return InnerMalloc->TryMalloc(Count, Alignment);
+			}
+
+			void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				if (Count > 0)
+				{
+					CountAllocation();
+				}
+				return InnerMalloc->Realloc(Original, Count, Alignment);
+			}
+
+			void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+			{
+				if (Count > 0)
+				{
+					CountAllocation();
+				}
+				return InnerMalloc->TryRealloc(Original, Count, Alignment);
+			}
+
+	#if !UE_VERSION_OLDER_THAN(5, 3, 0)
+			void* MallocZeroed(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return InnerMalloc->MallocZeroed(Count, Alignment);
+			}
+
+			void* TryMallocZeroed(SIZE_T Count, uint32 Alignment) override
+			{
+				CountAllocation();
+				return InnerMalloc->TryMallocZeroed(Count, Alignment);
+			}
+	#endif
+
+			void Free(void* Original) override { InnerMalloc->Free(Original); }
+
+			SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+			{
+				return InnerMalloc->QuantizeSize(Count, Alignment);
+			}
+
+			bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+			{
+				return InnerMalloc->GetAllocationSize(Original, SizeOut);
+			}
+
+			void Trim(bool bTrimThreadCaches) override { InnerMalloc->Trim(bTrimThreadCaches); }
+			void SetupTLSCachesOnCurrentThread() override { InnerMalloc->SetupTLSCachesOnCurrentThread(); }
+			void MarkTLSCachesAsUsedOnCurrentThread() override { InnerMalloc->MarkTLSCachesAsUsedOnCurrentThread(); }
+			void MarkTLSCachesAsUnusedOnCurrentThread() override
+			{
+				InnerMalloc->MarkTLSCachesAsUnusedOnCurrentThread();
+			}
+			void ClearAndDisableTLSCachesOnCurrentThread() override
+			{
+				InnerMalloc->ClearAndDisableTLSCachesOnCurrentThread();
+			}
+			void InitializeStatsMetadata() override { InnerMalloc->InitializeStatsMetadata(); }
+			void UpdateStats() override { InnerMalloc->UpdateStats(); }
+			void GetAllocatorStats(FGenericMemoryStats& OutStats) override { InnerMalloc->GetAllocatorStats(OutStats); }
+			void DumpAllocatorStats(FOutputDevice& Ar) override { InnerMalloc->DumpAllocatorStats(Ar); }
+			void OnMallocInitialized() override { InnerMalloc->OnMallocInitialized(); }
+			void OnPreFork() override { InnerMalloc->OnPreFork(); }
+			void OnPostFork() override { InnerMalloc->OnPostFork(); }
+			bool IsInternallyThreadSafe() const override { return InnerMalloc->IsInternallyThreadSafe(); }
+			bool ValidateHeap() override { return InnerMalloc->ValidateHeap(); }
+			const TCHAR* GetDescriptiveName() override { return TEXT("OUU Allocation Counting Proxy"); }
+
+		private:
+			void CountAllocation()
+			{
+				if (FPlatformTLS::GetCurrentThreadId() == CountingThreadId.load(std::memory_order_relaxed))
+				{
+					NumAllocations.fetch_add(1, std::memory_order_relaxed);
+				}
+			}
+		};
+
+		// Never destroyed: It stays installed as GMalloc until the process exits.
+		FAllocationCountingMalloc& GetCountingMalloc()
+		{
+			static FAllocationCountingMalloc* Instance = new FAllocationCountingMalloc();
+			return *Instance;
+		}
+	} // namespace
+
+	void Private::InstallAllocationCountingMalloc()
+	{
+		// Opt-in only: Replacing the allocator of every session that loads the test utilities would change allocator
+		// behavior for all users, even if no allocation test ever runs.
+		if (FParse::Param(FCommandLine::Get(), TEXT("OUUCountAllocations")) == false)
+			return;
+
+		check(IsInGameThread());
+		FAllocationCountingMalloc& CountingMalloc = GetCountingMalloc();
+		if (GMalloc == &CountingMalloc)
+			return;
+
+		// InnerMalloc must be visible before any thread can observe the proxy as GMalloc.
+		// Threads that still use the previous GMalloc are fine, because it stays valid as InnerMalloc.
+		CountingMalloc.InnerMalloc = GMalloc;
+		FPlatformMisc::MemoryBarrier();
+		GMalloc = &CountingMalloc;
+		FPlatformMisc::MemoryBarrier();
+	}
+
+	bool FScopedAllocationCounter::IsAvailable() { return GMalloc == &GetCountingMalloc(); }
+
+	FScopedAllocationCounter::FScopedAllocationCounter()
+	{
+		FAllocationCountingMalloc& CountingMalloc = GetCountingMalloc();
+		checkf(IsAvailable(), TEXT("Allocation counting requires -OUUCountAllocations. Check IsAvailable() first."));
+		checkf(
+			CountingMalloc.CountingThreadId.load() == 0,
+			TEXT("Only one FScopedAllocationCounter may be active at a time"));
+
+		CountingMalloc.NumAllocations = 0;
+		CountingMalloc.CountingThreadId = FPlatformTLS::GetCurrentThreadId();
+	}
+
+	FScopedAllocationCounter::~FScopedAllocationCounter() { GetCountingMalloc().CountingThreadId = 0; }
+
+	int64 FScopedAllocationCounter::GetNumAllocations() const { return GetCountingMalloc().NumAllocations.load(); }
+
+	void FScopedAllocationCounter::Reset() { GetCountingMalloc().NumAllocations = 0; }
+} // namespace OUU::TestUtilities
+
+#endif
@@ -2,6 +2,21 @@
 
 #include "CoreMinimal.h"
 
+#include "AutomationAllocationCounter.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_MODULE(FDefaultModuleImpl, OUUTestUtilities)
+class FOUUTestUtilitiesModule : public IModuleInterface
+{
+	// - IModuleInterface
+	void StartupModule() override
+	{
+#if WITH_AUTOMATION_WORKER
+		// Installed once up-front (and only with -OUUCountAllocations), because swapping GMalloc per test would race
+		// with allocations on other threads
+		OUU::TestUtilities::Private::InstallAllocationCountingMalloc();
+#endif
+	}
+	// --
+};
+
+IMPLEMENT_MODULE(FOUUTestUtilitiesModule, OUUTestUtilities)
@@ -0,0 +1,44 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_AUTOMATION_WORKER
+
+namespace OUU::TestUtilities
+{
+	/**
+	 * Counts heap allocations (FMemory Malloc and Realloc calls) made on the calling thread while this object is in
+	 * scope. Intended for tests that assert that a code path does not allocate or that an optimization reduced the
+	 * number of allocations.
+	 * Counting requires an allocator proxy that wraps GMalloc. It's only installed when the process is started with
+	 * -OUUCountAllocations, so regular editor and game sessions keep their allocator untouched. Without the flag,
+	 * IsAvailable() returns false and tests should skip their allocation assertions.
+	 * Only one counter may be active at a time.
+	 */
+	class OUUTESTUTILITIES_API FScopedAllocationCounter
+	{
+	public:
+		FScopedAllocationCounter();
+		~FScopedAllocationCounter();
+
+		UE_NONCOPYABLE(FScopedAllocationCounter);
+
+		/** @returns if the process was started with -OUUCountAllocations and allocations can be counted */
+		static bool IsAvailable();
+
+		/** Number of allocations on the owning thread since construction or the last Reset() */
+		int64 GetNumAllocations() const;
+
+		void Reset();
+	};
+
+	namespace Private
+	{
+		/** Wrap GMalloc with the counting allocator proxy if requested via command line. Called on module startup. */
+		void InstallAllocationCountingMalloc();
+	} // namespace Private
+} // namespace OUU::TestUtilities
+
+#endif
@@ -0,0 +1,71 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_AUTOMATION_WORKER
+
+/**
+ * Automation test flags for benchmarks.
+ * Benchmarks are in the perf filter, so they are not executed with the regular product tests.
+ */
+constexpr EAutomationTestFlags DEFAULT_OUU_BENCHMARK_FLAGS =
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::PerfFilter;
+
+namespace OUU::TestUtilities
+{
+	struct FBenchmarkResult
+	{
+		FString Name;
+		int64 NumIterations = 0;
+		double TotalSeconds = 0.0;
+
+		double GetNanosecondsPerIteration() const
+		{
+			return NumIterations > 0 ? (TotalSeconds * 1.e9) / NumIterations : 0.0;
+		}
+
+		FString ToString() const
+		{
+			return FString::Printf(
+				TEXT("%s: %.3fms total, %.2fns / iteration (%lld iterations)"),
+				*Name,
+				TotalSeconds * 1000.0,
+				GetNanosecondsPerIteration(),
+				NumIterations);
+		}
+	};
+
+	/**
+	 * Measure the wall clock time of a single execution of a benchmark body.
+	 * @param	NumIterations	Number of iterations the body performs internally. Only used for per-iteration stats.
+	 */
+	template <typename BodyType>
+	FBenchmarkResult RunBenchmark(const FString& Name, int64 NumIterations, BodyType&& Body)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Body();
+		const double EndTime = FPlatformTime::Seconds();
+
+		return FBenchmarkResult{Name, NumIterations, EndTime - StartTime};
+	}
+
+	/** Run a benchmark and add its result as info to the automation test. */
+	template <typename BodyType>
+	FBenchmarkResult RunAndReportBenchmark(
+		FAutomationTestBase& AutomationTest,
+		const FString& Name,
+		int64 NumIterations,
+		BodyType&& Body)
+	{
+		FBenchmarkResult Result = RunBenchmark(Name, NumIterations, Forward<BodyType>(Body));
+		AutomationTest.AddInfo(Result.ToString());
+		return Result;
+	}
+} // namespace OUU::TestUtilities
+
+#endif
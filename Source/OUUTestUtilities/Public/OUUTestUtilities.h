@@ -11,6 +11,8 @@
 // AutomationTest utilities.
 //////////////////////////////////////////////////////////////////////////
 
+	#include "AutomationAllocationCounter.h"
+	#include "AutomationBenchmarkUtils.h"
 	#include "AutomationSpecTestMacros.h"
 	#include "AutomationTestParameterParser.h"
 	#include "AutomationTestWorld.h"
@@ -0,0 +1,71 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "GameEntitlements/OUUGameEntitlementBitSet.h"
+
+BEGIN_DEFINE_SPEC(
+	FOUUGameEntitlementBitSetSpec,
+	"OpenUnrealUtilities.Runtime.GameEntitlements.BitSet",
+	DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FOUUGameEntitlementBitSetSpec)
+
+void FOUUGameEntitlementBitSetSpec::Define()
+{
+	Describe("Contains", [this]() {
+		It("should contain added indices across word boundaries", [this]() {
+			FOUUGameEntitlementBitSet BitSet;
+			BitSet.Add(1);
+			BitSet.Add(63);
+			BitSet.Add(64);
+			BitSet.Add(300);
+
+			SPEC_TEST_TRUE(BitSet.Contains(1));
+			SPEC_TEST_TRUE(BitSet.Contains(63));
+			SPEC_TEST_TRUE(BitSet.Contains(64));
+			SPEC_TEST_TRUE(BitSet.Contains(300));
+			SPEC_TEST_FALSE(BitSet.Contains(0));
+			SPEC_TEST_FALSE(BitSet.Contains(65));
+			SPEC_TEST_EQUAL(BitSet.Num(), 4);
+		});
+
+		It("should never contain negative or out of range indices", [this]() {
+			FOUUGameEntitlementBitSet BitSet;
+			BitSet.Reset(10);
+			SPEC_TEST_FALSE(BitSet.Contains(INDEX_NONE));
+			SPEC_TEST_FALSE(BitSet.Contains(1000));
+			SPEC_TEST_TRUE(BitSet.IsEmpty());
+		});
+	});
+
+	Describe("ContainsAll", [this]() {
+		It("should be true for empty masks", [this]() {
+			const FOUUGameEntitlementBitSet Active;
+			SPEC_TEST_TRUE(Active.ContainsAll(FOUUGameEntitlementBitSet()));
+		});
+
+		It("should check that all entitlements of the mask are in the set", [this]() {
+			FOUUGameEntitlementBitSet Active;
+			Active.Add(2);
+			Active.Add(70);
+
+			FOUUGameEntitlementBitSet SatisfiedMask;
+			SatisfiedMask.Add(70);
+			FOUUGameEntitlementBitSet UnsatisfiedMask;
+			UnsatisfiedMask.Add(2);
+			UnsatisfiedMask.Add(3);
+			FOUUGameEntitlementBitSet LongerMask;
+			LongerMask.Add(500);
+
+			SPEC_TEST_TRUE(Active.ContainsAll(SatisfiedMask));
+			SPEC_TEST_FALSE(Active.ContainsAll(UnsatisfiedMask));
+			SPEC_TEST_FALSE(Active.ContainsAll(LongerMask));
+			SPEC_TEST_TRUE(Active.ContainsAny(UnsatisfiedMask));
+			SPEC_TEST_FALSE(Active.ContainsAny(LongerMask));
+		});
+	});
+}
+
+#endif
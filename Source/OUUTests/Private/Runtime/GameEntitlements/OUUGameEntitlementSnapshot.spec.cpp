@@ -0,0 +1,228 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "GameEntitlements/OUUGameEntitlementSnapshot.h"
+	#include "GameEntitlements/OUUGameEntitlements.h"
+	#include "GameEntitlements/OUUGameEntitlementsSettings.h"
+	#include "OUUGameEntitlementsTests_Tags.h"
+	#include "UObject/Package.h"
+
+namespace OUU::Tests::GameEntitlementSnapshot
+{
+	/** Only registered while a test runs. See OUU_DECLARE_TEST_GAMEPLAY_TAG */
+	struct FTestTags
+	{
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_Active, "GameEntitlements.Module.OUUTests.Snapshot.Active");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_Inactive, "GameEntitlements.Module.OUUTests.Snapshot.Inactive");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Version_WithModule, "GameEntitlements.Version.OUUTests.Snapshot.WithModule");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Version_Empty, "GameEntitlements.Version.OUUTests.Snapshot.Empty");
+	};
+
+	const FPrimaryAssetType BlockedAssetType = TEXT("OUUTestsBlockedItem");
+	const FPrimaryAssetType AllowedAssetType = TEXT("OUUTestsAllowedItem");
+
+	FOUUGameEntitlementContentRule MakeRule(const TCHAR* Directory, FPrimaryAssetType AssetType, FGameplayTag Module)
+	{
+		FOUUGameEntitlementContentRule Rule;
+		Rule.ContentDirectory.Path = Directory;
+		Rule.PrimaryAssetType = AssetType;
+		Rule.RequiredModules.AddTag(Module);
+		return Rule;
+	}
+
+	FOUUGameEntitlementSnapshotRef MakeSnapshot(
+		const FTestTags& Tags,
+		TConstArrayView<FOUUGameEntitlementContentRule> ContentRules)
+	{
+		TMap<FGameplayTag, int32> EntitlementIndices;
+		EntitlementIndices.Add(Tags.Module_Active, 1);
+		EntitlementIndices.Add(Tags.Module_Inactive, 2);
+
+		FOUUGameEntitlementBitSet ActiveEntitlementBits;
+		ActiveEntitlementBits.Add(1);
+
+		FGameplayTagContainer ActiveEntitlements;
+		ActiveEntitlements.AddTag(Tags.Module_Active);
+
+		return FOUUGameEntitlementSnapshot::Create(
+			1,
+			FOUUGameEntitlementVersion::TryConvert(Tags.Version_WithModule),
+			ActiveEntitlements,
+			ActiveEntitlementBits,
+			EntitlementIndices,
+			ContentRules);
+	}
+} // namespace OUU::Tests::GameEntitlementSnapshot
+
+BEGIN_DEFINE_SPEC(
+	FOUUGameEntitlementSnapshotSpec,
+	"OpenUnrealUtilities.Runtime.GameEntitlements.Snapshot",
+	DEFAULT_OUU_TEST_FLAGS)
+	TUniquePtr<OUU::Tests::GameEntitlementSnapshot::FTestTags> Tags;
+END_DEFINE_SPEC(FOUUGameEntitlementSnapshotSpec)
+
+void FOUUGameEntitlementSnapshotSpec::Define()
+{
+	using namespace OUU::Tests::GameEntitlementSnapshot;
+
+	BeforeEach([this]() { Tags = MakeUnique<FTestTags>(); });
+
+	AfterEach([this]() { OUU::Tests::GameEntitlements::UnregisterTestTags(Tags); });
+
+	Describe("IsEntitled", [this]() {
+		It("should check the copied entitlements", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {});
+			SPEC_TEST_TRUE(Snapshot->IsInitialized());
+			SPEC_TEST_TRUE(Snapshot->IsEntitled(Tags->Module_Active));
+			SPEC_TEST_FALSE(Snapshot->IsEntitled(Tags->Module_Inactive));
+			SPEC_TEST_FALSE(Snapshot->IsEntitled(Tags->Version_WithModule));
+		});
+
+		It("should treat invalid tags as no requirements like the subsystem", [this]() {
+			SPEC_TEST_TRUE(MakeSnapshot(*Tags, {})->IsEntitled(FGameplayTag()));
+		});
+
+		It("should check masks created by the snapshot", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {});
+			FGameplayTagContainer Modules;
+			Modules.AddTag(Tags->Module_Active);
+			SPEC_TEST_TRUE(Snapshot->IsEntitled(Snapshot->MakeEntitlementMask(Modules)));
+
+			Modules.AddTag(Tags->Module_Inactive);
+			SPEC_TEST_FALSE(Snapshot->IsEntitled(Snapshot->MakeEntitlementMask(Modules)));
+
+			FGameplayTagContainer UnknownTags;
+			UnknownTags.AddTag(Tags->Version_WithModule);
+			SPEC_TEST_FALSE(Snapshot->IsEntitled(Snapshot->MakeEntitlementMask(UnknownTags)));
+		});
+	});
+
+	Describe("IsEntitledToContent", [this]() {
+		It("should block content in directories of rules with inactive modules", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT("/Game/DLC"), {}, Tags->Module_Inactive)});
+			SPEC_TEST_TRUE(Snapshot->HasBlockedContent());
+			SPEC_TEST_FALSE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/Item.Item"))));
+			SPEC_TEST_FALSE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/Sub/Item.Item"))));
+			SPEC_TEST_FALSE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/dlc/Item.Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/Base/Item.Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath()));
+		});
+
+		It("should not block sibling directories with the same prefix", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT("/Game/DLC"), {}, Tags->Module_Inactive)});
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC10/Item.Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLCItem.DLCItem"))));
+		});
+
+		It("should ignore trailing slashes of rule directories", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT("/Game/DLC/"), {}, Tags->Module_Inactive)});
+			SPEC_TEST_FALSE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/Item.Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC10/Item.Item"))));
+		});
+
+		It("should not block content of rules with active modules", [this]() {
+			const auto Snapshot =
+				MakeSnapshot(*Tags, {MakeRule(TEXT("/Game/DLC"), BlockedAssetType, Tags->Module_Active)});
+			SPEC_TEST_FALSE(Snapshot->HasBlockedContent());
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/Item.Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FPrimaryAssetId(BlockedAssetType, TEXT("Item"))));
+		});
+
+		It("should only match primary asset IDs by type", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT(""), BlockedAssetType, Tags->Module_Inactive)});
+			SPEC_TEST_FALSE(Snapshot->IsEntitledToContent(FPrimaryAssetId(BlockedAssetType, TEXT("Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FPrimaryAssetId(AllowedAssetType, TEXT("Item"))));
+			SPEC_TEST_TRUE(Snapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/Item.Item"))));
+		});
+	});
+
+	Describe("RemoveUnentitledContent", [this]() {
+		It("should remove blocked soft object paths and pointers", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT("/Game/DLC"), {}, Tags->Module_Inactive)});
+			TArray<FSoftObjectPath> Paths{
+				FSoftObjectPath(TEXT("/Game/DLC/A.A")),
+				FSoftObjectPath(TEXT("/Game/Base/B.B")),
+				FSoftObjectPath(TEXT("/Game/DLC10/C.C"))};
+			SPEC_TEST_EQUAL(Snapshot->RemoveUnentitledContent(Paths), 1);
+			SPEC_TEST_EQUAL(Paths.Num(), 2);
+			SPEC_TEST_EQUAL(Paths[0], FSoftObjectPath(TEXT("/Game/Base/B.B")));
+
+			TArray<TSoftObjectPtr<UObject>> SoftPtrs{
+				TSoftObjectPtr<UObject>(FSoftObjectPath(TEXT("/Game/DLC/A.A"))),
+				TSoftObjectPtr<UObject>(FSoftObjectPath(TEXT("/Game/Base/B.B")))};
+			SPEC_TEST_EQUAL(Snapshot->RemoveUnentitledContent(SoftPtrs), 1);
+			SPEC_TEST_EQUAL(SoftPtrs.Num(), 1);
+		});
+
+		It("should remove blocked primary asset IDs", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {MakeRule(TEXT(""), BlockedAssetType, Tags->Module_Inactive)});
+			TArray<FPrimaryAssetId> AssetIds{
+				FPrimaryAssetId(BlockedAssetType, TEXT("A")),
+				FPrimaryAssetId(AllowedAssetType, TEXT("B")),
+				FPrimaryAssetId(BlockedAssetType, TEXT("C"))};
+			SPEC_TEST_EQUAL(Snapshot->RemoveUnentitledContent(AssetIds), 2);
+			SPEC_TEST_EQUAL(AssetIds.Num(), 1);
+			SPEC_TEST_EQUAL(AssetIds[0], FPrimaryAssetId(AllowedAssetType, TEXT("B")));
+		});
+
+		It("should keep all content if there are no rules", [this]() {
+			const auto Snapshot = MakeSnapshot(*Tags, {});
+			TArray<FSoftObjectPath> Paths{FSoftObjectPath(TEXT("/Game/DLC/A.A"))};
+			TArray<FPrimaryAssetId> AssetIds{FPrimaryAssetId(BlockedAssetType, TEXT("A"))};
+
+			SPEC_TEST_FALSE(Snapshot->HasBlockedContent());
+			SPEC_TEST_EQUAL(Snapshot->RemoveUnentitledContent(Paths), 0);
+			SPEC_TEST_EQUAL(Snapshot->RemoveUnentitledContent(AssetIds), 0);
+			SPEC_TEST_EQUAL(Paths.Num(), 1);
+			SPEC_TEST_EQUAL(AssetIds.Num(), 1);
+		});
+	});
+
+	Describe("GetCurrent", [this]() {
+		It("should always return a valid snapshot", [this]() {
+			const FOUUGameEntitlementSnapshotRef Snapshot = FOUUGameEntitlementSnapshot::GetCurrent();
+			SPEC_TEST_TRUE(Snapshot->IsEntitled(FGameplayTag()));
+			SPEC_TEST_EQUAL(Snapshot.ToSharedPtr(), FOUUGameEntitlementSnapshot::GetCurrent().ToSharedPtr());
+		});
+	});
+
+	#if WITH_DEV_AUTOMATION_TESTS
+	Describe("UOUUGameEntitlementsSubsystem", [this]() {
+		It("should create a new snapshot on every refresh and keep old snapshots valid", [this]() {
+			auto* Settings = NewObject<UOUUGameEntitlementSettings>(GetTransientPackage());
+			FGameplayTagContainer Modules;
+			Modules.AddTag(Tags->Module_Active);
+			Settings->EntitlementsPerVersion.Add(
+				FOUUGameEntitlementVersion::TryConvert(Tags->Version_WithModule),
+				Modules);
+			Settings->ContentRules.Add(MakeRule(TEXT("/Game/DLC"), {}, Tags->Module_Active));
+
+			auto* Subsystem = NewObject<UOUUGameEntitlementsSubsystem>(GetTransientPackage());
+			const FOUUGameEntitlementSnapshotRef PublishedSnapshot = FOUUGameEntitlementSnapshot::GetCurrent();
+
+			const FOUUGameEntitlementSnapshotRef OldSnapshot = Subsystem->ActivateVersion_ForTesting(
+				FOUUGameEntitlementVersion::TryConvert(Tags->Version_WithModule),
+				*Settings);
+			const FOUUGameEntitlementSnapshotRef NewSnapshot = Subsystem->ActivateVersion_ForTesting(
+				FOUUGameEntitlementVersion::TryConvert(Tags->Version_Empty),
+				*Settings);
+
+			SPEC_TEST_TRUE(OldSnapshot->IsInitialized());
+			SPEC_TEST_EQUAL(NewSnapshot->GetSerialNumber(), OldSnapshot->GetSerialNumber() + 1);
+
+			SPEC_TEST_TRUE(OldSnapshot->IsEntitled(Tags->Module_Active));
+			SPEC_TEST_TRUE(OldSnapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/A.A"))));
+			SPEC_TEST_FALSE(NewSnapshot->IsEntitled(Tags->Module_Active));
+			SPEC_TEST_FALSE(NewSnapshot->IsEntitledToContent(FSoftObjectPath(TEXT("/Game/DLC/A.A"))));
+
+			// Instances that are not registered with the engine must not replace the snapshot of the real subsystem
+			SPEC_TEST_EQUAL(FOUUGameEntitlementSnapshot::GetCurrent().ToSharedPtr(), PublishedSnapshot.ToSharedPtr());
+		});
+	});
+	#endif
+}
+
+#endif
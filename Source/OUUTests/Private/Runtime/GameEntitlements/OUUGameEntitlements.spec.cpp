@@ -0,0 +1,223 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER && WITH_DEV_AUTOMATION_TESTS
+
+	#include "GameEntitlements/OUUGameEntitlements.h"
+	#include "GameEntitlements/OUUGameEntitlementsSettings.h"
+	#include "OUUGameEntitlementsTests_Tags.h"
+	#include "UObject/Package.h"
+
+namespace OUU::Tests::GameEntitlements
+{
+	/** Only registered while a test runs. See OUU_DECLARE_TEST_GAMEPLAY_TAG */
+	struct FTestTags
+	{
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_A, "GameEntitlements.Module.OUUTests.A");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_B, "GameEntitlements.Module.OUUTests.B");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_NestedChild, "GameEntitlements.Module.OUUTests.Nested.Child");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Module_Inactive, "GameEntitlements.Module.OUUTests.Inactive");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Collection_CycleX, "GameEntitlements.Collection.OUUTests.CycleX");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Collection_CycleY, "GameEntitlements.Collection.OUUTests.CycleY");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Collection_Outer, "GameEntitlements.Collection.OUUTests.Outer");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Collection_Inner, "GameEntitlements.Collection.OUUTests.Inner");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Version_Cycle, "GameEntitlements.Version.OUUTests.Cycle");
+		OUU_DECLARE_TEST_GAMEPLAY_TAG(Version_Nested, "GameEntitlements.Version.OUUTests.Nested");
+	};
+
+	FGameplayTagContainer MakeContainer(std::initializer_list<FGameplayTag> Tags)
+	{
+		FGameplayTagContainer Result;
+		for (const FGameplayTag& Tag : Tags)
+		{
+			Result.AddTag(Tag);
+		}
+		return Result;
+	}
+
+	UOUUGameEntitlementSettings* MakeSettings(const FTestTags& Tags)
+	{
+		auto* Settings = NewObject<UOUUGameEntitlementSettings>(GetTransientPackage());
+		Settings->EntitlementsPerVersion.Add(
+			FOUUGameEntitlementVersion::TryConvert(Tags.Version_Cycle),
+			MakeContainer({Tags.Collection_CycleX}));
+		Settings->EntitlementsPerVersion.Add(
+			FOUUGameEntitlementVersion::TryConvert(Tags.Version_Nested),
+			MakeContainer({Tags.Module_A, Tags.Collection_Outer}));
+
+		// CycleX and CycleY reference each other
+		Settings->ModuleCollections.Add(
+			FOUUGameEntitlementCollection::TryConvert(Tags.Collection_CycleX),
+			MakeContainer({Tags.Module_A, Tags.Collection_CycleY}));
+		Settings->ModuleCollections.Add(
+			FOUUGameEntitlementCollection::TryConvert(Tags.Collection_CycleY),
+			MakeContainer({Tags.Module_B, Tags.Collection_CycleX}));
+
+		Settings->ModuleCollections.Add(
+			FOUUGameEntitlementCollection::TryConvert(Tags.Collection_Outer),
+			MakeContainer({Tags.Collection_Inner}));
+		Settings->ModuleCollections.Add(
+			FOUUGameEntitlementCollection::TryConvert(Tags.Collection_Inner),
+			MakeContainer({Tags.Module_NestedChild}));
+		return Settings;
+	}
+
+	/** Reference implementation: The fixpoint iteration the subsystem used before compiling entitlements to bits */
+	FGameplayTagContainer ComputeEntitlementsWithFixpoint(
+		const FOUUGameEntitlementVersion& Version,
+		const UOUUGameEntitlementSettings& Settings)
+	{
+		FGameplayTagContainer Result;
+		if (auto* EntitlementsPtr = Settings.EntitlementsPerVersion.Find(Version))
+		{
+			Result = *EntitlementsPtr;
+		}
+
+		int32 LastNum = -1;
+		while (Result.Num() != LastNum)
+		{
+			LastNum = Result.Num();
+			const FGameplayTagContainer PreviousResult = Result;
+			for (const FGameplayTag& Tag : PreviousResult)
+			{
+				if (auto* EntitlementsPtr =
+						Settings.ModuleCollections.Find(FOUUGameEntitlementCollection::TryConvert(Tag)))
+				{
+					Result.AppendTags(*EntitlementsPtr);
+				}
+			}
+		}
+		return Result;
+	}
+
+	/** All test tags including their parents up to the entitlement roots */
+	TArray<FGameplayTag> GetAllTestTags(const FTestTags& Tags)
+	{
+		FGameplayTagContainer Result = MakeContainer(
+			{Tags.Module_A,
+			 Tags.Module_B,
+			 Tags.Module_NestedChild,
+			 Tags.Module_Inactive,
+			 Tags.Collection_CycleX,
+			 Tags.Collection_CycleY,
+			 Tags.Collection_Outer,
+			 Tags.Collection_Inner});
+		Result.AppendTags(Result.GetGameplayTagParents());
+		return Result.GetGameplayTagArray();
+	}
+} // namespace OUU::Tests::GameEntitlements
+
+BEGIN_DEFINE_SPEC(
+	FOUUGameEntitlementsSubsystemSpec,
+	"OpenUnrealUtilities.Runtime.GameEntitlements.Subsystem",
+	DEFAULT_OUU_TEST_FLAGS)
+	TUniquePtr<OUU::Tests::GameEntitlements::FTestTags> Tags;
+	UOUUGameEntitlementSettings* Settings = nullptr;
+	UOUUGameEntitlementsSubsystem* Subsystem = nullptr;
+
+	void ActivateVersion(const FGameplayTag& VersionTag)
+	{
+		Subsystem->ActivateVersion_ForTesting(FOUUGameEntitlementVersion::TryConvert(VersionTag), *Settings);
+	}
+
+	bool TestParityWithFixpoint(const FGameplayTag& VersionTag)
+	{
+		using namespace OUU::Tests::GameEntitlements;
+
+		ActivateVersion(VersionTag);
+		const FGameplayTagContainer Expected =
+			ComputeEntitlementsWithFixpoint(FOUUGameEntitlementVersion::TryConvert(VersionTag), *Settings);
+
+		bool bResult = TestTrue(TEXT("Active entitlements match"), Subsystem->K2_GetActiveEntitlements() == Expected);
+		for (const FGameplayTag& Tag : GetAllTestTags(*Tags))
+		{
+			bResult &= TestEqual(
+				Tag.ToString(),
+				Subsystem->IsEntitledToIndex(Subsystem->GetEntitlementIndex(Tag)),
+				Expected.HasTag(Tag));
+		}
+		return bResult;
+	}
+END_DEFINE_SPEC(FOUUGameEntitlementsSubsystemSpec)
+
+void FOUUGameEntitlementsSubsystemSpec::Define()
+{
+	using namespace OUU::Tests::GameEntitlements;
+
+	BeforeEach([this]() {
+		Tags = MakeUnique<FTestTags>();
+		Settings = MakeSettings(*Tags);
+		Subsystem = NewObject<UOUUGameEntitlementsSubsystem>(GetTransientPackage());
+	});
+
+	AfterEach([this]() {
+		Subsystem = nullptr;
+		Settings = nullptr;
+
+		UnregisterTestTags(Tags);
+	});
+
+	Describe("ActiveEntitlements", [this]() {
+		It("should resolve collections that reference each other", [this]() {
+			TestParityWithFixpoint(Tags->Version_Cycle);
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_A)));
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_B)));
+			SPEC_TEST_FALSE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_Inactive)));
+		});
+
+		It("should resolve nested collections", [this]() {
+			TestParityWithFixpoint(Tags->Version_Nested);
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_NestedChild)));
+			SPEC_TEST_FALSE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_B)));
+		});
+
+		It("should be entitled to parents of active tags like FGameplayTagContainer::HasTag", [this]() {
+			ActivateVersion(Tags->Version_Nested);
+			const FGameplayTag NestedParent = Tags->Module_NestedChild.GetTag().RequestDirectParent();
+
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(NestedParent)));
+			SPEC_TEST_TRUE(Subsystem->K2_GetActiveEntitlements().HasTag(NestedParent));
+		});
+
+		It("should have no entitlements for versions without settings", [this]() {
+			Subsystem->ActivateVersion_ForTesting(FOUUGameEntitlementVersion(), *Settings);
+			SPEC_TEST_EQUAL(Subsystem->K2_GetActiveEntitlements().Num(), 0);
+			SPEC_TEST_FALSE(Subsystem->IsEntitled(FOUUGameEntitlementModule::TryConvert(Tags->Module_A)));
+		});
+	});
+
+	Describe("GetEntitlementIndex", [this]() {
+		It("should map tags that are not modules or collections to UnknownEntitlementIndex", [this]() {
+			ActivateVersion(Tags->Version_Cycle);
+
+			constexpr int32 UnknownIndex = UOUUGameEntitlementsSubsystem::UnknownEntitlementIndex;
+			SPEC_TEST_EQUAL(Subsystem->GetEntitlementIndex(Tags->Version_Cycle), UnknownIndex);
+			SPEC_TEST_EQUAL(Subsystem->GetEntitlementIndex(FGameplayTag()), UnknownIndex);
+			SPEC_TEST_FALSE(Subsystem->IsEntitledToIndex(UnknownIndex));
+			SPEC_TEST_NOT_EQUAL(Subsystem->GetEntitlementIndex(Tags->Module_A), UnknownIndex);
+		});
+	});
+
+	Describe("MakeEntitlementMask", [this]() {
+		It("should only be satisfied if all modules are active", [this]() {
+			ActivateVersion(Tags->Version_Cycle);
+
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(Subsystem->MakeEntitlementMask(MakeContainer({Tags->Module_A}))));
+			SPEC_TEST_TRUE(
+				Subsystem->IsEntitled(Subsystem->MakeEntitlementMask(MakeContainer({Tags->Module_A, Tags->Module_B}))));
+			SPEC_TEST_FALSE(Subsystem->IsEntitled(
+				Subsystem->MakeEntitlementMask(MakeContainer({Tags->Module_A, Tags->Module_Inactive}))));
+			SPEC_TEST_TRUE(Subsystem->IsEntitled(Subsystem->MakeEntitlementMask(FGameplayTagContainer())));
+		});
+
+		It("should never be satisfied if it contains unknown tags", [this]() {
+			ActivateVersion(Tags->Version_Cycle);
+
+			SPEC_TEST_FALSE(Subsystem->IsEntitled(
+				Subsystem->MakeEntitlementMask(MakeContainer({Tags->Module_A, Tags->Version_Cycle}))));
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,33 @@
+// Copyright (c) 2024 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GameplayTagsManager.h"
+#include "NativeGameplayTags.h"
+
+/**
+ * Declare a native gameplay tag as member of a test tag struct.
+ * Unlike UE_DEFINE_GAMEPLAY_TAG_STATIC, the tag is only registered while an instance of the struct exists, so test tags
+ * don't show up in the tag tree of the project. Create the struct in BeforeEach and destroy it with
+ * OUU::Tests::GameEntitlements::UnregisterTestTags() in AfterEach.
+ */
+#define OUU_DECLARE_TEST_GAMEPLAY_TAG(Name, Tag)                                                                       \
+	FNativeGameplayTag Name                                                                                            \
+	{                                                                                                                  \
+		UE_PLUGIN_NAME, UE_MODULE_NAME, Tag, TEXT(""), ENativeGameplayTagToken::PRIVATE_USE_MACRO_INSTEAD              \
+	}
+
+namespace OUU::Tests::GameEntitlements
+{
+	/** Destroy test tags and remove them from the tag tree, even if the project does not allow unloading tags. */
+	template <typename TagsType>
+	void UnregisterTestTags(TUniquePtr<TagsType>& Tags)
+	{
+		UGameplayTagsManager& TagsManager = UGameplayTagsManager::Get();
+		TagsManager.SetShouldUnloadTagsOverride(true);
+		Tags.Reset();
+		TagsManager.ClearShouldUnloadTagsOverride();
+	}
+} // namespace OUU::Tests::GameEntitlements
@@ -0,0 +1,163 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/RandomStream.h"
+	#include "Math/SpiralIdGrid.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Math.Benchmarks
+	#define OUU_TEST_TYPE	  SpiralIdGrid
+
+namespace OUU::Tests::SpiralIdGridBenchmark
+{
+	// All cells within this radius around the origin are occupied (~250k cells)
+	constexpr int32 GridRadius = 250;
+	constexpr int32 NumLookups = 4 * 1000 * 1000;
+	constexpr int32 QueryRadius = 32;
+	constexpr int32 NumRadiusQueries = 200;
+
+	struct FCell
+	{
+		int32 Value = 0;
+		float Height = 0.f;
+	};
+
+	TArray<FIntPoint> MakeFilledCoordinates()
+	{
+		TArray<FIntPoint> Result;
+		Result.Reserve(FMath::Square(2 * GridRadius + 1));
+		for (int32 Y = -GridRadius; Y <= GridRadius; ++Y)
+		{
+			for (int32 X = -GridRadius; X <= GridRadius; ++X)
+			{
+				Result.Add(FIntPoint(X, Y));
+			}
+		}
+		return Result;
+	}
+
+	TArray<FIntPoint> MakeRandomCoordinates(int32 Num, int32 Radius)
+	{
+		FRandomStream Stream(42);
+		TArray<FIntPoint> Result;
+		Result.Reserve(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Result.Add(FIntPoint(Stream.RandRange(-Radius, Radius), Stream.RandRange(-Radius, Radius)));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::SpiralIdGridBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(VsMap, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::SpiralIdGridBenchmark;
+	using namespace OUU::TestUtilities;
+
+	const TArray<FIntPoint> FilledCoordinates = MakeFilledCoordinates();
+	const TArray<FIntPoint> LookupCoordinates = MakeRandomCoordinates(NumLookups, GridRadius + 10);
+	const TArray<FIntPoint> QueryCenters = MakeRandomCoordinates(NumRadiusQueries, GridRadius - QueryRadius);
+	const int64 NumCellsPerQuery = FMath::Square(2 * QueryRadius + 1);
+
+	TMap<FIntPoint, FCell> Map;
+	TSpiralIdGrid<FCell> Grid;
+
+	// Insert
+	RunAndReportBenchmark(*this, TEXT("TMap<FIntPoint> insert"), FilledCoordinates.Num(), [&]() {
+		for (const FIntPoint& Coordinates : FilledCoordinates)
+		{
+			Map.Add(Coordinates, FCell{Coordinates.X, 1.f});
+		}
+	});
+	RunAndReportBenchmark(*this, TEXT("TSpiralIdGrid insert"), FilledCoordinates.Num(), [&]() {
+		for (const FIntPoint& Coordinates : FilledCoordinates)
+		{
+			Grid.Add(Coordinates, FCell{Coordinates.X, 1.f});
+		}
+	});
+
+	// Point lookup
+	int64 MapSum = 0;
+	int64 GridSum = 0;
+	RunAndReportBenchmark(*this, TEXT("TMap<FIntPoint> point lookup"), NumLookups, [&]() {
+		for (const FIntPoint& Coordinates : LookupCoordinates)
+		{
+			if (const FCell* Cell = Map.Find(Coordinates))
+			{
+				MapSum += Cell->Value;
+			}
+		}
+	});
+	RunAndReportBenchmark(*this, TEXT("TSpiralIdGrid point lookup"), NumLookups, [&]() {
+		for (const FIntPoint& Coordinates : LookupCoordinates)
+		{
+			if (const FCell* Cell = Grid.Find(Coordinates))
+			{
+				GridSum += Cell->Value;
+			}
+		}
+	});
+	TestEqual(TEXT("Point lookup results"), GridSum, MapSum);
+
+	// Radius query around arbitrary centers
+	MapSum = 0;
+	GridSum = 0;
+	RunAndReportBenchmark(*this, TEXT("TMap<FIntPoint> radius query"), NumRadiusQueries * NumCellsPerQuery, [&]() {
+		for (const FIntPoint& Center : QueryCenters)
+		{
+			for (int32 Y = Center.Y - QueryRadius; Y <= Center.Y + QueryRadius; ++Y)
+			{
+				for (int32 X = Center.X - QueryRadius; X <= Center.X + QueryRadius; ++X)
+				{
+					if (const FCell* Cell = Map.Find(FIntPoint(X, Y)))
+					{
+						MapSum += Cell->Value;
+					}
+				}
+			}
+		}
+	});
+	RunAndReportBenchmark(*this, TEXT("TSpiralIdGrid radius query"), NumRadiusQueries * NumCellsPerQuery, [&]() {
+		for (const FIntPoint& Center : QueryCenters)
+		{
+			Grid.ForEachInRadius(Center, QueryRadius, [&](int32, const FCell& Cell) { GridSum += Cell.Value; });
+		}
+	});
+	TestEqual(TEXT("Radius query results"), GridSum, MapSum);
+
+	// Radius query around the origin: The grid only scans one contiguous spiral ID range
+	MapSum = 0;
+	GridSum = 0;
+	const int64 NumOriginQueryCells = NumRadiusQueries * NumCellsPerQuery;
+	RunAndReportBenchmark(*this, TEXT("TMap<FIntPoint> origin radius query"), NumOriginQueryCells, [&]() {
+		for (int32 Query = 0; Query < NumRadiusQueries; ++Query)
+		{
+			for (int32 Y = -QueryRadius; Y <= QueryRadius; ++Y)
+			{
+				for (int32 X = -QueryRadius; X <= QueryRadius; ++X)
+				{
+					if (const FCell* Cell = Map.Find(FIntPoint(X, Y)))
+					{
+						MapSum += Cell->Value;
+					}
+				}
+			}
+		}
+	});
+	RunAndReportBenchmark(*this, TEXT("TSpiralIdGrid origin radius query"), NumOriginQueryCells, [&]() {
+		for (int32 Query = 0; Query < NumRadiusQueries; ++Query)
+		{
+			Grid.ForEachInRadius(QueryRadius, [&](int32, const FCell& Cell) { GridSum += Cell.Value; });
+		}
+	});
+	TestEqual(TEXT("Origin radius query results"), GridSum, MapSum);
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,172 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/SpiralIdGrid.h"
+
+BEGIN_DEFINE_SPEC(FSpiralIdGridSpec, "OpenUnrealUtilities.Runtime.Math.SpiralIdGrid", DEFAULT_OUU_TEST_FLAGS)
+	// Small pages, so the tests cover multiple pages with few cells
+	using FTestGrid = TSpiralIdGrid<FString, 6>;
+
+	/** Fill all cells within the radius around the origin with their spiral ID as string */
+	static FTestGrid MakeFilledGrid(int32 Radius)
+	{
+		FTestGrid Grid;
+		for (int32 Y = -Radius; Y <= Radius; ++Y)
+		{
+			for (int32 X = -Radius; X <= Radius; ++X)
+			{
+				const int32 SpiralId = FTestGrid::ToSpiralId(FIntPoint(X, Y));
+				Grid.Add(SpiralId, LexToString(SpiralId));
+			}
+		}
+		return Grid;
+	}
+END_DEFINE_SPEC(FSpiralIdGridSpec)
+
+void FSpiralIdGridSpec::Define()
+{
+	Describe("Add / Find / Remove", [this]() {
+		It("should find added cells by spiral ID and coordinates", [this]() {
+			FTestGrid Grid;
+			Grid.Add(FIntPoint(3, -2), TEXT("A"));
+			Grid.Add(1000, TEXT("B"));
+
+			SPEC_TEST_EQUAL(Grid.Num(), 2);
+			SPEC_TEST_EQUAL(*Grid.Find(FTestGrid::ToSpiralId(FIntPoint(3, -2))), FString(TEXT("A")));
+			SPEC_TEST_EQUAL(*Grid.Find(FTestGrid::ToCoordinates(1000)), FString(TEXT("B")));
+			SPEC_TEST_NULL(Grid.Find(999));
+			SPEC_TEST_NULL(Grid.Find(5000));
+			SPEC_TEST_NULL(Grid.Find(-1));
+		});
+
+		It("should replace the value when adding an occupied cell", [this]() {
+			FTestGrid Grid;
+			Grid.Add(7, TEXT("A"));
+			Grid.Add(7, TEXT("B"));
+
+			SPEC_TEST_EQUAL(Grid.Num(), 1);
+			SPEC_TEST_EQUAL(*Grid.Find(7), FString(TEXT("B")));
+		});
+
+		It("should replace the value with arguments that alias the replaced value", [this]() {
+			FTestGrid Grid;
+			Grid.Add(7, TEXT("A long enough string to live on the heap"));
+			Grid.Add(7, *Grid.Find(7));
+			SPEC_TEST_EQUAL(*Grid.Find(7), FString(TEXT("A long enough string to live on the heap")));
+
+			Grid.Emplace(7, Grid.Find(7)->Left(6));
+			SPEC_TEST_EQUAL(Grid.Num(), 1);
+			SPEC_TEST_EQUAL(*Grid.Find(7), FString(TEXT("A long")));
+		});
+
+		It("should default construct cells in FindOrAdd", [this]() {
+			FTestGrid Grid;
+			Grid.FindOrAdd(FIntPoint(1, 1)).Append(TEXT("X"));
+			Grid.FindOrAdd(FIntPoint(1, 1)).Append(TEXT("Y"));
+
+			SPEC_TEST_EQUAL(*Grid.Find(FIntPoint(1, 1)), FString(TEXT("XY")));
+		});
+
+		It("should free pages once the last cell of a page is removed", [this]() {
+			FTestGrid Grid;
+			Grid.Add(10, TEXT("A"));
+			Grid.Add(11, TEXT("B"));
+			Grid.Add(200, TEXT("C"));
+			SPEC_TEST_EQUAL(Grid.GetNumAllocatedPages(), 2);
+
+			SPEC_TEST_TRUE(Grid.Remove(10));
+			SPEC_TEST_FALSE(Grid.Remove(10));
+			SPEC_TEST_EQUAL(Grid.GetNumAllocatedPages(), 2);
+			SPEC_TEST_TRUE(Grid.Remove(11));
+			SPEC_TEST_EQUAL(Grid.GetNumAllocatedPages(), 1);
+			SPEC_TEST_EQUAL(Grid.Num(), 1);
+		});
+
+		It("should copy and move all cells", [this]() {
+			FTestGrid Grid = MakeFilledGrid(5);
+			FTestGrid Copy = Grid;
+			FTestGrid Moved = MoveTemp(Grid);
+
+			SPEC_TEST_EQUAL(Copy.Num(), 121);
+			SPEC_TEST_EQUAL(Moved.Num(), 121);
+			SPEC_TEST_EQUAL(Grid.Num(), 0);
+			SPEC_TEST_EQUAL(*Copy.Find(120), FString(TEXT("120")));
+		});
+	});
+
+	Describe("Queries", [this]() {
+		It("should iterate all cells in spiral ID order", [this]() {
+			const FTestGrid Grid = MakeFilledGrid(4);
+			TArray<int32> VisitedIds;
+			Grid.ForEach([&](int32 SpiralId, const FString& Value) {
+				VisitedIds.Add(SpiralId);
+				SPEC_TEST_EQUAL(Value, LexToString(SpiralId));
+			});
+
+			SPEC_TEST_EQUAL(VisitedIds.Num(), 81);
+			for (int32 Idx = 0; Idx < VisitedIds.Num(); ++Idx)
+			{
+				if (VisitedIds[Idx] != Idx)
+				{
+					SPEC_TEST_EQUAL(VisitedIds[Idx], Idx);
+					break;
+				}
+			}
+		});
+
+		It("should only visit cells of the requested ring", [this]() {
+			const FTestGrid Grid = MakeFilledGrid(10);
+			for (int32 Ring = 0; Ring <= 10; ++Ring)
+			{
+				int32 NumVisited = 0;
+				Grid.ForEachInRings(Ring, Ring, [&](int32 SpiralId, const FString&) {
+					const FIntPoint Coordinates = FTestGrid::ToCoordinates(SpiralId);
+					SPEC_TEST_EQUAL(FMath::Max(FMath::Abs(Coordinates.X), FMath::Abs(Coordinates.Y)), Ring);
+					++NumVisited;
+				});
+				SPEC_TEST_EQUAL(NumVisited, Ring == 0 ? 1 : 8 * Ring);
+			}
+		});
+
+		It("should visit all cells within a radius around the origin", [this]() {
+			const FTestGrid Grid = MakeFilledGrid(10);
+			int32 NumVisited = 0;
+			Grid.ForEachInRadius(3, [&](int32, const FString&) { ++NumVisited; });
+			SPEC_TEST_EQUAL(NumVisited, 49);
+		});
+
+		It("should visit all cells within a radius around an arbitrary center", [this]() {
+			FTestGrid Grid = MakeFilledGrid(10);
+			Grid.Remove(FIntPoint(5, 5));
+
+			const FIntPoint Center(4, 6);
+			int32 NumVisited = 0;
+			Grid.ForEachInRadius(Center, 2, [&](int32 SpiralId, FString&) {
+				const FIntPoint Coordinates = FTestGrid::ToCoordinates(SpiralId);
+				SPEC_TEST_TRUE(FMath::Abs(Coordinates.X - Center.X) <= 2 && FMath::Abs(Coordinates.Y - Center.Y) <= 2);
+				++NumVisited;
+			});
+			// 5x5 window minus the removed cell
+			SPEC_TEST_EQUAL(NumVisited, 24);
+		});
+
+		It("should find neighbors", [this]() {
+			const FTestGrid Grid = MakeFilledGrid(3);
+			const TStaticArray<int32, 8> NeighborIds = FTestGrid::GetNeighborIds(0);
+			const int32 ExpectedIds[] = {7, 6, 5, 4, 3, 2, 1, 8};
+			for (int32 Idx = 0; Idx < 8; ++Idx)
+			{
+				SPEC_TEST_EQUAL(NeighborIds[Idx], ExpectedIds[Idx]);
+			}
+
+			const FString* Neighbor = Grid.FindNeighbor(FTestGrid::ToSpiralId(FIntPoint(2, 2)), FIntPoint(-1, 0));
+			SPEC_TEST_EQUAL(*Neighbor, LexToString(FTestGrid::ToSpiralId(FIntPoint(1, 2))));
+			SPEC_TEST_NULL(Grid.FindNeighbor(FTestGrid::ToSpiralId(FIntPoint(3, 3)), FIntPoint(1, 0)));
+		});
+	});
+}
+
+#endif
@@ -23,6 +23,9 @@ const TArray<TArray<int32>> SampleGrid = {
 const TMap<int32, FVector2D> SampleBounds =
 	{{0, {7500, -7500}}, {1, {7500, 7500}}, {107, {37500, -82500}}, {130, {-52500, 82500}}, {237, {-67500, 112500}}};
 
+// Number of IDs checked by the exhaustive tests. Covers all rings up to a radius of ~1400 cells.
+constexpr int32 NumExhaustiveSpiralIds = 8 * 1000 * 1000;
+
 BEGIN_DEFINE_SPEC(FSpiralIdUtilitiesSpec, "OpenUnrealUtilities.Runtime.Math.SpiralIdUtilities", DEFAULT_OUU_TEST_FLAGS)
 END_DEFINE_SPEC(FSpiralIdUtilitiesSpec)
 
@@ -70,6 +73,88 @@ void FSpiralIdUtilitiesSpec::Define()
 			   SPEC_TEST_EQUAL(ResultLocation, ExpectedLocation);
 		   }
 	   });
+
+	It("ConvertSpiralIdToCoordinates should return the same coordinates as walking the spiral step by step", [this]() {
+		// Reference implementation: Walk along the spiral in segments that grow by one every second turn.
+		FIntPoint PerStepDelta(0, 1);
+		int32 SegmentLength = 1;
+		int32 SegmentProgress = 0;
+		FIntPoint WalkedCoordinates(0, 0);
+
+		int32 NumMismatches = 0;
+		int32 FirstMismatch = INDEX_NONE;
+		for (int32 SpiralId = 0; SpiralId < NumExhaustiveSpiralIds; ++SpiralId)
+		{
+			const FIntPoint Expected(WalkedCoordinates.X, -WalkedCoordinates.Y);
+			if (USpiralIdUtilities::ConvertSpiralIdToCoordinates(SpiralId) != Expected)
+			{
+				FirstMismatch = NumMismatches == 0 ? SpiralId : FirstMismatch;
+				++NumMismatches;
+			}
+
+			WalkedCoordinates += PerStepDelta;
+			if (++SegmentProgress == SegmentLength)
+			{
+				SegmentProgress = 0;
+				PerStepDelta = FIntPoint(-PerStepDelta.Y, PerStepDelta.X);
+				SegmentLength += (PerStepDelta.X == 0) ? 1 : 0;
+			}
+		}
+
+		SPEC_TEST_EQUAL(NumMismatches, 0);
+		SPEC_TEST_EQUAL(FirstMismatch, INDEX_NONE);
+	});
+
+	It("ConvertSpiralIdToCoordinates / ConvertCoordinatesToSpiralId should round trip", [this]() {
+		int32 NumMismatches = 0;
+		int32 FirstMismatch = INDEX_NONE;
+		for (int32 SpiralId = 0; SpiralId < NumExhaustiveSpiralIds; ++SpiralId)
+		{
+			const FIntPoint Coordinates = USpiralIdUtilities::ConvertSpiralIdToCoordinates(SpiralId);
+			if (USpiralIdUtilities::ConvertCoordinatePointToSpiralId(Coordinates) != SpiralId)
+			{
+				FirstMismatch = NumMismatches == 0 ? SpiralId : FirstMismatch;
+				++NumMismatches;
+			}
+		}
+
+		SPEC_TEST_EQUAL(NumMismatches, 0);
+		SPEC_TEST_EQUAL(FirstMismatch, INDEX_NONE);
+	});
+
+	It("ConvertSpiralIdToCoordinates should round trip for the largest int32 IDs", [this]() {
+		for (int32 Offset = 0; Offset < 100000; ++Offset)
+		{
+			const int32 SpiralId = MAX_int32 - Offset;
+			const FIntPoint Coordinates = USpiralIdUtilities::ConvertSpiralIdToCoordinates(SpiralId);
+			if (USpiralIdUtilities::ConvertCoordinatePointToSpiralId(Coordinates) != SpiralId)
+			{
+				SPEC_TEST_EQUAL(USpiralIdUtilities::ConvertCoordinatePointToSpiralId(Coordinates), SpiralId);
+				break;
+			}
+		}
+	});
+
+	It("ConvertSpiralIdsToCoordinates should return the same results as individual conversions", [this]() {
+		TArray<int32> SpiralIds;
+		for (int32 SpiralId = 0; SpiralId < 10000; ++SpiralId)
+		{
+			SpiralIds.Add(SpiralId * 7919);
+		}
+		SpiralIds.Add(-1);
+
+		const TArray<FIntPoint> BatchResult = USpiralIdUtilities::ConvertSpiralIdArrayToCoordinates(SpiralIds);
+
+		SPEC_TEST_EQUAL(BatchResult.Num(), SpiralIds.Num());
+		int32 NumMismatches = 0;
+		for (int32 Idx = 0; Idx < SpiralIds.Num(); ++Idx)
+		{
+			const FIntPoint Expected = USpiralIdUtilities::ConvertSpiralIdToCoordinates(SpiralIds[Idx]);
+			NumMismatches += (BatchResult[Idx] != Expected) ? 1 : 0;
+		}
+		SPEC_TEST_EQUAL(NumMismatches, 0);
+		SPEC_TEST_TRUE(BatchResult.Last() == FIntPoint(0, 0));
+	});
 };
 
 #endif
@@ -0,0 +1,200 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Misc/RegexUtils.h"
+	#include "Templates/FrameArena.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Misc.Benchmarks
+	#define OUU_TEST_TYPE	  Regex
+
+namespace OUU::Tests::RegexBenchmark
+{
+	constexpr int32 NumIterations = 10000;
+	const TCHAR* const Pattern = TEXT("([A-Za-z]+)_([0-9]+)");
+	const TCHAR* const Input = TEXT("Some text with an Actor_42 and another Component_1337 name in it");
+
+	// Input sizes (in characters) for the scaling benchmark. The time per character should stay roughly constant.
+	constexpr int32 LogSizes[] = {64 * 1024, 256 * 1024, 1024 * 1024};
+	const TCHAR* const LogPattern = TEXT("\\[(\\d+)\\]\\[(Warning|Error)\\] (\\w+):");
+
+	FString MakeLog(int32 NumChars)
+	{
+		FString Result;
+		Result.Reserve(NumChars + 128);
+		for (int32 Line = 0; Result.Len() < NumChars; Line++)
+		{
+			const TCHAR* Verbosity = Line % 7 == 0 ? TEXT("Error") : (Line % 3 == 0 ? TEXT("Warning") : TEXT("Log"));
+			Result += FString::Printf(
+				TEXT("[%i][%s] LogCategory%i: Some message text %i\n"),
+				Line,
+				Verbosity,
+				Line % 5,
+				Line);
+		}
+		return Result.Left(NumChars);
+	}
+
+	constexpr int32 NumAssetNames = 100000;
+	const TCHAR* const AssetNamePattern = TEXT("^(SM|SK|T|M|MI)_[A-Z][A-Za-z0-9]*(_[0-9]+)?$");
+
+	TArray<FName> MakeAssetNames()
+	{
+		const TCHAR* Prefixes[] = {TEXT("SM"), TEXT("SK"), TEXT("T"), TEXT("M"), TEXT("MI"), TEXT("BP"), TEXT("sm")};
+		TArray<FName> Result;
+		Result.Reserve(NumAssetNames);
+		for (int32 i = 0; i < NumAssetNames; i++)
+		{
+			Result.Add(*FString::Printf(TEXT("%s_Asset%i_%i"), Prefixes[i % UE_ARRAY_COUNT(Prefixes)], i, i % 13));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::RegexBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(PatternCompilation, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::RegexBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime;
+
+	const FString PatternString = Pattern;
+	const FString InputString = Input;
+
+	int32 UncachedSum = 0;
+	RunAndReportBenchmark(*this, TEXT("FRegexPattern per call (uncached)"), NumIterations, [&]() {
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			const FRegexPattern RegexPattern(PatternString);
+			FRegexMatcher Matcher(RegexPattern, InputString);
+			while (Matcher.FindNext())
+			{
+				UncachedSum++;
+			}
+		}
+	});
+
+	FRegexPatternCache::Empty();
+	int32 CachedSum = 0;
+	RunAndReportBenchmark(*this, TEXT("CountRegexMatches (pattern cache)"), NumIterations, [&]() {
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			CachedSum += RegexUtils::CountRegexMatches(PatternString, InputString);
+		}
+	});
+
+	const FCompiledRegexPattern CompiledPattern(PatternString);
+	int32 PrecompiledSum = 0;
+	RunAndReportBenchmark(*this, TEXT("CountRegexMatches (precompiled)"), NumIterations, [&]() {
+		for (int32 i = 0; i < NumIterations; i++)
+		{
+			PrecompiledSum += RegexUtils::CountRegexMatches(CompiledPattern, InputString);
+		}
+	});
+
+	TestEqual(TEXT("Pattern cache result"), CachedSum, UncachedSum);
+	TestEqual(TEXT("Precompiled result"), PrecompiledSum, UncachedSum);
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(MatchEnumerationScaling, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::RegexBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime;
+
+	// Iterations are reported per input character, so linear scaling shows up as constant time per iteration
+	const FCompiledRegexPattern CompiledPattern(LogPattern);
+	for (const int32 LogSize : LogSizes)
+	{
+		const FString Log = MakeLog(LogSize);
+
+		int32 NumMatches = 0;
+		RunAndReportBenchmark(*this, FString::Printf(TEXT("CountRegexMatches (%i chars)"), LogSize), LogSize, [&]() {
+			NumMatches = RegexUtils::CountRegexMatches(CompiledPattern, Log);
+		});
+
+		int32 NumGroups = 0;
+		RunAndReportBenchmark(
+			*this,
+			FString::Printf(TEXT("GetRegexMatchesAndGroups (%i chars)"), LogSize),
+			LogSize,
+			[&]() { NumGroups = RegexUtils::GetRegexMatchesAndGroups(CompiledPattern, 3, Log).Num(); });
+
+		TestTrue(FString::Printf(TEXT("Log contains matches (%i chars)"), LogSize), NumMatches > 0);
+		TestEqual(FString::Printf(TEXT("Number of groups (%i chars)"), LogSize), NumGroups, NumMatches);
+	}
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(ZeroCopyResults, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::RegexBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime;
+
+	const int32 LogSize = 1024 * 1024;
+	const FString Log = MakeLog(LogSize);
+	const FCompiledRegexPattern CompiledPattern(LogPattern);
+
+	int32 NumStringGroups = 0;
+	RunAndReportBenchmark(*this, TEXT("GetRegexMatchesAndGroups (FString)"), LogSize, [&]() {
+		NumStringGroups = RegexUtils::GetRegexMatchesAndGroups(CompiledPattern, 3, Log).Num() * 4;
+	});
+
+	int32 NumViews = 0;
+	RunAndReportBenchmark(*this, TEXT("GetRegexGroupViews (heap)"), LogSize, [&]() {
+		NumViews = GetRegexGroupViews(CompiledPattern, 3, Log).Num();
+	});
+
+	int32 NumArenaViews = 0;
+	RunAndReportBenchmark(*this, TEXT("GetRegexGroupViews (frame arena)"), LogSize, [&]() {
+		FScopedFrameArenaMark Mark;
+		NumArenaViews = GetRegexGroupViews<FFrameArenaAllocator>(CompiledPattern, 3, Log).Num();
+	});
+
+	TestEqual(TEXT("Number of views"), NumViews, NumStringGroups);
+	TestEqual(TEXT("Number of arena views"), NumArenaViews, NumStringGroups);
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(BatchMatching, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::RegexBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime;
+
+	const TArray<FName> AssetNames = MakeAssetNames();
+	const FCompiledRegexPattern CompiledPattern(AssetNamePattern);
+
+	TArray<int32> SequentialIndices;
+	RunAndReportBenchmark(*this, TEXT("MatchesRegex per name (sequential)"), NumAssetNames, [&]() {
+		for (int32 i = 0; i < AssetNames.Num(); i++)
+		{
+			if (RegexUtils::MatchesRegex(CompiledPattern, AssetNames[i].ToString()))
+			{
+				SequentialIndices.Add(i);
+			}
+		}
+	});
+
+	TArray<int32> BatchIndices;
+	RunAndReportBenchmark(*this, TEXT("FindRegexMatchIndices (batch)"), NumAssetNames, [&]() {
+		BatchIndices = FindRegexMatchIndices(CompiledPattern, AssetNames);
+	});
+
+	TBitArray<> BatchMask;
+	RunAndReportBenchmark(*this, TEXT("MatchesRegexBatch (batch)"), NumAssetNames, [&]() {
+		BatchMask = MatchesRegexBatch(CompiledPattern, AssetNames);
+	});
+
+	TestTrue(TEXT("Batch indices equal sequential indices"), BatchIndices == SequentialIndices);
+	TestEqual(TEXT("Number of set bits"), BatchMask.CountSetBits(), SequentialIndices.Num());
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -7,6 +7,7 @@
 #if WITH_AUTOMATION_WORKER
 
 	#include "Misc/RegexUtils.h"
+	#include "Templates/FrameArena.h"
 
 BEGIN_DEFINE_SPEC(FRegexUtilsSpec, "OpenUnrealUtilities.Runtime.Misc.Regex", DEFAULT_OUU_TEST_FLAGS)
 END_DEFINE_SPEC(FRegexUtilsSpec)
@@ -159,6 +160,216 @@ void FRegexUtilsSpec::Define()
 			SPEC_TEST_EQUAL(Result, "foobar My foobar string foobar foobar");
 		});
 	});
+
+	Describe("FRegexMatchEnumerator", [this]() {
+		It("should return the spans of all matches in order", [this]() {
+			const FString Input = "test My test string test test";
+			const FCompiledRegexPattern Pattern("t.{2}t");
+			OUU::Runtime::FRegexMatchEnumerator Matches(Pattern, Input);
+
+			TArray<OUU::Runtime::FRegexSpan> Spans;
+			while (Matches.FindNext())
+			{
+				Spans.Add(Matches.GetMatchSpan());
+			}
+
+			const TArray<OUU::Runtime::FRegexSpan> ExpectedSpans = {{0, 4}, {8, 12}, {20, 24}, {25, 29}};
+			SPEC_TEST_TRUE(Spans == ExpectedSpans);
+		});
+
+		It("should return invalid spans for capture groups that did not participate in the match", [this]() {
+			const FString Input = "ac";
+			const FCompiledRegexPattern Pattern("a(b)?(c)");
+			OUU::Runtime::FRegexMatchEnumerator Matches(Pattern, Input);
+			if (SPEC_TEST_TRUE(Matches.FindNext()))
+			{
+				const OUU::Runtime::FRegexSpan ExpectedSpan{1, 2};
+				SPEC_TEST_FALSE(Matches.GetGroupSpan(1).IsValid());
+				SPEC_TEST_TRUE(Matches.GetGroupSpan(2) == ExpectedSpan);
+			}
+			SPEC_TEST_FALSE(Matches.FindNext());
+		});
+
+		It("should skip empty matches", [this]() {
+			SPEC_TEST_EQUAL(OUU::Runtime::RegexUtils::CountRegexMatches("a*", "baacaaa"), 2);
+		});
+
+		It("should only match anchors at the actual start of the input", [this]() {
+			SPEC_TEST_EQUAL(OUU::Runtime::RegexUtils::CountRegexMatches("^t", "tat"), 1);
+			SPEC_TEST_FALSE(OUU::Runtime::RegexUtils::MatchesRegex("^[a-z]+$", "1234alphabet"));
+		});
+	});
+
+	Describe("Zero-copy results", [this]() {
+		It("should return views that point into the input string", [this]() {
+			const FString Input = "test My test string test test";
+			const FCompiledRegexPattern Pattern("t.{2}t");
+			const auto Spans = OUU::Runtime::GetRegexMatchSpans(Pattern, Input);
+			const auto Views = OUU::Runtime::GetRegexMatchViews(Pattern, Input);
+			const auto Matches = OUU::Runtime::RegexUtils::GetRegexMatches(Pattern, Input);
+
+			if (SPEC_TEST_EQUAL(Views.Num(), Matches.Num()) && SPEC_TEST_EQUAL(Spans.Num(), Matches.Num()))
+			{
+				for (int32 i = 0; i < Matches.Num(); i++)
+				{
+					SPEC_TEST_EQUAL(Spans[i].Beginning, Matches[i].MatchBeginning);
+					SPEC_TEST_EQUAL(Spans[i].Ending, Matches[i].MatchEnding);
+					SPEC_TEST_TRUE(Views[i].GetData() == *Input + Matches[i].MatchBeginning);
+					SPEC_TEST_TRUE(Views[i].Equals(Matches[i].MatchString, ESearchCase::CaseSensitive));
+				}
+			}
+		});
+
+		It("should return the same capture groups as GetRegexMatchesAndGroups", [this]() {
+			const FString Input = "Actor_42, Component_1337, Actor";
+			const FCompiledRegexPattern Pattern("([A-Za-z]+)(?:_([0-9]+))?");
+			const auto GroupViews = OUU::Runtime::GetRegexGroupViews(Pattern, 2, Input);
+			const auto MatchesAndGroups = OUU::Runtime::RegexUtils::GetRegexMatchesAndGroups(Pattern, 2, Input);
+
+			if (SPEC_TEST_EQUAL(GroupViews.Num(), MatchesAndGroups.Num() * 3))
+			{
+				for (int32 i = 0; i < GroupViews.Num(); i++)
+				{
+					const FRegexMatch& Group = MatchesAndGroups[i / 3].CaptureGroups[i % 3];
+					SPEC_TEST_TRUE(GroupViews[i].Equals(Group.MatchString, ESearchCase::CaseSensitive));
+				}
+			}
+		});
+
+		It("should support arena backed result arrays", [this]() {
+			const FString Input = "test My test string test test";
+			const FCompiledRegexPattern Pattern("t(.{2})t");
+
+			OUU::Runtime::FScopedFrameArenaMark Mark;
+			const auto Spans = OUU::Runtime::GetRegexGroupSpans<OUU::Runtime::FFrameArenaAllocator>(Pattern, 1, Input);
+			if (SPEC_TEST_EQUAL(Spans.Num(), 8))
+			{
+				SPEC_TEST_TRUE(Spans[1].GetView(Input) == TEXT("es"));
+				SPEC_TEST_TRUE(Spans[7].GetView(Input) == TEXT("es"));
+			}
+		});
+	});
+
+	Describe("Batch matching", [this]() {
+		It("should return the same results as matching every string on its own", [this]() {
+			TArray<FString> Strings;
+			for (int32 i = 0; i < 5000; i++)
+			{
+				Strings.Add(FString::Printf(TEXT("%s_Asset_%i"), i % 3 == 0 ? TEXT("SM") : TEXT("T"), i));
+			}
+			const FCompiledRegexPattern Pattern("^SM_.*_[0-9]*5$");
+
+			const TBitArray<> Mask = OUU::Runtime::MatchesRegexBatch(Pattern, Strings);
+			const TArray<int32> Indices = OUU::Runtime::FindRegexMatchIndices(Pattern, Strings);
+
+			TArray<int32> ExpectedIndices;
+			for (int32 i = 0; i < Strings.Num(); i++)
+			{
+				if (OUU::Runtime::RegexUtils::MatchesRegex(Pattern, Strings[i]))
+				{
+					ExpectedIndices.Add(i);
+				}
+			}
+
+			SPEC_TEST_EQUAL(Mask.Num(), Strings.Num());
+			SPEC_TEST_EQUAL(Mask.CountSetBits(), ExpectedIndices.Num());
+			SPEC_TEST_TRUE(Indices == ExpectedIndices);
+			for (const int32 Index : ExpectedIndices)
+			{
+				SPEC_TEST_TRUE(Mask[Index]);
+			}
+		});
+
+		It("should match names", [this]() {
+			const TArray<FName> Names = {"SM_Rock", "T_Rock", "SM_Tree", "sm_Bush"};
+			const FCompiledRegexPattern Pattern("SM_[A-Za-z]+");
+			const TArray<int32> ExpectedIndices = {0, 2};
+			SPEC_TEST_TRUE(OUU::Runtime::FindRegexMatchIndices(Pattern, Names) == ExpectedIndices);
+		});
+
+		It("should only match entire strings in exact mode", [this]() {
+			const TArray<FString> Strings = {"SM_Rock", "SM_Rock_LOD0", "Old_SM_Rock"};
+			const FCompiledRegexPattern Pattern("SM_[A-Za-z]+");
+			const TArray<int32> ExpectedIndices = {0};
+			SPEC_TEST_TRUE(
+				OUU::Runtime::FindRegexMatchIndices(Pattern, Strings, OUU::Runtime::ERegexBatchMatchMode::Exact)
+				== ExpectedIndices);
+		});
+	});
+
+	Describe("FRegexPatternCache", [this]() {
+		BeforeEach([]() {
+			OUU::Runtime::FRegexPatternCache::Empty();
+			OUU::Runtime::FRegexPatternCache::ResetStats();
+		});
+
+		It("should only compile a pattern once", [this]() {
+			OUU::Runtime::RegexUtils::MatchesRegex("t.{2}t", "My test string");
+			OUU::Runtime::RegexUtils::CountRegexMatches("t.{2}t", "My test string test");
+
+			const auto Stats = OUU::Runtime::FRegexPatternCache::GetStats();
+			SPEC_TEST_EQUAL(Stats.NumMisses, static_cast<uint64>(1));
+			SPEC_TEST_EQUAL(Stats.NumHits, static_cast<uint64>(1));
+			SPEC_TEST_EQUAL(Stats.NumEntries, 1);
+		});
+
+		It("should treat patterns that only differ in case as different patterns", [this]() {
+			SPEC_TEST_TRUE(OUU::Runtime::RegexUtils::MatchesRegexExact("[a-z]+", "alphabet"));
+			SPEC_TEST_FALSE(OUU::Runtime::RegexUtils::MatchesRegexExact("[A-Z]+", "alphabet"));
+			SPEC_TEST_EQUAL(OUU::Runtime::FRegexPatternCache::GetStats().NumEntries, 2);
+		});
+
+		It("should treat patterns with different flags as different patterns", [this]() {
+			using OUU::Runtime::FRegexPatternCache;
+			FRegexPatternCache::FindOrCompile("abc");
+			FRegexPatternCache::FindOrCompile("abc", ERegexPatternFlags::CaseInsensitive);
+			SPEC_TEST_EQUAL(FRegexPatternCache::GetStats().NumMisses, static_cast<uint64>(2));
+		});
+
+		It("should evict patterns when the capacity is exceeded", [this]() {
+			IConsoleVariable* CacheSizeCVar =
+				IConsoleManager::Get().FindConsoleVariable(TEXT("ouu.Regex.PatternCacheSize"));
+			if (!SPEC_TEST_NOT_NULL(CacheSizeCVar))
+				return;
+
+			const int32 PreviousCacheSize = CacheSizeCVar->GetInt();
+			CacheSizeCVar->Set(2, ECVF_SetByCode);
+			OUU::Runtime::RegexUtils::MatchesRegex("a+", "aaa");
+			OUU::Runtime::RegexUtils::MatchesRegex("b+", "bbb");
+			OUU::Runtime::RegexUtils::MatchesRegex("c+", "ccc");
+			const auto Stats = OUU::Runtime::FRegexPatternCache::GetStats();
+			CacheSizeCVar->Set(PreviousCacheSize, ECVF_SetByCode);
+
+			SPEC_TEST_EQUAL(Stats.NumEntries, 2);
+			SPEC_TEST_EQUAL(Stats.NumMisses, static_cast<uint64>(3));
+		});
+	});
+
+	Describe("FCompiledRegexPattern", [this]() {
+		It("should return the same results as the string pattern overloads", [this]() {
+			const FString Pattern = "t(.{2})t";
+			const FString Input = "test My test string test test";
+			const FCompiledRegexPattern CompiledPattern(Pattern);
+
+			SPEC_TEST_EQUAL(
+				OUU::Runtime::RegexUtils::CountRegexMatches(CompiledPattern, Input),
+				OUU::Runtime::RegexUtils::CountRegexMatches(Pattern, Input));
+			SPEC_TEST_ARRAYS_EQUAL(
+				OUU::Runtime::RegexUtils::GetRegexMatches(CompiledPattern, Input),
+				OUU::Runtime::RegexUtils::GetRegexMatches(Pattern, Input));
+			SPEC_TEST_ARRAYS_EQUAL(
+				OUU::Runtime::RegexUtils::GetRegexMatchesAndGroups(CompiledPattern, 1, Input),
+				OUU::Runtime::RegexUtils::GetRegexMatchesAndGroups(Pattern, 1, Input));
+			SPEC_TEST_EQUAL(
+				OUU::Runtime::RegexUtils::ReplaceAllRegexMatches(CompiledPattern, Input, "foobar"),
+				OUU::Runtime::RegexUtils::ReplaceAllRegexMatches(Pattern, Input, "foobar"));
+		});
+
+		It("should respect the pattern flags", [this]() {
+			const FCompiledRegexPattern CompiledPattern("abc", ERegexPatternFlags::CaseInsensitive);
+			SPEC_TEST_TRUE(OUU::Runtime::RegexUtils::MatchesRegexExact(CompiledPattern, "ABC"));
+		});
+	});
 }
 
 #endif
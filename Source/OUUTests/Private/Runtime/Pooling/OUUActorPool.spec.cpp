@@ -0,0 +1,106 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Pooling/OUUActorPool.h"
+
+namespace OUU::Tests::ActorPool
+{
+	constexpr float ViewConeHalfAngle = 50.f;
+	constexpr float OutOfViewDistanceScale = 4.f;
+	constexpr float ReferenceDistance = 5000.f;
+
+	// Looking along +X from the origin
+	const FTransform ForwardView = FTransform::Identity;
+
+	float Score(const FVector& Location, TConstArrayView<FTransform> Views)
+	{
+		return UOUUActorPool::ScoreLocationAgainstViews(
+			Location,
+			Views,
+			ViewConeHalfAngle,
+			OutOfViewDistanceScale,
+			ReferenceDistance);
+	}
+
+	FOUUActorPoolSpawnRequest MakeRequest(float Priority, float SpatialScore, uint32 SerialNumber)
+	{
+		FOUUActorPoolSpawnRequest Request;
+		Request.Priority = Priority;
+		Request.PrioritizeByPlayerView = true;
+		Request.SpatialScore = SpatialScore;
+		Request.SerialNumber = SerialNumber;
+		return Request;
+	}
+} // namespace OUU::Tests::ActorPool
+
+BEGIN_DEFINE_SPEC(FOUUActorPoolSpec, "OpenUnrealUtilities.Runtime.Pooling.ActorPool", DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FOUUActorPoolSpec)
+
+void FOUUActorPoolSpec::Define()
+{
+	using namespace OUU::Tests::ActorPool;
+
+	Describe("ScoreLocationAgainstViews", [this]() {
+		It("should return normalized scores that increase with the distance", [this]() {
+			const FTransform Views[] = {ForwardView};
+			SPEC_TEST_EQUAL(Score(FVector::ZeroVector, Views), 0.f);
+			SPEC_TEST_EQUAL_TOLERANCE(Score(FVector(ReferenceDistance, 0, 0), Views), 0.5f, UE_KINDA_SMALL_NUMBER);
+			SPEC_TEST_TRUE(Score(FVector(1000, 0, 0), Views) < Score(FVector(2000, 0, 0), Views));
+			SPEC_TEST_TRUE(Score(FVector(1.0e9, 0, 0), Views) <= 1.f);
+		});
+
+		It("should prefer locations in the view cone over closer locations behind the view", [this]() {
+			const FTransform Views[] = {ForwardView};
+			SPEC_TEST_TRUE(Score(FVector(2000, 0, 0), Views) < Score(FVector(-1000, 0, 0), Views));
+		});
+
+		It("should use the closest view", [this]() {
+			const FTransform Views[] = {ForwardView, FTransform(FVector(10000, 0, 0))};
+			const FTransform FirstViewOnly[] = {ForwardView};
+			SPEC_TEST_TRUE(Score(FVector(11000, 0, 0), Views) < Score(FVector(11000, 0, 0), FirstViewOnly));
+		});
+
+		It("should return the least relevant score if there are no views", [this]() {
+			SPEC_TEST_EQUAL(Score(FVector::ZeroVector, {}), 1.f);
+			SPEC_TEST_EQUAL(Score(FVector(-1000, 0, 0), {}), 1.f);
+		});
+	});
+
+	Describe("IsMoreImportantThan", [this]() {
+		It("should order requests with the same priority by spatial score", [this]() {
+			const FTransform Views[] = {ForwardView};
+			const auto Visible = MakeRequest(1.f, Score(FVector(2000, 0, 0), Views), 1);
+			const auto Behind = MakeRequest(1.f, Score(FVector(-1000, 0, 0), Views), 0);
+			SPEC_TEST_TRUE(Visible.IsMoreImportantThan(Behind));
+			SPEC_TEST_FALSE(Behind.IsMoreImportantThan(Visible));
+		});
+
+		It("should never let spatial scores override explicit priorities", [this]() {
+			const auto HighPriorityFar = MakeRequest(0.f, 0.99f, 1);
+			const auto LowPriorityClose = MakeRequest(1.f, 0.f, 0);
+			SPEC_TEST_TRUE(HighPriorityFar.IsMoreImportantThan(LowPriorityClose));
+		});
+
+		It("should fall back to creation order without player views", [this]() {
+			const auto Older = MakeRequest(1.f, Score(FVector(-1000, 0, 0), {}), 0);
+			const auto Newer = MakeRequest(1.f, Score(FVector(10, 0, 0), {}), 1);
+			SPEC_TEST_TRUE(Older.IsMoreImportantThan(Newer));
+			SPEC_TEST_FALSE(Newer.IsMoreImportantThan(Older));
+		});
+
+		It("should order unscored requests after visible requests with the same priority", [this]() {
+			FOUUActorPoolSpawnRequest Unscored;
+			Unscored.Priority = 1.f;
+			Unscored.SerialNumber = 0;
+
+			const FTransform Views[] = {ForwardView};
+			const auto Visible = MakeRequest(1.f, Score(FVector(2000, 0, 0), Views), 1);
+			SPEC_TEST_TRUE(Visible.IsMoreImportantThan(Unscored));
+		});
+	});
+}
+
+#endif
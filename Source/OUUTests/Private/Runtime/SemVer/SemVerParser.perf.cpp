@@ -0,0 +1,108 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/RandomStream.h"
+	#include "Misc/RegexUtils.h"
+	#include "SemVer/SemVerParser.h"
+	#include "SemVer/SemVerRegex.h"
+	#include "SemVer/SemanticVersion.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.SemVer.Benchmarks
+	#define OUU_TEST_TYPE	  SemVerParser
+
+namespace OUU::Tests::SemVerParserBenchmark
+{
+	constexpr int32 NumVersionStrings = 20000;
+
+	/** Version strings like they appear in plugin manifests and patch catalogs */
+	TArray<FString> MakeVersionStrings()
+	{
+		const TCHAR* PreReleases[] = {TEXT(""), TEXT("-alpha"), TEXT("-beta.2"), TEXT("-rc.1")};
+		const TCHAR* Metadata[] = {TEXT(""), TEXT(""), TEXT("+build.1848"), TEXT("+ci.20231019")};
+
+		FRandomStream Stream(42);
+		TArray<FString> Result;
+		Result.Reserve(NumVersionStrings);
+		for (int32 i = 0; i < NumVersionStrings; i++)
+		{
+			Result.Add(FString::Printf(
+				TEXT("%i.%i.%i%s%s"),
+				Stream.RandRange(0, 20),
+				Stream.RandRange(0, 99),
+				Stream.RandRange(1, 999),
+				PreReleases[Stream.RandRange(0, UE_ARRAY_COUNT(PreReleases) - 1)],
+				Metadata[Stream.RandRange(0, UE_ARRAY_COUNT(Metadata) - 1)]));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::SemVerParserBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(Throughput, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::SemVerParserBenchmark;
+	using namespace OUU::TestUtilities;
+
+	const TArray<FString> VersionStrings = MakeVersionStrings();
+	for (auto Strictness : TEnumRange<ESemVerParsingStrictness>())
+	{
+		const FString StrictnessString = LexToString(Strictness);
+
+		// Reference: Splitting the string with the regex (like FSemanticVersion did before the hand-written parser)
+		int32 NumRegexSuccesses = 0;
+		RunAndReportBenchmark(
+			*this,
+			FString::Printf(TEXT("Regex split (%s)"), *StrictnessString),
+			NumVersionStrings,
+			[&]() {
+				for (const FString& VersionString : VersionStrings)
+				{
+					const FRegexGroups Groups = OUU::Runtime::RegexUtils::GetFirstRegexMatchAndGroups(
+						FSemVerRegex::String(Strictness),
+						5,
+						VersionString);
+					NumRegexSuccesses += Groups.IsValid() ? 1 : 0;
+				}
+			});
+
+		int32 NumParserSuccesses = 0;
+		RunAndReportBenchmark(
+			*this,
+			FString::Printf(TEXT("SemVerParser::TryParse (%s)"), *StrictnessString),
+			NumVersionStrings,
+			[&]() {
+				OUU::Runtime::SemVerParser::FSemVerStringComponents Components;
+				for (const FString& VersionString : VersionStrings)
+				{
+					NumParserSuccesses +=
+						OUU::Runtime::SemVerParser::TryParse(VersionString, Strictness, Components) ? 1 : 0;
+				}
+			});
+
+		int32 NumSemVerSuccesses = 0;
+		RunAndReportBenchmark(
+			*this,
+			FString::Printf(TEXT("FSemanticVersion::TryParseString (%s)"), *StrictnessString),
+			NumVersionStrings,
+			[&]() {
+				FSemanticVersion SemVer;
+				for (const FString& VersionString : VersionStrings)
+				{
+					NumSemVerSuccesses += SemVer.TryParseString(VersionString, Strictness) ? 1 : 0;
+				}
+			});
+
+		TestEqual(TEXT("Regex successes (") + StrictnessString + TEXT(")"), NumRegexSuccesses, NumVersionStrings);
+		TestEqual(TEXT("Parser successes (") + StrictnessString + TEXT(")"), NumParserSuccesses, NumVersionStrings);
+		TestEqual(TEXT("SemVer successes (") + StrictnessString + TEXT(")"), NumSemVerSuccesses, NumVersionStrings);
+	}
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
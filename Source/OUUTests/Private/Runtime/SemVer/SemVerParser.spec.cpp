@@ -0,0 +1,239 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Algo/Compare.h"
+	#include "Math/RandomStream.h"
+	#include "Misc/RegexUtils.h"
+	#include "Runtime/SemVer/SemVerTests.h"
+	#include "SemVer/SemVerParser.h"
+	#include "SemVer/SemVerRegex.h"
+
+// ReSharper disable StringLiteralTypo
+
+namespace OUU::Tests::SemVerParser
+{
+	constexpr int32 NumFuzzStrings = 2000;
+
+	// Weighted towards the characters that are relevant for the grammar
+	const FString FuzzAlphabet = TEXT("00123456789.....---+++abzAZ_@# \t\n");
+
+	const TArray<FString> AdditionalCorpus = {
+		"",
+		"0",
+		"0.0.0",
+		"01.006.010-01.0build.02",
+		"1.0.5+build@meta#data",
+		"42",
+		"4.3",
+		"1.2.3.4",
+		"1.2.3.4 ",
+		"1.2.3 -build-metadata",
+		"Version#=1.2.3-alpha+build",
+		"The version 1.2.3-alpha+build is the version we need",
+		"1.0.0-",
+		"1.0.0+",
+		"1.0.0-+",
+		"1.0.0--",
+		"1..2",
+		"1.a.2",
+		"v1.2",
+		"1.0.0\n",
+		"1.0.0+meta\n",
+		"1.0.0-alpha.01",
+		"1.0.0-0a.-",
+		"99999999999.1.0"};
+
+	/** Components as strings, so results of the regex and the parser can be compared directly */
+	struct FComponents
+	{
+		bool bSuccess = false;
+		TArray<FString> Components;
+
+		bool operator==(const FComponents& Other) const
+		{
+			return bSuccess == Other.bSuccess
+				&& (!bSuccess
+					|| Algo::Compare(Components, Other.Components, [](const FString& A, const FString& B) {
+						   return A.Equals(B, ESearchCase::CaseSensitive);
+					   }));
+		}
+
+		FString ToString() const
+		{
+			return bSuccess ? FString::Printf(TEXT("[%s]"), *FString::Join(Components, TEXT("|"))) : TEXT("failed");
+		}
+	};
+
+	/** How FSemanticVersion used to parse strings before the hand-written parser */
+	FComponents ParseWithRegex(const FString& SourceString, ESemVerParsingStrictness Strictness)
+	{
+		FRegexGroups Groups;
+		if (Strictness == ESemVerParsingStrictness::Liberal)
+		{
+			Groups = OUU::Runtime::RegexUtils::GetFirstRegexMatchAndGroups(
+				FSemVerRegex::String(Strictness),
+				5,
+				SourceString);
+		}
+		else
+		{
+			Groups = OUU::Runtime::RegexUtils::GetRegexMatchAndGroupsExact(
+				FSemVerRegex::String(Strictness),
+				5,
+				SourceString);
+		}
+
+		FComponents Result;
+		Result.bSuccess = Groups.IsValid();
+		for (int32 i = 1; i < Groups.CaptureGroups.Num(); i++)
+		{
+			Result.Components.Add(Groups.CaptureGroups[i].MatchString);
+		}
+		return Result;
+	}
+
+	FComponents ParseWithParser(const FString& SourceString, ESemVerParsingStrictness Strictness)
+	{
+		OUU::Runtime::SemVerParser::FSemVerStringComponents Components;
+		FComponents Result;
+		Result.bSuccess = OUU::Runtime::SemVerParser::TryParse(SourceString, Strictness, Components);
+		Result.Components = {
+			FString(Components.Major),
+			FString(Components.Minor),
+			FString(Components.Patch),
+			FString(Components.PreRelease),
+			FString(Components.BuildMetadata)};
+		return Result;
+	}
+
+	FString MakeRandomString(FRandomStream& Stream)
+	{
+		FString Result;
+		const int32 Len = Stream.RandRange(0, 24);
+		for (int32 i = 0; i < Len; i++)
+		{
+			Result.AppendChar(FuzzAlphabet[Stream.RandRange(0, FuzzAlphabet.Len() - 1)]);
+		}
+		return Result;
+	}
+
+	/** Insert, remove or replace a few characters of a (mostly valid) source string */
+	FString MutateString(FRandomStream& Stream, const FString& Source)
+	{
+		FString Result = Source;
+		const int32 NumMutations = Stream.RandRange(1, 3);
+		for (int32 i = 0; i < NumMutations; i++)
+		{
+			const TCHAR Char = FuzzAlphabet[Stream.RandRange(0, FuzzAlphabet.Len() - 1)];
+			const int32 Index = Stream.RandRange(0, Result.Len());
+			switch (Stream.RandRange(0, 2))
+			{
+			case 0: Result.InsertAt(Index, Char); break;
+			case 1:
+				if (Index < Result.Len())
+				{
+					Result.RemoveAt(Index);
+				}
+				break;
+			default:
+				if (Index < Result.Len())
+				{
+					Result[Index] = Char;
+				}
+				break;
+			}
+		}
+		return Result;
+	}
+
+	TArray<FString> MakeCorpus()
+	{
+		TArray<FString> Corpus = ValidSemVers;
+		Corpus.Append(InvalidSemVers);
+		Corpus.Append(AdditionalCorpus);
+		return Corpus;
+	}
+
+	TArray<FString> MakeFuzzStrings()
+	{
+		FRandomStream Stream(1337);
+		const TArray<FString> Corpus = MakeCorpus();
+		TArray<FString> Result;
+		for (int32 i = 0; i < NumFuzzStrings; i++)
+		{
+			Result.Add(
+				i % 2 == 0 ? MakeRandomString(Stream)
+						   : MutateString(Stream, Corpus[Stream.RandRange(0, Corpus.Num() - 1)]));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::SemVerParser
+
+BEGIN_DEFINE_SPEC(FSemVerParserSpec, "OpenUnrealUtilities.Runtime.SemVer.SemVerParser", DEFAULT_OUU_TEST_FLAGS)
+	void TestEquivalence(const TArray<FString>& Strings, ESemVerParsingStrictness Strictness);
+END_DEFINE_SPEC(FSemVerParserSpec)
+
+void FSemVerParserSpec::Define()
+{
+	using namespace OUU::Tests::SemVerParser;
+
+	for (auto Strictness : TEnumRange<ESemVerParsingStrictness>())
+	{
+		Describe(FString::Printf(TEXT("with Strictness level %s"), *LexToString(Strictness)), [this, Strictness]() {
+			It("should return the same results as the regex for the corpus", [this, Strictness]() {
+				TestEquivalence(MakeCorpus(), Strictness);
+			});
+
+			It("should return the same results as the regex for random and mutated strings", [this, Strictness]() {
+				TestEquivalence(MakeFuzzStrings(), Strictness);
+			});
+		});
+	}
+
+	Describe("ParseVersionNumber", [this]() {
+		It("should parse numbers with leading zeroes", [this]() {
+			SPEC_TEST_EQUAL(OUU::Runtime::SemVerParser::ParseVersionNumber(TEXT("0042")), 42);
+		});
+
+		It("should saturate at the max int value", [this]() {
+			SPEC_TEST_EQUAL(
+				OUU::Runtime::SemVerParser::ParseVersionNumber(TEXT("99999999999999999999")),
+				TNumericLimits<int32>::Max());
+		});
+	});
+}
+
+void FSemVerParserSpec::TestEquivalence(const TArray<FString>& Strings, ESemVerParsingStrictness Strictness)
+{
+	using namespace OUU::Tests::SemVerParser;
+
+	int32 NumMismatches = 0;
+	for (const FString& String : Strings)
+	{
+		const FComponents Expected = ParseWithRegex(String, Strictness);
+		const FComponents Actual = ParseWithParser(String, Strictness);
+		const bool bExpectedValid =
+			OUU::Runtime::RegexUtils::MatchesRegexExact(FSemVerRegex::String(Strictness), String);
+		const bool bActualValid = OUU::Runtime::SemVerParser::IsValidSemVer(String, Strictness);
+		if (Expected == Actual && bExpectedValid == bActualValid)
+			continue;
+
+		// Only report the first few mismatches, so a broken parser does not flood the log
+		if (NumMismatches++ < 10)
+		{
+			AddError(FString::Printf(
+				TEXT("'%s': regex %s (valid: %i), parser %s (valid: %i)"),
+				*String.ReplaceCharWithEscapedChar(),
+				*Expected.ToString(),
+				bExpectedValid,
+				*Actual.ToString(),
+				bActualValid));
+		}
+	}
+	SPEC_TEST_EQUAL(NumMismatches, 0);
+}
+
+#endif
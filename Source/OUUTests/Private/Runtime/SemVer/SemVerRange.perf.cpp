@@ -0,0 +1,79 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/RandomStream.h"
+	#include "SemVer/SemVerRange.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.SemVer.Benchmarks
+	#define OUU_TEST_TYPE	  SemVerRange
+
+namespace OUU::Tests::SemVerRangeBenchmark
+{
+	constexpr int32 NumVersions = 100000;
+
+	const TCHAR* RangeExpression = TEXT("^1.2.0 || ~2.4 || >=3.1.0 <3.5 || 4.0.0 - 4.2");
+
+	TArray<FSemanticVersion> MakeVersions()
+	{
+		const FSemVerPreReleaseIdentifier PreReleases[] = {{}, {}, {}, {TEXT("beta.1")}, {TEXT("rc.2")}};
+
+		FRandomStream Stream(42);
+		TArray<FSemanticVersion> Result;
+		Result.Reserve(NumVersions);
+		for (int32 i = 0; i < NumVersions; i++)
+		{
+			Result.Add(FSemanticVersion(
+				Stream.RandRange(1, 5),
+				Stream.RandRange(0, 9),
+				Stream.RandRange(0, 20),
+				PreReleases[Stream.RandRange(0, UE_ARRAY_COUNT(PreReleases) - 1)]));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::SemVerRangeBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(Satisfies, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::SemVerRangeBenchmark;
+	using namespace OUU::TestUtilities;
+
+	const TArray<FSemanticVersion> Versions = MakeVersions();
+
+	// Reference: Parsing the range expression for every check
+	int32 NumSatisfiedParsed = 0;
+	RunAndReportBenchmark(*this, TEXT("Parse + IsSatisfiedBy"), NumVersions, [&]() {
+		for (const FSemanticVersion& Version : Versions)
+		{
+			NumSatisfiedParsed += FSemVerRange(RangeExpression).IsSatisfiedBy(Version) ? 1 : 0;
+		}
+	});
+
+	const FSemVerRange Range(RangeExpression);
+	int32 NumSatisfiedCompiled = 0;
+	RunAndReportBenchmark(*this, TEXT("IsSatisfiedBy (compiled)"), NumVersions, [&]() {
+		for (const FSemanticVersion& Version : Versions)
+		{
+			NumSatisfiedCompiled += Range.IsSatisfiedBy(Version) ? 1 : 0;
+		}
+	});
+
+	int32 MaxSatisfyingIdx = INDEX_NONE;
+	RunAndReportBenchmark(*this, TEXT("FindMaxSatisfying"), NumVersions, [&]() {
+		MaxSatisfyingIdx = Range.FindMaxSatisfying(Versions);
+	});
+
+	TestEqual(TEXT("Compiled result"), NumSatisfiedCompiled, NumSatisfiedParsed);
+	if (TestNotEqual(TEXT("Max satisfying index"), MaxSatisfyingIdx, static_cast<int32>(INDEX_NONE)))
+	{
+		TestTrue(TEXT("Max satisfying version is in range"), Range.IsSatisfiedBy(Versions[MaxSatisfyingIdx]));
+	}
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,221 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "SemVer/SemVerRange.h"
+
+// ReSharper disable StringLiteralTypo
+
+namespace OUU::Tests::SemVerRange
+{
+	struct FRangeTestCase
+	{
+		const TCHAR* Range;
+		const TCHAR* Version;
+	};
+
+	// Taken from the node-semver range tests
+	const FRangeTestCase SatisfiedRanges[] = {
+		{TEXT("1.0.0 - 2.0.0"), TEXT("1.2.3")},
+		{TEXT("^1.2.3+build"), TEXT("1.3.0")},
+		{TEXT("1.2.3-pre+asdf - 2.4.3-pre+asdf"), TEXT("1.2.3")},
+		{TEXT("1.2.3 - 2.3"), TEXT("2.3.9")},
+		{TEXT("*"), TEXT("1.2.3")},
+		{TEXT(""), TEXT("1.0.0")},
+		{TEXT(">=1.0.0"), TEXT("1.0.0")},
+		{TEXT(">1.0.0"), TEXT("1.0.1")},
+		{TEXT("<=2.0.0"), TEXT("2.0.0")},
+		{TEXT("<2.0.0"), TEXT("1.9999.9999")},
+		{TEXT(">= 1.0.0"), TEXT("1.0.0")},
+		{TEXT("0.1.20 || 1.2.4"), TEXT("1.2.4")},
+		{TEXT(">=0.2.3 || <0.0.1"), TEXT("0.0.0")},
+		{TEXT("2.x.x"), TEXT("2.1.3")},
+		{TEXT("1.2.x"), TEXT("1.2.3")},
+		{TEXT("1.2.x || 2.x"), TEXT("2.1.3")},
+		{TEXT("x"), TEXT("1.2.3")},
+		{TEXT("~2.4"), TEXT("2.4.5")},
+		{TEXT("~>3.2.1"), TEXT("3.2.2")},
+		{TEXT("~1"), TEXT("1.2.3")},
+		{TEXT("~1.0"), TEXT("1.0.2")},
+		{TEXT("~ 1.0"), TEXT("1.0.2")},
+		{TEXT(">=1"), TEXT("1.0.0")},
+		{TEXT("<1.2"), TEXT("1.1.1")},
+		{TEXT(">1.2 <2"), TEXT("1.3.0")},
+		{TEXT("~v0.5.4-pre"), TEXT("0.5.5")},
+		{TEXT("~v0.5.4-pre"), TEXT("0.5.4")},
+		{TEXT("=0.7.x"), TEXT("0.7.2")},
+		{TEXT("<=0.7.x"), TEXT("0.7.2")},
+		{TEXT("^1.2.3"), TEXT("1.8.1")},
+		{TEXT("^0.1.2"), TEXT("0.1.2")},
+		{TEXT("^0.1"), TEXT("0.1.2")},
+		{TEXT("^0.0.1"), TEXT("0.0.1")},
+		{TEXT("^1.2"), TEXT("1.4.2")},
+		{TEXT("^1.2.3-beta.2"), TEXT("1.2.3-beta.4")},
+		{TEXT("^1.2.0-alpha"), TEXT("1.2.0-pre")},
+	};
+
+	const FRangeTestCase UnsatisfiedRanges[] = {
+		{TEXT("1.0.0 - 2.0.0"), TEXT("2.2.3")},
+		{TEXT("^1.2.3"), TEXT("1.2.2")},
+		{TEXT("^1.2.3"), TEXT("2.0.0")},
+		{TEXT("^1.2.3"), TEXT("2.0.0-alpha")},
+		{TEXT("^0.1.2"), TEXT("0.2.0")},
+		{TEXT("^0.0.1"), TEXT("0.0.2")},
+		{TEXT("~1.2.3"), TEXT("1.3.0")},
+		{TEXT(">1.2"), TEXT("1.2.8")},
+		{TEXT("<1.2"), TEXT("1.2.0")},
+		{TEXT("1"), TEXT("2.0.0")},
+		{TEXT("=0.7.x"), TEXT("0.8.2")},
+		{TEXT("~v0.5.4-beta"), TEXT("0.5.4-alpha")},
+		{TEXT("<1.2.3"), TEXT("1.2.3-beta")},
+		{TEXT(">1.2.3"), TEXT("1.3.0-beta")},
+		{TEXT("*"), TEXT("1.2.3-beta")},
+		{TEXT("^1.2.3-beta.2"), TEXT("1.2.4-beta.1")},
+		{TEXT(">=1.2.3 <1.0.0"), TEXT("1.1.0")},
+		{TEXT("<*"), TEXT("1.0.0")},
+	};
+
+	const TCHAR* InvalidRanges[] = {
+		TEXT("1.2.3.4"),
+		TEXT(">="),
+		TEXT("1.x.3"),
+		TEXT("1.2.3-"),
+		TEXT("a.b.c"),
+		TEXT("1.2.3 -"),
+		TEXT("- 1.2.3"),
+		TEXT("^1.2.3 || >=x.1"),
+	};
+} // namespace OUU::Tests::SemVerRange
+
+BEGIN_DEFINE_SPEC(FSemVerRangeSpec, "OpenUnrealUtilities.Runtime.SemVer.SemVerRange", DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FSemVerRangeSpec)
+
+void FSemVerRangeSpec::Define()
+{
+	using namespace OUU::Tests::SemVerRange;
+
+	Describe("TryParseString", [this]() {
+		It("should succeed on all valid range expressions", [this]() {
+			for (const FRangeTestCase& TestCase : SatisfiedRanges)
+			{
+				FSemVerRange Range;
+				TestTrue(TestCase.Range, Range.TryParseString(TestCase.Range));
+			}
+		});
+
+		It("should fail on invalid range expressions and not be satisfied by any version", [this]() {
+			for (const TCHAR* Expression : InvalidRanges)
+			{
+				FSemVerRange Range;
+				TestFalse(Expression, Range.TryParseString(Expression));
+				TestTrue(FString::Printf(TEXT("%s is empty"), Expression), Range.IsEmpty());
+				TestEqual(FString::Printf(TEXT("%s expression"), Expression), Range.ToString(), FString(Expression));
+			}
+		});
+
+		It("should compile one interval per satisfiable comparator set", [this]() {
+			SPEC_TEST_EQUAL(FSemVerRange("^1.2.3").GetIntervals().Num(), 1);
+			SPEC_TEST_EQUAL(FSemVerRange("1.x || 2.x || >=3.0.0 <3.5").GetIntervals().Num(), 3);
+			SPEC_TEST_EQUAL(FSemVerRange(">=1.2.3 <1.0.0 || 2.x").GetIntervals().Num(), 1);
+			SPEC_TEST_TRUE(FSemVerRange(">=1.2.3 <1.0.0").IsEmpty());
+		});
+
+		It("should intersect the comparators of a comparator set", [this]() {
+			const FSemVerRange Range(">=1.0.0 >=1.2.0 <3.0.0 <2.0.0");
+			if (SPEC_TEST_EQUAL(Range.GetIntervals().Num(), 1))
+			{
+				const FSemVerRangeInterval& Interval = Range.GetIntervals()[0];
+				if (SPEC_TEST_TRUE(Interval.Lower.IsSet() && Interval.Upper.IsSet()))
+				{
+					SPEC_TEST_EQUAL(Interval.Lower->Version, FSemanticVersion(1, 2, 0));
+					SPEC_TEST_EQUAL(Interval.Upper->Version, FSemanticVersion(2, 0, 0));
+					SPEC_TEST_FALSE(Interval.Upper->bInclusive);
+				}
+			}
+		});
+	});
+
+	Describe("IsSatisfiedBy", [this]() {
+		It("should be satisfied by versions in the range", [this]() {
+			for (const FRangeTestCase& TestCase : SatisfiedRanges)
+			{
+				TestTrue(
+					FString::Printf(TEXT("%s satisfies %s"), TestCase.Version, TestCase.Range),
+					FSemVerRange(TestCase.Range).IsSatisfiedBy(FSemanticVersion(TestCase.Version)));
+			}
+		});
+
+		It("should not be satisfied by versions outside of the range", [this]() {
+			for (const FRangeTestCase& TestCase : UnsatisfiedRanges)
+			{
+				TestFalse(
+					FString::Printf(TEXT("%s satisfies %s"), TestCase.Version, TestCase.Range),
+					FSemVerRange(TestCase.Range).IsSatisfiedBy(FSemanticVersion(TestCase.Version)));
+			}
+		});
+
+		It("should ignore build metadata", [this]() {
+			SPEC_TEST_TRUE(FSemVerRange("1.2.3").IsSatisfiedBy(FSemanticVersion("1.2.3+build.5")));
+			SPEC_TEST_FALSE(FSemVerRange(">1.2.3").IsSatisfiedBy(FSemanticVersion("1.2.3+build.5")));
+		});
+
+		It("should be satisfied by pre-releases in the range if they are included explicitly", [this]() {
+			SPEC_TEST_TRUE(FSemVerRange("*").IsSatisfiedBy(FSemanticVersion("1.0.0-beta"), true));
+			SPEC_TEST_TRUE(FSemVerRange("^1.2.3").IsSatisfiedBy(FSemanticVersion("1.3.0-alpha"), true));
+			SPEC_TEST_FALSE(FSemVerRange("^1.2.3").IsSatisfiedBy(FSemanticVersion("2.0.0-alpha"), true));
+		});
+
+		It("should be satisfied by all release versions for the default range", [this]() {
+			const FSemVerRange Range;
+			SPEC_TEST_EQUAL(Range.ToString(), FString(TEXT("*")));
+			SPEC_TEST_TRUE(Range.IsSatisfiedBy(FSemanticVersion("0.1.0")));
+			SPEC_TEST_TRUE(Range.IsSatisfiedBy(FSemanticVersion("1000000.0.0")));
+			SPEC_TEST_FALSE(Range.IsSatisfiedBy(FSemanticVersion("1.0.0-rc.1")));
+		});
+	});
+
+	Describe("ImportText", [this]() {
+		It("should compile the intervals of imported ranges", [this]() {
+			for (const TCHAR* Text : {TEXT("(Expression=\"^1.2.0\")"), TEXT("\"^1.2.0\"")})
+			{
+				FSemVerRange Range;
+				const UScriptStruct* Struct = FSemVerRange::StaticStruct();
+				const TCHAR* Result = Struct->ImportText(Text, &Range, nullptr, PPF_None, GLog, Struct->GetName());
+				SPEC_TEST_NOT_NULL(Result);
+
+				SPEC_TEST_EQUAL(Range.ToString(), FString(TEXT("^1.2.0")));
+				SPEC_TEST_TRUE(Range.IsSatisfiedBy(FSemanticVersion("1.5.0")));
+				SPEC_TEST_FALSE(Range.IsSatisfiedBy(FSemanticVersion("2.0.0")));
+			}
+		});
+	});
+
+	Describe("FindMaxSatisfying", [this]() {
+		const TArray<FSemanticVersion> Candidates{
+			{"1.0.0"},
+			{"1.5.0"},
+			{"2.0.0"},
+			{"1.5.0+build.2"},
+			{"1.9.0-beta"},
+		};
+
+		It("should return the index of the highest satisfying candidate", [this, Candidates]() {
+			SPEC_TEST_EQUAL(FSemVerRange("^1.0.0").FindMaxSatisfying(Candidates), 1);
+			SPEC_TEST_EQUAL(FSemVerRange("*").FindMaxSatisfying(Candidates), 2);
+			SPEC_TEST_EQUAL(FSemVerRange("<1.5").FindMaxSatisfying(Candidates), 0);
+		});
+
+		It("should consider pre-releases if they are included", [this, Candidates]() {
+			SPEC_TEST_EQUAL(FSemVerRange("^1.0.0").FindMaxSatisfying(Candidates, true), 4);
+		});
+
+		It("should return INDEX_NONE if no candidate satisfies the range", [this, Candidates]() {
+			SPEC_TEST_EQUAL(FSemVerRange("^3").FindMaxSatisfying(Candidates), static_cast<int32>(INDEX_NONE));
+			SPEC_TEST_EQUAL(FSemVerRange("^1.0.0").FindMaxSatisfying({}), static_cast<int32>(INDEX_NONE));
+		});
+	});
+}
+
+#endif
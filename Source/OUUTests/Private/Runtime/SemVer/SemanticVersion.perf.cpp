@@ -0,0 +1,90 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Algo/IsSorted.h"
+	#include "Algo/Sort.h"
+	#include "Math/RandomStream.h"
+	#include "SemVer/SemanticVersion.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.SemVer.Benchmarks
+	#define OUU_TEST_TYPE	  SemanticVersion
+
+namespace OUU::Tests::SemanticVersionBenchmark
+{
+	constexpr int32 NumVersions = 1000000;
+
+	/** Precedence comparison like FSemanticVersion did before the packed precedence key */
+	bool IsLowerPrecedenceComponentWise(const FSemanticVersion& A, const FSemanticVersion& B)
+	{
+		if (A.MajorVersion != B.MajorVersion)
+			return A.MajorVersion < B.MajorVersion;
+		if (A.MinorVersion != B.MinorVersion)
+			return A.MinorVersion < B.MinorVersion;
+		if (A.PatchVersion != B.PatchVersion)
+			return A.PatchVersion < B.PatchVersion;
+		return A.PreReleaseIdentifier < B.PreReleaseIdentifier;
+	}
+
+	/** Versions like they appear in a patch catalog: Few majors, many patches, some pre-releases */
+	TArray<FSemanticVersion> MakeVersions()
+	{
+		const FSemVerPreReleaseIdentifier PreReleases[] = {
+			{},
+			{},
+			{TEXT("alpha")},
+			{TEXT("alpha.2")},
+			{TEXT("beta.1")},
+			{TEXT("rc.1")},
+			{TEXT("rc.2")},
+		};
+
+		FRandomStream Stream(42);
+		TArray<FSemanticVersion> Result;
+		Result.Reserve(NumVersions);
+		for (int32 i = 0; i < NumVersions; i++)
+		{
+			Result.Add(FSemanticVersion(
+				Stream.RandRange(1, 20),
+				Stream.RandRange(0, 99),
+				Stream.RandRange(0, 999),
+				PreReleases[Stream.RandRange(0, UE_ARRAY_COUNT(PreReleases) - 1)]));
+		}
+		return Result;
+	}
+} // namespace OUU::Tests::SemanticVersionBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(SortByPrecedence, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::SemanticVersionBenchmark;
+	using namespace OUU::TestUtilities;
+
+	const TArray<FSemanticVersion> Versions = MakeVersions();
+
+	TArray<FSemanticVersion> ComponentWiseSorted = Versions;
+	RunAndReportBenchmark(*this, TEXT("Algo::Sort (component-wise comparison)"), NumVersions, [&]() {
+		Algo::Sort(ComponentWiseSorted, &IsLowerPrecedenceComponentWise);
+	});
+
+	TArray<FSemanticVersion> OperatorSorted = Versions;
+	RunAndReportBenchmark(*this, TEXT("Algo::Sort (operator< with precedence key)"), NumVersions, [&]() {
+		Algo::Sort(OperatorSorted, FSemanticVersionPrecedenceLess());
+	});
+
+	TArray<FSemanticVersion> KeySorted = Versions;
+	RunAndReportBenchmark(*this, TEXT("FSemanticVersion::SortByPrecedence"), NumVersions, [&]() {
+		FSemanticVersion::SortByPrecedence(KeySorted);
+	});
+
+	TestTrue(TEXT("Component-wise sorted"), Algo::IsSorted(ComponentWiseSorted, &IsLowerPrecedenceComponentWise));
+	TestTrue(TEXT("operator< sorted"), Algo::IsSorted(OperatorSorted, &IsLowerPrecedenceComponentWise));
+	TestTrue(TEXT("SortByPrecedence sorted"), Algo::IsSorted(KeySorted, &IsLowerPrecedenceComponentWise));
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
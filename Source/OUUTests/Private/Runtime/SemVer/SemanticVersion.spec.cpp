@@ -4,11 +4,47 @@
 
 #if WITH_AUTOMATION_WORKER
 
+	#include "Algo/Sort.h"
+	#include "Containers/SortedMap.h"
 	#include "Runtime/SemVer/SemVerTests.h"
 	#include "SemVer/SemanticVersion.h"
 
 // ReSharper disable StringLiteralTypo
 
+namespace OUU::Tests::SemanticVersion
+{
+	/** Reference precedence comparison without the packed key */
+	bool IsLowerPrecedenceComponentWise(const FSemanticVersion& A, const FSemanticVersion& B)
+	{
+		if (A.MajorVersion != B.MajorVersion)
+			return A.MajorVersion < B.MajorVersion;
+		if (A.MinorVersion != B.MinorVersion)
+			return A.MinorVersion < B.MinorVersion;
+		if (A.PatchVersion != B.PatchVersion)
+			return A.PatchVersion < B.PatchVersion;
+		return A.PreReleaseIdentifier < B.PreReleaseIdentifier;
+	}
+
+	TArray<FSemanticVersion> MakeValidSemVers()
+	{
+		TArray<FSemanticVersion> Result;
+		for (const FString& SemVerString : ValidSemVers)
+		{
+			Result.Add(FSemanticVersion(SemVerString));
+		}
+		Result.Add(FSemanticVersion(TEXT("1.0.0-1")));
+		Result.Add(FSemanticVersion(TEXT("1.0.0-63")));
+		Result.Add(FSemanticVersion(TEXT("1.0.0-64")));
+		Result.Add(FSemanticVersion(TEXT("1.0.0-Alpha")));
+		Result.Add(FSemanticVersion(TEXT("1.0.0-zeta")));
+		Result.Add(FSemanticVersion(TEXT("2000000.0.0")));
+		Result.Add(FSemanticVersion(TEXT("2000001.0.0")));
+		Result.Add(FSemanticVersion(TEXT("1.300000.0")));
+		Result.Add(FSemanticVersion(TEXT("1.300001.0")));
+		return Result;
+	}
+} // namespace OUU::Tests::SemanticVersion
+
 BEGIN_DEFINE_SPEC(FSemanticVersionSpec, "OpenUnrealUtilities.Runtime.SemVer.SemanticVersion", DEFAULT_OUU_TEST_FLAGS)
 END_DEFINE_SPEC(FSemanticVersionSpec)
 
@@ -460,6 +496,109 @@ void FSemanticVersionSpec::Define()
 			}
 		});
 	});
+
+	Describe("GetPrecedenceKey", [this]() {
+		It("should never contradict the component-wise precedence comparison", [this]() {
+			using namespace OUU::Tests::SemanticVersion;
+			const TArray<FSemanticVersion> SemVers = MakeValidSemVers();
+			for (const FSemanticVersion& A : SemVers)
+			{
+				for (const FSemanticVersion& B : SemVers)
+				{
+					if (A.GetPrecedenceKey() < B.GetPrecedenceKey())
+					{
+						TestTrue(
+							FString::Printf(TEXT("%s < %s"), *A.ToString(), *B.ToString()),
+							IsLowerPrecedenceComponentWise(A, B));
+					}
+				}
+			}
+		});
+
+		It("should not change the results of the comparison operators", [this]() {
+			using namespace OUU::Tests::SemanticVersion;
+			const TArray<FSemanticVersion> SemVers = MakeValidSemVers();
+			for (const FSemanticVersion& A : SemVers)
+			{
+				for (const FSemanticVersion& B : SemVers)
+				{
+					const FString Description = FString::Printf(TEXT("%s vs %s"), *A.ToString(), *B.ToString());
+					TestEqual(Description + TEXT(" (<)"), A < B, IsLowerPrecedenceComponentWise(A, B));
+					TestEqual(Description + TEXT(" (>)"), A > B, IsLowerPrecedenceComponentWise(B, A));
+				}
+			}
+		});
+
+		It("should be equal for versions that only differ in build metadata or case", [this]() {
+			const FSemanticVersion A("1.2.3-alpha.1+build.1");
+			const FSemanticVersion B("1.2.3-ALPHA.1+build.2");
+			SPEC_TEST_EQUAL(A.GetPrecedenceKey(), B.GetPrecedenceKey());
+		});
+	});
+
+	Describe("SortByPrecedence", [this]() {
+		It("should sort in the same order as the component-wise precedence comparison", [this]() {
+			using namespace OUU::Tests::SemanticVersion;
+			TArray<FSemanticVersion> Sorted = MakeValidSemVers();
+			FSemanticVersion::SortByPrecedence(Sorted);
+			TArray<FSemanticVersion> Expected = MakeValidSemVers();
+			Algo::Sort(Expected, &IsLowerPrecedenceComponentWise);
+
+			if (SPEC_TEST_EQUAL(Sorted.Num(), Expected.Num()))
+			{
+				// The sort is not stable, so versions with equal precedence may be swapped
+				for (int32 i = 0; i < Sorted.Num(); i++)
+				{
+					const FString Description =
+						FString::Printf(TEXT("%s equals %s"), *Sorted[i].ToString(), *Expected[i].ToString());
+					TestTrue(Description, Sorted[i].EqualsPrecedence(Expected[i]));
+				}
+			}
+		});
+	});
+
+	Describe("GetTypeHash", [this]() {
+		It("should return the same hash for equal versions", [this]() {
+			const FSemanticVersion A("1.2.3-alpha.1+build.1");
+			const FSemanticVersion B("1.2.3-alpha.1+build.1");
+			SPEC_TEST_EQUAL(GetTypeHash(A), GetTypeHash(B));
+		});
+
+		It("should allow using versions as set and map keys", [this]() {
+			TSet<FSemanticVersion> Set;
+			Set.Add(FSemanticVersion("1.2.3"));
+			Set.Add(FSemanticVersion("1.2.3"));
+			Set.Add(FSemanticVersion("1.2.3-alpha"));
+			Set.Add(FSemanticVersion("1.2.3+build.1"));
+			SPEC_TEST_EQUAL(Set.Num(), 3);
+
+			TMap<FSemanticVersion, int32> Map;
+			Map.Add(FSemanticVersion("2.0.0-rc.1"), 42);
+			const int32* Value = Map.Find(FSemanticVersion("2.0.0-rc.1"));
+			if (SPEC_TEST_NOT_NULL(Value))
+			{
+				SPEC_TEST_EQUAL(*Value, 42);
+			}
+		});
+	});
+
+	Describe("FSemanticVersionPrecedenceLess", [this]() {
+		It("should keep sorted maps ordered by precedence", [this]() {
+			TSortedMap<FSemanticVersion, int32, FDefaultAllocator, FSemanticVersionPrecedenceLess> Map;
+			Map.Add(FSemanticVersion("2.0.0"), 3);
+			Map.Add(FSemanticVersion("1.0.0-alpha"), 0);
+			Map.Add(FSemanticVersion("1.0.0"), 2);
+			Map.Add(FSemanticVersion("1.0.0-beta"), 1);
+
+			int32 ExpectedValue = 0;
+			for (const auto& Entry : Map)
+			{
+				SPEC_TEST_EQUAL(Entry.Value, ExpectedValue);
+				ExpectedValue++;
+			}
+			SPEC_TEST_EQUAL(ExpectedValue, 4);
+		});
+	});
 }
 
 #endif
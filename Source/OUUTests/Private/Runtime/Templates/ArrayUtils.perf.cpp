@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/RandomStream.h"
+	#include "Templates/ArrayUtils.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  ArrayUtils
+
+namespace OUU::Tests::ArrayUtilsBenchmark
+{
+	// Array sizes around the default sequential threshold to find the crossover point.
+	// Arrays smaller than ParallelDefaults::MinChunkSize are never split, so they are not included.
+	constexpr int32 ArraySizes[] = {4096, 8192, 16384, 32768, 65536, 262144, 1048576};
+
+	// Repeat small workloads, so every measurement takes a comparable amount of time
+	constexpr int64 NumElementsPerMeasurement = 8 * 1024 * 1024;
+
+	TArray<FVector> MakeLocations(int32 Num)
+	{
+		FRandomStream Stream(42);
+		TArray<FVector> Result;
+		Result.Reserve(Num);
+		for (int32 i = 0; i < Num; i++)
+		{
+			Result.Add(Stream.GetUnitVector() * Stream.FRandRange(0.0, 100000.0));
+		}
+		return Result;
+	}
+
+	/**
+	 * Run the same workload sequentially (threshold = MAX_int32) and parallel (threshold = 0) for all array sizes and
+	 * report the time per element of both variants.
+	 */
+	template <typename WorkloadType>
+	void RunSequentialVsParallel(FAutomationTestBase& Test, const TCHAR* WorkloadName, WorkloadType&& Workload)
+	{
+		for (const int32 Num : ArraySizes)
+		{
+			const TArray<FVector> Locations = MakeLocations(Num);
+			const int64 NumRepetitions = FMath::Max<int64>(NumElementsPerMeasurement / Num, 1);
+
+			const auto Sequential = OUU::TestUtilities::RunBenchmark(
+				FString::Printf(TEXT("%s sequential (%i elements)"), WorkloadName, Num),
+				NumRepetitions * Num,
+				[&]() {
+					for (int64 i = 0; i < NumRepetitions; i++)
+					{
+						Workload(Locations, MAX_int32);
+					}
+				});
+			const auto Parallel = OUU::TestUtilities::RunBenchmark(
+				FString::Printf(TEXT("%s parallel (%i elements)"), WorkloadName, Num),
+				NumRepetitions * Num,
+				[&]() {
+					for (int64 i = 0; i < NumRepetitions; i++)
+					{
+						Workload(Locations, 0);
+					}
+				});
+
+			Test.AddInfo(FString::Printf(
+				TEXT("%s / %s -> speedup %.2fx"),
+				*Sequential.ToString(),
+				*Parallel.ToString(),
+				Sequential.TotalSeconds / FMath::Max(Parallel.TotalSeconds, UE_DOUBLE_SMALL_NUMBER)));
+		}
+	}
+} // namespace OUU::Tests::ArrayUtilsBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(ParallelCrossover, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::ArrayUtilsBenchmark;
+	using namespace OUU::Runtime::ArrayUtils;
+
+	AddInfo(FString::Printf(
+		TEXT("Worker threads: %i, default sequential threshold: %i elements"),
+		FTaskGraphInterface::Get().GetNumWorkerThreads(),
+		ParallelDefaults::SequentialThreshold));
+
+	RunSequentialVsParallel(*this, TEXT("Transform"), [](const TArray<FVector>& Locations, int32 Threshold) {
+		ParallelTransform(
+			Locations,
+			[](const FVector& Location) { return Location.Size(); },
+			Threshold);
+	});
+
+	RunSequentialVsParallel(*this, TEXT("Filter"), [](const TArray<FVector>& Locations, int32 Threshold) {
+		ParallelFilter(
+			Locations,
+			[](const FVector& Location) { return Location.SizeSquared() < 50000.0 * 50000.0; },
+			Threshold);
+	});
+
+	RunSequentialVsParallel(*this, TEXT("Reduce"), [](const TArray<FVector>& Locations, int32 Threshold) {
+		ParallelTransformReduce(
+			Locations,
+			FBox(ForceInit),
+			[](const FVector& Location) { return FBox(Location, Location); },
+			[](const FBox& A, const FBox& B) { return A + B; },
+			Threshold);
+	});
+
+	RunSequentialVsParallel(*this, TEXT("MinElement"), [](const TArray<FVector>& Locations, int32 Threshold) {
+		ParallelMinElementIndex(
+			Locations,
+			[](const FVector& A, const FVector& B) { return A.SizeSquared() < B.SizeSquared(); },
+			Threshold);
+	});
+
+	RunSequentialVsParallel(*this, TEXT("StablePartition"), [](const TArray<FVector>& Locations, int32 Threshold) {
+		TArray<FVector> Copy = Locations;
+		ParallelStablePartition(
+			Copy,
+			[](const FVector& Location) { return Location.Z > 0.0; },
+			Threshold);
+	});
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -4,6 +4,7 @@
 
 #if WITH_AUTOMATION_WORKER
 
+	#include "Math/RandomStream.h"
 	#include "Templates/ArrayUtils.h"
 
 BEGIN_DEFINE_SPEC(FArrayUtilsSpec, "OpenUnrealUtilities.Runtime.Templates.ArrayUtils", DEFAULT_OUU_TEST_FLAGS)
@@ -195,6 +196,112 @@ void FArrayUtilsSpec::Define()
 			   });
 		});
 	});
+
+	Describe("Parallel algorithms", [this]() {
+		// Big enough to be split into multiple chunks with a sequential threshold of 0
+		constexpr int32 NumBigArrayElements = 100000;
+		const auto MakeBigArray = []() {
+			FRandomStream Stream(42);
+			TArray<int32> Result;
+			for (int32 i = 0; i < NumBigArrayElements; i++)
+			{
+				Result.Add(Stream.RandHelper(1000));
+			}
+			return Result;
+		};
+		const auto IsEven = [](int32 Value) { return Value % 2 == 0; };
+
+		It("FParallelChunking should cover the whole range with multiple chunks for big arrays", [this]() {
+			const OUU::Runtime::ArrayUtils::FParallelChunking Chunking(NumBigArrayElements, 0, 1000);
+			SPEC_TEST_EQUAL(Chunking.GetChunkStart(0), 0);
+			SPEC_TEST_EQUAL(Chunking.GetChunkEnd(Chunking.NumChunks - 1), NumBigArrayElements);
+			if (FTaskGraphInterface::Get().GetNumWorkerThreads() > 0)
+			{
+				SPEC_TEST_TRUE(Chunking.IsParallel());
+			}
+		});
+
+		It("FParallelChunking should not split small arrays", [this]() {
+			const OUU::Runtime::ArrayUtils::FParallelChunking Chunking(100);
+			SPEC_TEST_FALSE(Chunking.IsParallel());
+		});
+
+		It("ParallelTransform should produce the same result as a sequential transform", [this, MakeBigArray]() {
+			const TArray<int32> SourceArray = MakeBigArray();
+			const TArray<int64> Result = OUU::Runtime::ArrayUtils::ParallelTransform(
+				SourceArray,
+				[](int32 Value) { return static_cast<int64>(Value) * 3; },
+				0);
+
+			TArray<int64> Expected;
+			for (const int32 Value : SourceArray)
+			{
+				Expected.Add(static_cast<int64>(Value) * 3);
+			}
+			SPEC_TEST_ARRAYS_EQUAL(Result, Expected);
+		});
+
+		It("ParallelFilter should keep matching elements in order", [this, MakeBigArray, IsEven]() {
+			const TArray<int32> SourceArray = MakeBigArray();
+			const TArray<int32> Result = OUU::Runtime::ArrayUtils::ParallelFilter(SourceArray, IsEven, 0);
+			SPEC_TEST_ARRAYS_EQUAL(Result, SourceArray.FilterByPredicate(IsEven));
+		});
+
+		It("ParallelCompact should remove non-matching elements in place", [this, MakeBigArray, IsEven]() {
+			TArray<int32> Array = MakeBigArray();
+			const TArray<int32> Expected = Array.FilterByPredicate(IsEven);
+			const int32* DataBefore = Array.GetData();
+			const int32 NumKept = OUU::Runtime::ArrayUtils::ParallelCompact(Array, IsEven, 0);
+			SPEC_TEST_EQUAL(NumKept, Expected.Num());
+			SPEC_TEST_ARRAYS_EQUAL(Array, Expected);
+			SPEC_TEST_TRUE(Array.GetData() == DataBefore);
+		});
+
+		It("ParallelStablePartition should move matching elements to the front and preserve relative order",
+		   [this, MakeBigArray, IsEven]() {
+			   TArray<int32> Array = MakeBigArray();
+			   TArray<int32> Expected = Array.FilterByPredicate(IsEven);
+			   const int32 ExpectedNumMatches = Expected.Num();
+			   Expected.Append(Array.FilterByPredicate([&](int32 Value) { return !IsEven(Value); }));
+
+			   const int32 NumMatches = OUU::Runtime::ArrayUtils::ParallelStablePartition(Array, IsEven, 0);
+			   SPEC_TEST_EQUAL(NumMatches, ExpectedNumMatches);
+			   SPEC_TEST_ARRAYS_EQUAL(Array, Expected);
+		   });
+
+		It("ParallelReduce should produce the same sum as a sequential loop", [this, MakeBigArray]() {
+			const TArray<int32> SourceArray = MakeBigArray();
+			int64 Expected = 0;
+			for (const int32 Value : SourceArray)
+			{
+				Expected += Value;
+			}
+
+			const int64 Result = OUU::Runtime::ArrayUtils::ParallelReduce(
+				SourceArray,
+				static_cast<int64>(0),
+				[](int64 A, int64 B) { return A + B; },
+				0);
+			SPEC_TEST_EQUAL(Result, Expected);
+		});
+
+		It("ParallelMin/MaxElementIndex should return the first smallest/biggest element", [this]() {
+			TArray<int32> Array;
+			Array.Init(5, NumBigArrayElements);
+			Array[70000] = 1;
+			Array[80000] = 1;
+			Array[20000] = 9;
+			Array[90000] = 9;
+
+			SPEC_TEST_EQUAL(OUU::Runtime::ArrayUtils::ParallelMinElementIndex(Array, TLess<>(), 0), 70000);
+			SPEC_TEST_EQUAL(OUU::Runtime::ArrayUtils::ParallelMaxElementIndex(Array, TLess<>(), 0), 20000);
+		});
+
+		It("ParallelMinElementIndex should return INDEX_NONE for empty arrays", [this]() {
+			const TArray<int32> Array;
+			SPEC_TEST_EQUAL(OUU::Runtime::ArrayUtils::ParallelMinElementIndex(Array), static_cast<int32>(INDEX_NONE));
+		});
+	});
 }
 
 #endif
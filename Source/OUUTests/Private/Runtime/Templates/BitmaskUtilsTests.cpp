@@ -401,6 +401,113 @@ OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(Natural_TestAnyBits_AllWrong, DEFAULT_OUU_T
 	return true;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// TEnumBitset
+//////////////////////////////////////////////////////////////////////////
+
+// Natural enum with more cases than fit into a single 64bit integer
+enum class EWideTestEnum : uint8
+{
+	First = 0,
+	Second = 1,
+	LastInFirstWord = 63,
+	FirstInSecondWord = 64,
+	Last = 129,
+	MAX = 130
+};
+
+using FWideTestBitset = TEnumBitset<EWideTestEnum>;
+
+static_assert(FWideTestBitset::NumWords == 3, "TEnumBitset is sized from the MAX case of the enum");
+static_assert(
+	FWideTestBitset{EWideTestEnum::Second, EWideTestEnum::FirstInSecondWord}.Contains(
+		EWideTestEnum::FirstInSecondWord),
+	"TEnumBitset operations are constexpr");
+static_assert(FWideTestBitset::All().Num() == 130, "All() only sets bits for valid enum values");
+static_assert((~FWideTestBitset{EWideTestEnum::Last}).Num() == 129, "operator~ only sets bits for valid enum values");
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(EnumBitset_AddRemoveContains, DEFAULT_OUU_TEST_FLAGS)
+{
+	FWideTestBitset Bitset;
+	TestTrue("IsEmpty after construction", Bitset.IsEmpty());
+
+	Bitset.Add(EWideTestEnum::LastInFirstWord);
+	Bitset.Add(EWideTestEnum::Last);
+	TestTrue("Contains LastInFirstWord", Bitset.Contains(EWideTestEnum::LastInFirstWord));
+	TestTrue("Contains Last", Bitset.Contains(EWideTestEnum::Last));
+	TestFalse("Contains FirstInSecondWord", Bitset.Contains(EWideTestEnum::FirstInSecondWord));
+	TestEqual("Num", Bitset.Num(), 2);
+
+	Bitset.Remove(EWideTestEnum::LastInFirstWord);
+	TestFalse("Contains LastInFirstWord after removal", Bitset.Contains(EWideTestEnum::LastInFirstWord));
+	TestEqual("Num after removal", Bitset.Num(), 1);
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(EnumBitset_Iteration, DEFAULT_OUU_TEST_FLAGS)
+{
+	const FWideTestBitset Bitset{
+		EWideTestEnum::Last,
+		EWideTestEnum::First,
+		EWideTestEnum::FirstInSecondWord,
+		EWideTestEnum::LastInFirstWord};
+
+	TArray<EWideTestEnum> IteratedValues;
+	for (const EWideTestEnum Value : Bitset)
+	{
+		IteratedValues.Add(Value);
+	}
+
+	const TArray<EWideTestEnum> ExpectedValues = {
+		EWideTestEnum::First,
+		EWideTestEnum::LastInFirstWord,
+		EWideTestEnum::FirstInSecondWord,
+		EWideTestEnum::Last};
+	TestTrue("Iteration visits set members in ascending order", IteratedValues == ExpectedValues);
+	TestEqual("FindFirstIndex", Bitset.FindFirstIndex(), 0);
+	TestEqual("FindFirstIndex of empty set", FWideTestBitset().FindFirstIndex(), static_cast<int32>(INDEX_NONE));
+
+	const FWideTestBitset EmptyBitset;
+	TestTrue("Empty set has no members to iterate", EmptyBitset.begin() == EmptyBitset.end());
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(EnumBitset_SetOperations, DEFAULT_OUU_TEST_FLAGS)
+{
+	const FWideTestBitset A{EWideTestEnum::First, EWideTestEnum::FirstInSecondWord, EWideTestEnum::Last};
+	const FWideTestBitset B{EWideTestEnum::Second, EWideTestEnum::Last};
+
+	TestTrue(
+		"Union",
+		(A | B)
+			== FWideTestBitset{
+				EWideTestEnum::First,
+				EWideTestEnum::Second,
+				EWideTestEnum::FirstInSecondWord,
+				EWideTestEnum::Last});
+	TestTrue("Intersection", (A & B) == FWideTestBitset{EWideTestEnum::Last});
+	TestTrue("Difference", (A - B) == (FWideTestBitset{EWideTestEnum::First, EWideTestEnum::FirstInSecondWord}));
+	TestTrue("ContainsAny", A.ContainsAny(B));
+	TestFalse("ContainsAll", A.ContainsAll(B));
+	TestTrue("ContainsAll of intersection", A.ContainsAll(A & B));
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(EnumBitset_GetTypeHash, DEFAULT_OUU_TEST_FLAGS)
+{
+	TMap<FWideTestBitset, int32> QueryResults;
+	QueryResults.Add(FWideTestBitset{EWideTestEnum::First, EWideTestEnum::Last}, 1);
+	QueryResults.Add(FWideTestBitset{EWideTestEnum::First}, 2);
+
+	const int32* Result = QueryResults.Find(FWideTestBitset{EWideTestEnum::Last, EWideTestEnum::First});
+	TestTrue("Equal bitsets are found in map", Result != nullptr && *Result == 1);
+	TestEqual(
+		"Hash of equal bitsets",
+		GetTypeHash(FWideTestBitset{EWideTestEnum::Last}),
+		GetTypeHash(FWideTestBitset{EWideTestEnum::Last}));
+	return true;
+}
+
 //////////////////////////////////////////////////////////////////////////
 
 	#undef OUU_TEST_CATEGORY
@@ -0,0 +1,96 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Templates/CircularQuantileAggregator.h"
+
+BEGIN_DEFINE_SPEC(
+	FCircularQuantileAggregatorSpec,
+	"OpenUnrealUtilities.Runtime.Templates.CircularQuantileAggregator",
+	DEFAULT_OUU_TEST_FLAGS)
+	bool TestRelativeError(const FString& What, float Actual, float Expected, double MaxRelativeError)
+	{
+		const bool bResult = FMath::Abs(Actual - Expected) <= FMath::Abs(Expected) * MaxRelativeError;
+		if (!bResult)
+		{
+			AddError(FString::Printf(
+				TEXT("%s: Expected %f to be within %f%% of %f"),
+				*What,
+				Actual,
+				MaxRelativeError * 100.0,
+				Expected));
+		}
+		return bResult;
+	}
+END_DEFINE_SPEC(FCircularQuantileAggregatorSpec)
+
+void FCircularQuantileAggregatorSpec::Define()
+{
+	Describe("GetQuantile", [this]() {
+		It("should return 0 when freshly constructed", [this]() {
+			const TCircularQuantileAggregator<float> TestAggregator(100, 0.1f, 1000.f);
+			SPEC_TEST_EQUAL(TestAggregator.GetQuantile(0.5), 0.f);
+		});
+
+		It("should return p50, p95 and p99 within the error bounds for the sequence 1..1000", [this]() {
+			TCircularQuantileAggregator<float> TestAggregator(1000, 0.1f, 10000.f);
+			for (int32 i = 1; i <= 1000; i++)
+			{
+				TestAggregator.Add(static_cast<float>(i));
+			}
+			const double MaxError = TestAggregator.GetHistogram().GetMaxRelativeError();
+			TestRelativeError("p50", TestAggregator.GetQuantile(0.5), 500.f, MaxError);
+			TestRelativeError("p95", TestAggregator.GetQuantile(0.95), 950.f, MaxError);
+			TestRelativeError("p99", TestAggregator.GetQuantile(0.99), 990.f, MaxError);
+		});
+
+		It("should clamp values outside of the tracked range to min and max value", [this]() {
+			TCircularQuantileAggregator<float> TestAggregator(10, 1.f, 100.f);
+			TestAggregator.Add(0.f);
+			TestAggregator.Add(5000.f);
+			SPEC_TEST_EQUAL(TestAggregator.GetQuantile(0.0), 1.f);
+			SPEC_TEST_EQUAL(TestAggregator.GetQuantile(1.0), 100.f);
+		});
+	});
+
+	Describe("Add", [this]() {
+		It("should evict values that left the window from the histogram", [this]() {
+			TCircularQuantileAggregator<float> TestAggregator(3, 0.1f, 1000.f);
+			TestAggregator.Add(500.f);
+			TestAggregator.Add(500.f);
+			TestAggregator.Add(500.f);
+			TestAggregator.Add(1.f);
+			TestAggregator.Add(1.f);
+			TestAggregator.Add(1.f);
+
+			SPEC_TEST_EQUAL(TestAggregator.Num(), 3);
+			SPEC_TEST_EQUAL(TestAggregator.GetHistogram().GetTotalCount(), static_cast<int64>(3));
+			const double MaxError = TestAggregator.GetHistogram().GetMaxRelativeError();
+			TestRelativeError("max", TestAggregator.GetQuantile(1.0), 1.f, MaxError);
+		});
+	});
+
+	Describe("TLogHistogram::Merge", [this]() {
+		It("should combine the samples of two histograms with the same layout", [this]() {
+			TCircularQuantileAggregator<float> AggregatorA(100, 0.1f, 1000.f);
+			TCircularQuantileAggregator<float> AggregatorB(100, 0.1f, 1000.f);
+			for (int32 i = 0; i < 50; i++)
+			{
+				AggregatorA.Add(10.f);
+				AggregatorB.Add(100.f);
+			}
+
+			TLogHistogram<float> Merged = AggregatorA.GetHistogram();
+			Merged.Merge(AggregatorB.GetHistogram());
+
+			SPEC_TEST_EQUAL(Merged.GetTotalCount(), static_cast<int64>(100));
+			const double MaxError = Merged.GetMaxRelativeError();
+			TestRelativeError("p25", Merged.GetQuantile(0.25), 10.f, MaxError);
+			TestRelativeError("p75", Merged.GetQuantile(0.75), 100.f, MaxError);
+		});
+	});
+}
+
+#endif
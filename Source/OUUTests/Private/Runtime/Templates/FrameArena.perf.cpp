@@ -0,0 +1,72 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Templates/FrameArena.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  FrameArena
+
+namespace OUU::Tests::FrameArenaBenchmark
+{
+	constexpr int32 NumIterations = 100000;
+	constexpr int32 NumElementsPerArray = 64;
+
+	/** Typical per-frame scratch usage: Build a few short-lived arrays, sort one of them and sum the results. */
+	template <typename ArrayType>
+	int64 RunScratchWorkload(int32 Iteration)
+	{
+		ArrayType Values;
+		ArrayType Indices;
+		for (int32 i = 0; i < NumElementsPerArray; i++)
+		{
+			Values.Add((Iteration * 7919 + i * 104729) % 1000);
+			Indices.Add(i);
+		}
+		Indices.Sort([&](int32 A, int32 B) { return Values[A] < Values[B]; });
+		return Values[Indices[0]] + Values[Indices.Last()];
+	}
+} // namespace OUU::Tests::FrameArenaBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(ScratchArrays, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::FrameArenaBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime;
+
+	int64 HeapSum = 0;
+	RunAndReportBenchmark(*this, TEXT("TArray (heap)"), NumIterations, [&]() {
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			HeapSum += RunScratchWorkload<TArray<int32>>(Iteration);
+		}
+	});
+
+	int64 InlineSum = 0;
+	RunAndReportBenchmark(*this, TEXT("TArray (inline allocator)"), NumIterations, [&]() {
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			InlineSum += RunScratchWorkload<TArray<int32, TInlineAllocator<NumElementsPerArray>>>(Iteration);
+		}
+	});
+
+	int64 ArenaSum = 0;
+	RunAndReportBenchmark(*this, TEXT("TFrameArenaArray"), NumIterations, [&]() {
+		for (int32 Iteration = 0; Iteration < NumIterations; Iteration++)
+		{
+			FScopedFrameArenaMark Mark;
+			ArenaSum += RunScratchWorkload<TFrameArenaArray<int32>>(Iteration);
+		}
+	});
+
+	TestEqual(TEXT("Inline allocator result"), InlineSum, HeapSum);
+	TestEqual(TEXT("Frame arena result"), ArenaSum, HeapSum);
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,254 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Async/Async.h"
+	#include "Templates/FrameArena.h"
+
+BEGIN_DEFINE_SPEC(FFrameArenaSpec, "OpenUnrealUtilities.Runtime.Templates.FrameArena", DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FFrameArenaSpec)
+
+void FFrameArenaSpec::Define()
+{
+	using namespace OUU::Runtime;
+
+	Describe("Allocate", [this]() {
+		It("should return aligned, non-overlapping memory", [this]() {
+			FFrameArena Arena;
+			uint8* A = static_cast<uint8*>(Arena.Allocate(3, 1));
+			uint8* B = static_cast<uint8*>(Arena.Allocate(16, 64));
+			uint8* C = static_cast<uint8*>(Arena.Allocate(8, 8));
+
+			SPEC_TEST_TRUE(IsAligned(B, 64));
+			SPEC_TEST_TRUE(IsAligned(C, 8));
+			SPEC_TEST_TRUE(B >= A + 3);
+			SPEC_TEST_TRUE(C >= B + 16);
+		});
+
+		It("should serve allocations larger than the block size", [this]() {
+			FFrameArena Arena;
+			const SIZE_T LargeSize = 4 * 1024 * 1024;
+			uint8* Large = static_cast<uint8*>(Arena.Allocate(LargeSize));
+			FMemory::Memset(Large, 1, LargeSize);
+			SPEC_TEST_TRUE(Arena.GetNumBytesInUse() >= LargeSize);
+		});
+
+		It("should grow the most recent allocation in place", [this]() {
+			FFrameArena Arena;
+			void* Ptr = Arena.Allocate(64);
+			SPEC_TEST_TRUE(Arena.Reallocate(Ptr, 64, 64, 256, FFrameArena::DefaultAlignment) == Ptr);
+
+			Arena.Allocate(16);
+			SPEC_TEST_TRUE(Arena.Reallocate(Ptr, 256, 256, 512, FFrameArena::DefaultAlignment) != Ptr);
+		});
+
+		It("should give back the most recent allocation on Free", [this]() {
+			FFrameArena Arena;
+			Arena.Allocate(32);
+			const SIZE_T NumBytesBefore = Arena.GetNumBytesInUse();
+			void* Ptr = Arena.Allocate(100, 4);
+			Arena.Free(Ptr, 100);
+			SPEC_TEST_EQUAL(Arena.GetNumBytesInUse(), NumBytesBefore);
+		});
+	});
+
+	Describe("Reset", [this]() {
+		It("should reuse the same memory after a reset", [this]() {
+			FFrameArena Arena;
+			void* First = Arena.Allocate(128);
+			Arena.Reset();
+			SPEC_TEST_TRUE(Arena.Allocate(128) == First);
+			SPEC_TEST_EQUAL(Arena.GetStats().LastFrameBytes, static_cast<SIZE_T>(128));
+		});
+
+		It("should include memory that was freed or shrunk before the reset in the stats", [this]() {
+			FFrameArena Arena;
+			void* Ptr = Arena.Allocate(1000);
+			Arena.Free(Ptr, 1000);
+			Arena.Reset();
+			SPEC_TEST_EQUAL(Arena.GetStats().LastFrameBytes, static_cast<SIZE_T>(1000));
+
+			Ptr = Arena.Allocate(2000);
+			Arena.Reallocate(Ptr, 2000, 2000, 10, FFrameArena::DefaultAlignment);
+			Arena.Reset();
+			SPEC_TEST_EQUAL(Arena.GetStats().LastFrameBytes, static_cast<SIZE_T>(2000));
+			SPEC_TEST_EQUAL(Arena.GetStats().HighWaterMarkBytes, static_cast<SIZE_T>(2000));
+		});
+
+		It("should size the consolidated block for freed overflow allocations", [this]() {
+			FFrameArena Arena;
+			Arena.Allocate(16);
+			void* Large = Arena.Allocate(1024 * 1024);
+			Arena.Free(Large, 1024 * 1024);
+			Arena.Reset();
+
+			const FFrameArenaStats Stats = Arena.GetStats();
+			SPEC_TEST_TRUE(Stats.LastFrameBytes >= static_cast<SIZE_T>(1024 * 1024));
+			SPEC_TEST_EQUAL(Stats.NumOverflowFrames, static_cast<uint64>(1));
+			SPEC_TEST_TRUE(Stats.ReservedBytes >= Stats.LastFrameBytes);
+		});
+
+		It("should track the high water mark and consolidate blocks after an overflow frame", [this]() {
+			FFrameArena Arena;
+			for (int32 i = 0; i < 64; i++)
+			{
+				Arena.Allocate(16 * 1024);
+			}
+			Arena.Reset();
+			Arena.Allocate(16);
+			Arena.Reset();
+
+			const FFrameArenaStats Stats = Arena.GetStats();
+			SPEC_TEST_EQUAL(Stats.LastFrameBytes, static_cast<SIZE_T>(16));
+			SPEC_TEST_EQUAL(Stats.HighWaterMarkBytes, static_cast<SIZE_T>(64 * 16 * 1024));
+			SPEC_TEST_EQUAL(Stats.NumOverflowFrames, static_cast<uint64>(1));
+			SPEC_TEST_TRUE(Stats.ReservedBytes >= Stats.HighWaterMarkBytes);
+		});
+
+		It("should report the stats of all thread arenas", [this]() {
+			FFrameArena Arena;
+			const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+			const TArray<FFrameArenaStats> AllStats = FFrameArena::GetAllThreadStats();
+			SPEC_TEST_TRUE(AllStats.ContainsByPredicate([&](const FFrameArenaStats& Stats) {
+				return Stats.ThreadId == ThreadId;
+			}));
+		});
+	});
+
+	Describe("FScopedFrameArenaMark", [this]() {
+		It("should rewind the arena when going out of scope", [this]() {
+			FFrameArena& Arena = FFrameArena::Get();
+			FScopedFrameArenaMark OuterMark;
+			const SIZE_T NumBytesBefore = Arena.GetNumBytesInUse();
+			{
+				FScopedFrameArenaMark Mark;
+				Arena.Allocate(1000);
+				{
+					FScopedFrameArenaMark NestedMark;
+					Arena.Allocate(1024 * 1024);
+				}
+				SPEC_TEST_TRUE(Arena.GetNumBytesInUse() >= NumBytesBefore + 1000);
+				SPEC_TEST_TRUE(Arena.GetNumBytesInUse() < NumBytesBefore + 1024 * 1024);
+			}
+			SPEC_TEST_EQUAL(Arena.GetNumBytesInUse(), NumBytesBefore);
+		});
+
+		It("should keep worker thread allocations alive across the end of a game thread frame", [this]() {
+			std::atomic<int32> Stage{0};
+			auto Worker = Async(EAsyncExecution::Thread, [&Stage]() {
+				FFrameArena& Arena = FFrameArena::Get();
+				FScopedFrameArenaMark Mark;
+				uint8* First = static_cast<uint8*>(Arena.Allocate(64));
+				FMemory::Memset(First, 0x42, 64);
+
+				Stage = 1;
+				while (Stage != 2)
+				{
+					FPlatformProcess::Yield();
+				}
+
+				uint8* Second = static_cast<uint8*>(Arena.Allocate(64));
+				return First[0] == 0x42 && First[63] == 0x42 && Second >= First + 64;
+			});
+
+			while (Stage != 1)
+			{
+				FPlatformProcess::Yield();
+			}
+			FFrameArena::EndFrame();
+			Stage = 2;
+
+			SPEC_TEST_TRUE(Worker.Get());
+		});
+
+		It("should rewind worker thread arenas when the outermost mark is popped", [this]() {
+			auto Worker = Async(EAsyncExecution::Thread, []() {
+				FFrameArena& Arena = FFrameArena::Get();
+				{
+					FScopedFrameArenaMark Mark;
+					Arena.Allocate(1000);
+				}
+				return TPair<SIZE_T, SIZE_T>(Arena.GetNumBytesInUse(), Arena.GetStats().LastFrameBytes);
+			});
+
+			const TPair<SIZE_T, SIZE_T> Result = Worker.Get();
+			SPEC_TEST_EQUAL(Result.Key, static_cast<SIZE_T>(0));
+			SPEC_TEST_TRUE(Result.Value >= static_cast<SIZE_T>(1000));
+		});
+
+	#if OUU_FRAME_ARENA_POISONING
+		It("should poison memory that was given back", [this]() {
+			uint8* Ptr = nullptr;
+			{
+				FScopedFrameArenaMark Mark;
+				Ptr = static_cast<uint8*>(FFrameArena::Get().Allocate(16));
+				FMemory::Memzero(Ptr, 16);
+			}
+			SPEC_TEST_TRUE(Ptr[0] == 0xDD);
+			SPEC_TEST_TRUE(Ptr[15] == 0xDD);
+		});
+	#endif
+	});
+
+	Describe("TFrameArenaArray", [this]() {
+		It("should behave like a regular array", [this]() {
+			FScopedFrameArenaMark Mark;
+			TFrameArenaArray<FString> Strings;
+			for (int32 i = 0; i < 100; i++)
+			{
+				Strings.Add(LexToString(i));
+			}
+			Strings.RemoveAt(0);
+			TFrameArenaArray<FString> Moved = MoveTemp(Strings);
+
+			SPEC_TEST_EQUAL(Moved.Num(), 99);
+			SPEC_TEST_EQUAL(Moved[0], FString(TEXT("1")));
+			SPEC_TEST_EQUAL(Moved.Last(), FString(TEXT("99")));
+			SPEC_TEST_EQUAL(Strings.Num(), 0);
+		});
+
+		It("should respect the alignment of the element type", [this]() {
+			struct alignas(64) FAlignedElement
+			{
+				uint8 Value;
+			};
+
+			FScopedFrameArenaMark Mark;
+			FFrameArena::Get().Allocate(1, 1);
+			TFrameArenaArray<FAlignedElement> Elements;
+			Elements.AddDefaulted(3);
+			SPEC_TEST_TRUE(IsAligned(Elements.GetData(), 64));
+		});
+
+		It("should not allocate from the heap once the arena is warmed up", [this]() {
+			if (OUU::TestUtilities::FScopedAllocationCounter::IsAvailable() == false)
+			{
+				AddInfo(TEXT("Skipped: Counting allocations requires -OUUCountAllocations"));
+				return;
+			}
+
+			{
+				FScopedFrameArenaMark WarmUpMark;
+				FFrameArena::Get().Allocate(32 * 1024);
+			}
+
+			FScopedFrameArenaMark Mark;
+			OUU::TestUtilities::FScopedAllocationCounter AllocationCounter;
+			TFrameArenaArray<int32> Values;
+			for (int32 i = 0; i < 1000; i++)
+			{
+				Values.Add(i);
+			}
+			TMap<int32, int32, FFrameArenaSetAllocator> Map;
+			for (int32 i = 0; i < 100; i++)
+			{
+				Map.Add(i, i);
+			}
+			SPEC_TEST_EQUAL(AllocationCounter.GetNumAllocations(), static_cast<int64>(0));
+		});
+	});
+}
+
+#endif
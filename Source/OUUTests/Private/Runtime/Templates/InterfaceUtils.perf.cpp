@@ -0,0 +1,101 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Runtime/Templates/InterfaceUtilsTests_Implementations.h"
+	#include "Templates/InterfaceUtils.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  InterfaceUtils
+
+namespace OUU::Tests::InterfaceUtilsBenchmark
+{
+	constexpr int32 NumObjects = 256;
+	constexpr int32 NumPasses = 4000;
+
+	/** Objects of the most derived test class, so every uncached lookup walks the complete hierarchy. */
+	TArray<UObject*> CreateDeepHierarchyObjects()
+	{
+		TArray<UObject*> Objects;
+		for (int32 i = 0; i < NumObjects; i++)
+		{
+			Objects.Add(NewObject<UInterfaceUtilsTests_CppInterface_DeepImpl_8>());
+		}
+		return Objects;
+	}
+
+	template <typename PredicateType>
+	int32 CountMatches(const TArray<UObject*>& Objects, PredicateType&& Predicate)
+	{
+		int32 NumMatches = 0;
+		for (int32 Pass = 0; Pass < NumPasses; Pass++)
+		{
+			for (UObject* Object : Objects)
+			{
+				NumMatches += Predicate(Object) ? 1 : 0;
+			}
+		}
+		return NumMatches;
+	}
+} // namespace OUU::Tests::InterfaceUtilsBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(DeepHierarchy, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::InterfaceUtilsBenchmark;
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Runtime::InterfaceUtils;
+
+	const TArray<UObject*> Objects = CreateDeepHierarchyObjects();
+	constexpr int64 NumLookups = static_cast<int64>(NumObjects) * NumPasses;
+	int32 NumMatches = 0;
+
+	const UClass* CppInterface = UInterfaceUtilsTests_CppInterface::StaticClass();
+	const UClass* BpInterface = UInterfaceUtilsTests_BpInterface::StaticClass();
+
+	// Implemented interface
+	RunAndReportBenchmark(*this, TEXT("UClass::ImplementsInterface (implemented)"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return Object->GetClass()->ImplementsInterface(CppInterface);
+		});
+	});
+	RunAndReportBenchmark(*this, TEXT("InterfaceUtils::ImplementsInterface (implemented)"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return ImplementsInterface(Object->GetClass(), CppInterface);
+		});
+	});
+
+	// Interface that is not implemented
+	RunAndReportBenchmark(*this, TEXT("UClass::ImplementsInterface (not implemented)"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return Object->GetClass()->ImplementsInterface(BpInterface);
+		});
+	});
+	RunAndReportBenchmark(*this, TEXT("InterfaceUtils::ImplementsInterface (not implemented)"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return ImplementsInterface(Object->GetClass(), BpInterface);
+		});
+	});
+
+	// Casts to the native interface pointer
+	RunAndReportBenchmark(*this, TEXT("Cast<IInterface>"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return Cast<IInterfaceUtilsTests_CppInterface>(Object) != nullptr;
+		});
+	});
+	RunAndReportBenchmark(*this, TEXT("InterfaceUtils::CastToInterface<IInterface>"), NumLookups, [&]() {
+		NumMatches += CountMatches(Objects, [&](UObject* Object) {
+			return CastToInterface<IInterfaceUtilsTests_CppInterface>(Object) != nullptr;
+		});
+	});
+
+	// Every object implements the C++ interface and none the BP interface: 4 of the 6 runs match.
+	TestEqual(TEXT("NumMatches"), NumMatches, static_cast<int32>(NumLookups * 4));
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
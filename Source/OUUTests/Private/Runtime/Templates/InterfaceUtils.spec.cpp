@@ -133,6 +133,120 @@ void FInterfaceUtilsSpec::Define()
 		});
 	});
 
+	Describe("FInterfaceImplementationCache", [this]() {
+		using namespace OUU::Runtime::InterfaceUtils;
+
+		It("should report native implementations with the same interface address as Cast", [this]() {
+			UObject* Object = NewObject<UInterfaceUtilsTests_CppInterface_DeepImpl_8>();
+
+			const auto Implementation = FInterfaceImplementationCache::Find(
+				Object->GetClass(),
+				UInterfaceUtilsTests_CppInterface::StaticClass());
+
+			SPEC_TEST_TRUE(Implementation.Type == EInterfaceImplementation::Native);
+			SPEC_TEST_EQUAL(
+				CastToInterface<IInterfaceUtilsTests_CppInterface>(Object),
+				Cast<IInterfaceUtilsTests_CppInterface>(Object));
+			SPEC_TEST_EQUAL(
+				CastToInterface<IInterfaceUtilsTests_BpInterface>(Object),
+				static_cast<IInterfaceUtilsTests_BpInterface*>(nullptr));
+		});
+
+		It("should use the most derived native implementation like Cast", [this]() {
+			auto* Object = NewObject<UInterfaceUtilsTests_CppSubInterface_Impl>();
+			IInterfaceUtilsTests_CppInterface* DerivedInterface =
+				static_cast<IInterfaceUtilsTests_CppSubInterface*>(Object);
+			IInterfaceUtilsTests_CppInterface* BaseInterface =
+				static_cast<UInterfaceUtilsTests_CppInterface_Impl*>(Object);
+
+			SPEC_TEST_EQUAL(Cast<IInterfaceUtilsTests_CppInterface>(Object), DerivedInterface);
+			SPEC_TEST_EQUAL(CastToInterface<IInterfaceUtilsTests_CppInterface>(Object), DerivedInterface);
+			SPEC_TEST_NOT_EQUAL(CastToInterface<IInterfaceUtilsTests_CppInterface>(Object), BaseInterface);
+		});
+
+		It("should report classes that don't implement the interface", [this]() {
+			const auto Implementation = FInterfaceImplementationCache::Find(
+				UInterfaceUtilsTests_CppInterface_DeepImpl_8::StaticClass(),
+				UInterfaceUtilsTests_BpInterface::StaticClass());
+
+			SPEC_TEST_TRUE(Implementation.Type == EInterfaceImplementation::None);
+			SPEC_TEST_FALSE(Implementation.IsImplemented());
+		});
+
+		It("should report Blueprint implementations of hybrid interfaces", [this]() {
+			const UClass* BlueprintClass = StaticLoadClass(
+				UObject::StaticClass(),
+				nullptr,
+				TEXT("/OpenUnrealUtilities/Editor/Tests/BP_BpInterface_BpImpl.BP_BpInterface_BpImpl_C"),
+				nullptr,
+				LOAD_None,
+				nullptr);
+			UObject* Object = NewObject<UObject>(GetTransientPackage(), BlueprintClass);
+
+			const auto Implementation =
+				FInterfaceImplementationCache::Find(BlueprintClass, UInterfaceUtilsTests_BpInterface::StaticClass());
+
+			SPEC_TEST_TRUE(Implementation.Type == EInterfaceImplementation::Blueprint);
+			SPEC_TEST_TRUE(ImplementsInterface<IInterfaceUtilsTests_BpInterface>(BlueprintClass));
+			SPEC_TEST_FALSE(ImplementsInterfaceNatively<IInterfaceUtilsTests_BpInterface>(BlueprintClass));
+			SPEC_TEST_EQUAL(
+				CastToInterface<IInterfaceUtilsTests_BpInterface>(Object),
+				Cast<IInterfaceUtilsTests_BpInterface>(Object));
+		});
+
+		It("should return the same results as the uncached lookup", [this]() {
+			const UClass* Classes[] = {
+				UObject::StaticClass(),
+				UInterfaceUtilsTests_CppInterface_Impl::StaticClass(),
+				UInterfaceUtilsTests_BpInterface_CppImpl::StaticClass(),
+				UInterfaceUtilsTests_CppInterface_DeepImpl_4::StaticClass()};
+			const UClass* Interfaces[] = {
+				UInterfaceUtilsTests_CppInterface::StaticClass(),
+				UInterfaceUtilsTests_BpInterface::StaticClass(),
+				UInterface::StaticClass()};
+
+			for (const UClass* Class : Classes)
+			{
+				for (const UClass* Interface : Interfaces)
+				{
+					const auto Cached = FInterfaceImplementationCache::Find(Class, Interface);
+					const auto Uncached = FInterfaceImplementationCache::FindUncached(Class, Interface);
+					SPEC_TEST_TRUE(Cached.Type == Uncached.Type);
+					SPEC_TEST_EQUAL(Cached.NativePointerOffset, Uncached.NativePointerOffset);
+					SPEC_TEST_EQUAL(Cached.IsImplemented(), Class->ImplementsInterface(Interface));
+				}
+			}
+		});
+
+		It("should drop all entries when invalidated", [this]() {
+			FInterfaceImplementationCache::Find(
+				UInterfaceUtilsTests_CppInterface_Impl::StaticClass(),
+				UInterfaceUtilsTests_CppInterface::StaticClass());
+			SPEC_TEST_TRUE(FInterfaceImplementationCache::GetNumCachedEntries() > 0);
+
+			FInterfaceImplementationCache::Invalidate();
+			SPEC_TEST_EQUAL(FInterfaceImplementationCache::GetNumCachedEntries(), 0);
+		});
+
+		It("should keep entries of loaded classes when removing unloaded classes", [this]() {
+			FInterfaceImplementationCache::Invalidate();
+			FInterfaceImplementationCache::Find(
+				UInterfaceUtilsTests_CppInterface_Impl::StaticClass(),
+				UInterfaceUtilsTests_CppInterface::StaticClass());
+
+			FInterfaceImplementationCache::RemoveUnloadedClasses();
+			SPEC_TEST_EQUAL(FInterfaceImplementationCache::GetNumCachedEntries(), 1);
+		});
+
+		It("should be used by IsValidInterface", [this]() {
+			FInterfaceImplementationCache::Invalidate();
+			const UObject* Object = NewObject<UInterfaceUtilsTests_CppInterface_DeepImpl_2>();
+
+			SPEC_TEST_TRUE(IsValidInterface<IInterfaceUtilsTests_CppInterface>(Object));
+			SPEC_TEST_TRUE(FInterfaceImplementationCache::GetNumCachedEntries() > 0);
+		});
+	});
+
 	Describe("CALL_INTERFACE", [this]() {
 		It("should call a C++ implementation of a hybrid interface", [this]() {
 			TargetObject = NewObject<UInterfaceUtilsTests_BpInterface_CppImpl>();
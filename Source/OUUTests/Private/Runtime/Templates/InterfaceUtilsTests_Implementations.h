@@ -23,6 +23,19 @@ public:
 	float GetNumber() const override { return Number; }
 };
 
+// Implements IInterfaceUtilsTests_CppInterface in the base class and again via the sub-interface, so the hierarchy
+// contains two native interface subobjects with different offsets.
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppSubInterface_Impl :
+	public UInterfaceUtilsTests_CppInterface_Impl,
+	public IInterfaceUtilsTests_CppSubInterface
+{
+	GENERATED_BODY()
+public:
+	void SetNumber(float f) override { Number = f; }
+	float GetNumber() const override { return Number; }
+};
+
 // -------------------------
 // -- Blueprint Interface --
 // -------------------------
@@ -38,3 +51,58 @@ public:
 	void SetNumber_Implementation(float f) override { Number = f; }
 	float GetNumber_Implementation() const override { return Number; }
 };
+
+// --------------------
+// -- Deep Hierarchy --
+// --------------------
+
+// Class hierarchy with several levels between the implementation of the interface and the most derived class.
+// Used to test and benchmark the interface implementation cache.
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_1 : public UInterfaceUtilsTests_CppInterface_Impl
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_2 : public UInterfaceUtilsTests_CppInterface_DeepImpl_1
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_3 : public UInterfaceUtilsTests_CppInterface_DeepImpl_2
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_4 : public UInterfaceUtilsTests_CppInterface_DeepImpl_3
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_5 : public UInterfaceUtilsTests_CppInterface_DeepImpl_4
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_6 : public UInterfaceUtilsTests_CppInterface_DeepImpl_5
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_7 : public UInterfaceUtilsTests_CppInterface_DeepImpl_6
+{
+	GENERATED_BODY()
+};
+
+UCLASS(meta = (Hidden, HideDropDown))
+class UInterfaceUtilsTests_CppInterface_DeepImpl_8 : public UInterfaceUtilsTests_CppInterface_DeepImpl_7
+{
+	GENERATED_BODY()
+};
@@ -26,6 +26,18 @@ public:
 	virtual float GetNumber() const = 0;
 };
 
+// Extends the C++ only interface, so classes can implement IInterfaceUtilsTests_CppInterface a second time
+UINTERFACE(meta = (CannotImplementInterfaceInBlueprint))
+class UInterfaceUtilsTests_CppSubInterface : public UInterfaceUtilsTests_CppInterface
+{
+	GENERATED_BODY()
+};
+
+class IInterfaceUtilsTests_CppSubInterface : public IInterfaceUtilsTests_CppInterface
+{
+	GENERATED_BODY()
+};
+
 // -------------------------
 // -- Blueprint Interface --
 // -------------------------
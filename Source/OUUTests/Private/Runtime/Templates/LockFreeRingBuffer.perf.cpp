@@ -0,0 +1,251 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Async/Async.h"
+	#include "Containers/CircularQueue.h"
+	#include "Containers/Queue.h"
+	#include "Templates/LockFreeRingBuffer.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  LockFreeRingBuffer
+
+namespace OUU::Tests::LockFreeRingBufferBenchmark
+{
+	constexpr int32 NumElements = 2000000;
+	constexpr uint32 Capacity = 1024;
+
+	/** Transfer NumElements from a producer thread to the calling thread. */
+	template <typename PushFuncType, typename PopFuncType>
+	void RunProducerConsumer(PushFuncType&& PushFunc, PopFuncType&& PopFunc)
+	{
+		auto Producer = Async(EAsyncExecution::Thread, [&PushFunc]() {
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				while (!PushFunc(i))
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+		});
+
+		int32 Value = 0;
+		for (int32 i = 0; i < NumElements; i++)
+		{
+			while (!PopFunc(Value))
+			{
+				FPlatformProcess::Yield();
+			}
+		}
+		Producer.Wait();
+	}
+
+	constexpr int32 NumRoundTrips = 100000;
+
+	/**
+	 * Send NumRoundTrips single items to an echo thread and wait for each reply before sending the next one.
+	 * Measures the per-item latency instead of the throughput, i.e. the time until a consumer sees a pushed element.
+	 */
+	template <typename RequestQueueType, typename ResponseQueueType>
+	void RunPingPong(RequestQueueType& Requests, ResponseQueueType& Responses)
+	{
+		auto Echo = Async(EAsyncExecution::Thread, [&Requests, &Responses]() {
+			int32 Value = 0;
+			for (int32 i = 0; i < NumRoundTrips; i++)
+			{
+				while (!Requests.TryPop(Value)) {}
+				while (!Responses.TryPush(Value)) {}
+			}
+		});
+
+		int32 Value = 0;
+		for (int32 i = 0; i < NumRoundTrips; i++)
+		{
+			while (!Requests.TryPush(i)) {}
+			while (!Responses.TryPop(Value)) {}
+		}
+		Echo.Wait();
+	}
+} // namespace OUU::Tests::LockFreeRingBufferBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(SpscThroughput, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::LockFreeRingBufferBenchmark;
+	using namespace OUU::TestUtilities;
+
+	{
+		TSpscRingBuffer<int32> RingBuffer(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TSpscRingBuffer"), NumElements, [&]() {
+			RunProducerConsumer(
+				[&](int32 Value) { return RingBuffer.TryPush(Value); },
+				[&](int32& Value) { return RingBuffer.TryPop(Value); });
+		});
+	}
+
+	{
+		TSpscRingBuffer<int32> RingBuffer(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TSpscRingBuffer (batches of 64)"), NumElements, [&]() {
+			auto Producer = Async(EAsyncExecution::Thread, [&]() {
+				int32 Batch[64];
+				for (int32 i = 0; i < NumElements;)
+				{
+					const int32 BatchNum = FMath::Min(64, NumElements - i);
+					for (int32 j = 0; j < BatchNum; j++)
+					{
+						Batch[j] = i + j;
+					}
+					const int32 NumPushed = RingBuffer.PushBatch(TArrayView<const int32>(Batch, BatchNum));
+					i += NumPushed;
+					if (NumPushed == 0)
+					{
+						FPlatformProcess::Yield();
+					}
+				}
+			});
+
+			int32 Batch[64];
+			for (int32 i = 0; i < NumElements;)
+			{
+				const int32 NumPopped = RingBuffer.PopBatch(TArrayView<int32>(Batch, 64));
+				i += NumPopped;
+				if (NumPopped == 0)
+				{
+					FPlatformProcess::Yield();
+				}
+			}
+			Producer.Wait();
+		});
+	}
+
+	{
+		TCircularQueue<int32> CircularQueue(Capacity + 1);
+		RunAndReportBenchmark(*this, TEXT("TCircularQueue"), NumElements, [&]() {
+			RunProducerConsumer(
+				[&](int32 Value) { return CircularQueue.Enqueue(Value); },
+				[&](int32& Value) { return CircularQueue.Dequeue(Value); });
+		});
+	}
+
+	{
+		TQueue<int32, EQueueMode::Spsc> Queue;
+		RunAndReportBenchmark(*this, TEXT("TQueue (Spsc)"), NumElements, [&]() {
+			RunProducerConsumer(
+				[&](int32 Value) { return Queue.Enqueue(Value); },
+				[&](int32& Value) { return Queue.Dequeue(Value); });
+		});
+	}
+
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(MpmcThroughput, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::LockFreeRingBufferBenchmark;
+	using namespace OUU::TestUtilities;
+
+	{
+		TMpmcRingBuffer<int32> RingBuffer(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TMpmcRingBuffer (1 producer, 1 consumer)"), NumElements, [&]() {
+			RunProducerConsumer(
+				[&](int32 Value) { return RingBuffer.TryPush(Value); },
+				[&](int32& Value) { return RingBuffer.TryPop(Value); });
+		});
+	}
+
+	{
+		// TQueue has no MPMC mode, so MPSC is the closest comparison
+		TQueue<int32, EQueueMode::Mpsc> Queue;
+		RunAndReportBenchmark(*this, TEXT("TQueue (Mpsc, 1 producer, 1 consumer)"), NumElements, [&]() {
+			RunProducerConsumer(
+				[&](int32 Value) { return Queue.Enqueue(Value); },
+				[&](int32& Value) { return Queue.Dequeue(Value); });
+		});
+	}
+
+	{
+		constexpr int32 NumProducers = 4;
+		TMpmcRingBuffer<int32> RingBuffer(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TMpmcRingBuffer (4 producers, 1 consumer)"), NumElements, [&]() {
+			TArray<TFuture<void>> Producers;
+			for (int32 p = 0; p < NumProducers; p++)
+			{
+				Producers.Add(Async(EAsyncExecution::Thread, [&RingBuffer]() {
+					for (int32 i = 0; i < NumElements / NumProducers; i++)
+					{
+						RingBuffer.Push(i);
+					}
+				}));
+			}
+			int32 Value = 0;
+			for (int32 i = 0; i < (NumElements / NumProducers) * NumProducers; i++)
+			{
+				RingBuffer.Pop(Value);
+			}
+			for (auto& Producer : Producers)
+			{
+				Producer.Wait();
+			}
+		});
+	}
+
+	{
+		constexpr int32 NumProducers = 4;
+		TQueue<int32, EQueueMode::Mpsc> Queue;
+		RunAndReportBenchmark(*this, TEXT("TQueue (Mpsc, 4 producers, 1 consumer)"), NumElements, [&]() {
+			TArray<TFuture<void>> Producers;
+			for (int32 p = 0; p < NumProducers; p++)
+			{
+				Producers.Add(Async(EAsyncExecution::Thread, [&Queue]() {
+					for (int32 i = 0; i < NumElements / NumProducers; i++)
+					{
+						Queue.Enqueue(i);
+					}
+				}));
+			}
+			int32 Value = 0;
+			for (int32 i = 0; i < (NumElements / NumProducers) * NumProducers;)
+			{
+				if (Queue.Dequeue(Value))
+				{
+					i++;
+				}
+			}
+			for (auto& Producer : Producers)
+			{
+				Producer.Wait();
+			}
+		});
+	}
+
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(RoundTripLatency, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::LockFreeRingBufferBenchmark;
+	using namespace OUU::TestUtilities;
+
+	// Busy waiting on both sides, so the results show the cost of publishing a single element, not of waking threads
+	{
+		TSpscRingBuffer<int32> Requests(Capacity), Responses(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TSpscRingBuffer (round trip)"), NumRoundTrips, [&]() {
+			RunPingPong(Requests, Responses);
+		});
+	}
+
+	{
+		TMpmcRingBuffer<int32> Requests(Capacity), Responses(Capacity);
+		RunAndReportBenchmark(*this, TEXT("TMpmcRingBuffer (round trip)"), NumRoundTrips, [&]() {
+			RunPingPong(Requests, Responses);
+		});
+	}
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,200 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Async/Async.h"
+	#include "Templates/LockFreeRingBuffer.h"
+
+BEGIN_DEFINE_SPEC(
+	FLockFreeRingBufferSpec,
+	"OpenUnrealUtilities.Runtime.Templates.LockFreeRingBuffer",
+	DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FLockFreeRingBufferSpec)
+
+void FLockFreeRingBufferSpec::Define()
+{
+	Describe("TSpscRingBuffer", [this]() {
+		It("should round the capacity up to the next power of two", [this]() {
+			const TSpscRingBuffer<int32> RingBuffer(100);
+			SPEC_TEST_EQUAL(RingBuffer.GetCapacity(), static_cast<uint32>(128));
+		});
+
+		It("should return elements in FIFO order", [this]() {
+			TSpscRingBuffer<int32> RingBuffer(4);
+			SPEC_TEST_TRUE(RingBuffer.TryPush(1));
+			SPEC_TEST_TRUE(RingBuffer.TryPush(2));
+			SPEC_TEST_TRUE(RingBuffer.TryPush(3));
+
+			int32 Value = 0;
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 1);
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 2);
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 3);
+			SPEC_TEST_FALSE(RingBuffer.TryPop(Value));
+		});
+
+		It("should reject pushes when full", [this]() {
+			TSpscRingBuffer<int32> RingBuffer(2);
+			SPEC_TEST_TRUE(RingBuffer.TryPush(1));
+			SPEC_TEST_TRUE(RingBuffer.TryPush(2));
+			SPEC_TEST_FALSE(RingBuffer.TryPush(3));
+		});
+
+		It("should push and pop batches partially if there is not enough space / data", [this]() {
+			TSpscRingBuffer<int32> RingBuffer(4);
+			const TArray<int32> Input = {1, 2, 3, 4, 5, 6};
+			SPEC_TEST_EQUAL(RingBuffer.PushBatch(Input), 4);
+
+			TArray<int32> Output;
+			Output.SetNumZeroed(6);
+			SPEC_TEST_EQUAL(RingBuffer.PopBatch(Output), 4);
+			const TArray<int32> ExpectedOutput = {1, 2, 3, 4, 0, 0};
+			TestArraysEqual(*this, "popped elements", Output, ExpectedOutput);
+		});
+
+		It("should time out blocking pops on an empty buffer", [this]() {
+			TSpscRingBuffer<int32> RingBuffer(4);
+			int32 Value = 0;
+			SPEC_TEST_FALSE(RingBuffer.Pop(Value, 1));
+		});
+
+		It("should never report more elements than the capacity while observed from a third thread", [this]() {
+			constexpr int32 NumElements = 100000;
+			TSpscRingBuffer<int32> RingBuffer(16);
+			std::atomic<bool> bDone{false};
+			auto Producer = Async(EAsyncExecution::Thread, [&RingBuffer]() {
+				for (int32 i = 0; i < NumElements; i++)
+				{
+					RingBuffer.Push(i);
+				}
+			});
+			auto Consumer = Async(EAsyncExecution::Thread, [&RingBuffer, &bDone]() {
+				int32 Value = 0;
+				for (int32 i = 0; i < NumElements; i++)
+				{
+					RingBuffer.Pop(Value);
+				}
+				bDone = true;
+			});
+
+			uint32 MaxObservedNum = 0;
+			while (!bDone)
+			{
+				MaxObservedNum = FMath::Max(MaxObservedNum, RingBuffer.Num());
+			}
+			Producer.Wait();
+			Consumer.Wait();
+
+			SPEC_TEST_TRUE(MaxObservedNum <= RingBuffer.GetCapacity());
+			SPEC_TEST_TRUE(RingBuffer.IsEmpty());
+		});
+
+		It("should wake up a blocked consumer when an element is pushed", [this]() {
+			TSpscRingBuffer<int32> RingBuffer(4);
+			auto Consumer = Async(EAsyncExecution::Thread, [&RingBuffer]() {
+				int32 Value = INDEX_NONE;
+				// Generous timeout, so a missed wake-up fails the test instead of hanging it
+				return RingBuffer.Pop(Value, 5000) ? Value : INDEX_NONE;
+			});
+
+			// Give the consumer time to get past spinning and go to sleep on the event
+			FPlatformProcess::Sleep(0.05f);
+			const double PushTime = FPlatformTime::Seconds();
+			RingBuffer.TryPush(42);
+			const int32 PoppedValue = Consumer.Get();
+			const double WakeUpSeconds = FPlatformTime::Seconds() - PushTime;
+
+			SPEC_TEST_EQUAL(PoppedValue, 42);
+			SPEC_TEST_TRUE(WakeUpSeconds < 1.0);
+		});
+
+		It("should transfer all elements in order from a producer thread to a consumer thread", [this]() {
+			constexpr int32 NumElements = 100000;
+			TSpscRingBuffer<int32> RingBuffer(64);
+			auto Producer = Async(EAsyncExecution::Thread, [&RingBuffer]() {
+				for (int32 i = 0; i < NumElements; i++)
+				{
+					RingBuffer.Push(i);
+				}
+			});
+
+			bool bInOrder = true;
+			for (int32 i = 0; i < NumElements; i++)
+			{
+				int32 Value = INDEX_NONE;
+				RingBuffer.Pop(Value);
+				bInOrder &= (Value == i);
+			}
+			Producer.Wait();
+			SPEC_TEST_TRUE(bInOrder);
+		});
+	});
+
+	Describe("TMpmcRingBuffer", [this]() {
+		It("should return elements in FIFO order for a single thread", [this]() {
+			TMpmcRingBuffer<int32> RingBuffer(4);
+			const TArray<int32> Input = {1, 2, 3};
+			SPEC_TEST_EQUAL(RingBuffer.PushBatch(Input), 3);
+
+			int32 Value = 0;
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 1);
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 2);
+			SPEC_TEST_TRUE(RingBuffer.TryPop(Value));
+			SPEC_TEST_EQUAL(Value, 3);
+			SPEC_TEST_FALSE(RingBuffer.TryPop(Value));
+		});
+
+		It("should reject pushes when full", [this]() {
+			TMpmcRingBuffer<int32> RingBuffer(2);
+			SPEC_TEST_TRUE(RingBuffer.TryPush(1));
+			SPEC_TEST_TRUE(RingBuffer.TryPush(2));
+			SPEC_TEST_FALSE(RingBuffer.TryPush(3));
+		});
+
+		It("should not lose or duplicate elements with multiple producers and consumers", [this]() {
+			constexpr int32 NumThreads = 4;
+			constexpr int64 NumElementsPerProducer = 50000;
+			TMpmcRingBuffer<int64> RingBuffer(128);
+			std::atomic<int64> ConsumedSum{0};
+			std::atomic<int64> ConsumedNum{0};
+
+			TArray<TFuture<void>> Futures;
+			for (int32 i = 0; i < NumThreads; i++)
+			{
+				Futures.Add(Async(EAsyncExecution::Thread, [&RingBuffer]() {
+					for (int64 Value = 1; Value <= NumElementsPerProducer; Value++)
+					{
+						RingBuffer.Push(Value);
+					}
+				}));
+				Futures.Add(Async(EAsyncExecution::Thread, [&]() {
+					int64 Value = 0;
+					while (ConsumedNum.load() < NumThreads * NumElementsPerProducer)
+					{
+						if (RingBuffer.Pop(Value, 10))
+						{
+							ConsumedSum += Value;
+							++ConsumedNum;
+						}
+					}
+				}));
+			}
+			for (auto& Future : Futures)
+			{
+				Future.Wait();
+			}
+
+			const int64 ExpectedSum = NumThreads * (NumElementsPerProducer * (NumElementsPerProducer + 1) / 2);
+			SPEC_TEST_EQUAL(ConsumedNum.load(), NumThreads * NumElementsPerProducer);
+			SPEC_TEST_EQUAL(ConsumedSum.load(), ExpectedSum);
+		});
+	});
+}
+
+#endif
@@ -0,0 +1,87 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Templates/CircularAggregator.h"
+	#include "Templates/CircularArrayAdaptor.h"
+
+BEGIN_DEFINE_SPEC(
+	FMaskedCircularArraySpec,
+	"OpenUnrealUtilities.Runtime.Templates.MaskedCircularArray",
+	DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FMaskedCircularArraySpec)
+
+void FMaskedCircularArraySpec::Define()
+{
+	It("should round the capacity up to the next power of two", [this]() {
+		const TMaskedCircularArray<int32> TestArray(5);
+		SPEC_TEST_EQUAL(TestArray.GetCapacity(), static_cast<uint32>(8));
+	});
+
+	It("should wrap around and overwrite the oldest elements after the capacity was reached", [this]() {
+		TMaskedCircularArray<int32> TestArray(4);
+		for (int32 i = 1; i <= 6; i++)
+		{
+			TestArray.Add(i);
+		}
+		SPEC_TEST_EQUAL(TestArray.Num(), 4);
+		SPEC_TEST_EQUAL(TestArray.Oldest(), 3);
+		SPEC_TEST_EQUAL(TestArray.Last(), 6);
+		SPEC_TEST_EQUAL(TestArray[0], 3);
+		SPEC_TEST_EQUAL(TestArray[3], 6);
+	});
+
+	It("should iterate all items in chronological order after wrap-around", [this]() {
+		TMaskedCircularArray<int32> TestArray(4);
+		for (int32 i = 1; i <= 6; i++)
+		{
+			TestArray.Add(i);
+		}
+		TArray<int32> NumbersInRangedFor;
+		for (int32 i : TestArray)
+		{
+			NumbersInRangedFor.Add(i);
+		}
+		const TArray<int32> ExpectedNumbers = {3, 4, 5, 6};
+		TestArraysEqual(*this, "items returned from ranged-based for loop", NumbersInRangedFor, ExpectedNumbers);
+	});
+
+	Describe("GetContiguousViews", [this]() {
+		It("should return a single view before wrap-around", [this]() {
+			TMaskedCircularArray<int32> TestArray(4);
+			TestArray.Add(1);
+			TestArray.Add(2);
+			const auto Views = TestArray.GetContiguousViews();
+			SPEC_TEST_EQUAL(Views.First.Num(), 2);
+			SPEC_TEST_EQUAL(Views.Second.Num(), 0);
+		});
+
+		It("should return all elements in chronological order after wrap-around", [this]() {
+			TMaskedCircularArray<int32> TestArray(4);
+			for (int32 i = 1; i <= 6; i++)
+			{
+				TestArray.Add(i);
+			}
+			TArray<int32> Values;
+			TestArray.GetContiguousViews().AppendTo(Values);
+			const TArray<int32> ExpectedValues = {3, 4, 5, 6};
+			TestArraysEqual(*this, "values of contiguous views", Values, ExpectedValues);
+		});
+
+		It("should return the same elements as iteration for a circular aggregator", [this]() {
+			TFixedSizeCircularAggregator<int32, 3> TestAggregator;
+			for (int32 i = 1; i <= 5; i++)
+			{
+				TestAggregator.Add(i);
+			}
+			TArray<int32> Values;
+			TestAggregator.GetContiguousViews().AppendTo(Values);
+			const TArray<int32> ExpectedValues = {3, 4, 5};
+			TestArraysEqual(*this, "values of contiguous views", Values, ExpectedValues);
+		});
+	});
+}
+
+#endif
@@ -11,6 +11,24 @@ BEGIN_DEFINE_SPEC(
 	"OpenUnrealUtilities.Runtime.Templates.RWLockedVariable",
 	DEFAULT_OUU_TEST_FLAGS)
 	TRWLockedVariable<int32> RWLockedInt{INDEX_NONE};
+
+	bool CanReadLock()
+	{
+		if (RWLockedInt.Lock.TryReadLock() == false)
+			return false;
+
+		RWLockedInt.Lock.ReadUnlock();
+		return true;
+	}
+
+	bool CanWriteLock()
+	{
+		if (RWLockedInt.Lock.TryWriteLock() == false)
+			return false;
+
+		RWLockedInt.Lock.WriteUnlock();
+		return true;
+	}
 END_DEFINE_SPEC(FRWLockedVariableSpec)
 
 void FRWLockedVariableSpec::Define()
@@ -31,6 +49,43 @@ void FRWLockedVariableSpec::Define()
 			SPEC_TEST_EQUAL(RWLockedInt.Read().Get(), 8);
 		});
 	});
+
+	Describe("Scoped reference", [this]() {
+		It("should hold a read lock while a Read() reference is alive", [this]() {
+			{
+				const auto ReadRef = RWLockedInt.Read();
+				SPEC_TEST_TRUE(CanReadLock());
+				SPEC_TEST_FALSE(CanWriteLock());
+			}
+			SPEC_TEST_TRUE(CanWriteLock());
+		});
+
+		It("should hold a write lock while a Write() reference is alive", [this]() {
+			{
+				const auto WriteRef = RWLockedInt.Write();
+				SPEC_TEST_FALSE(CanReadLock());
+			}
+			SPEC_TEST_TRUE(CanReadLock());
+		});
+
+		It("should release the lock only once after being moved", [this]() {
+			{
+				auto WriteRef = RWLockedInt.Write();
+				{
+					const auto MovedWriteRef = MoveTemp(WriteRef);
+					SPEC_TEST_FALSE(CanReadLock());
+				}
+				SPEC_TEST_TRUE(CanWriteLock());
+			}
+			SPEC_TEST_TRUE(CanWriteLock());
+		});
+
+		It("should allow member access via operator->", [this]() {
+			TRWLockedVariable<TArray<int32>> RWLockedArray;
+			RWLockedArray.Write()->Add(5);
+			SPEC_TEST_EQUAL(RWLockedArray.Read()->Num(), 1);
+		});
+	});
 }
 
 #endif
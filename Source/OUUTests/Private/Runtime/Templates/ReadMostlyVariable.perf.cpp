@@ -0,0 +1,97 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Async/Async.h"
+	#include "Templates/RWLockedVariable.h"
+	#include "Templates/ReadMostlyVariable.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  ReadMostlyVariable
+
+namespace OUU::Tests::ReadMostlyVariableBenchmark
+{
+	constexpr int32 NumReaderThreads = 8;
+	constexpr int32 NumReadsPerThread = 1000000;
+	// Rarely updated data: One write for every WriteInterval reads of the first reader thread
+	constexpr int32 WriteInterval = 10000;
+
+	struct FSettings
+	{
+		float Values[8] = {};
+	};
+
+	/**
+	 * Run NumReaderThreads reader threads that each read the variable NumReadsPerThread times.
+	 * The first reader thread also writes the variable every WriteInterval reads.
+	 */
+	template <typename ReadFuncType, typename WriteFuncType>
+	void RunReaders(ReadFuncType&& ReadFunc, WriteFuncType&& WriteFunc)
+	{
+		TArray<TFuture<float>> Readers;
+		for (int32 ThreadIdx = 0; ThreadIdx < NumReaderThreads; ThreadIdx++)
+		{
+			Readers.Add(Async(EAsyncExecution::Thread, [&ReadFunc, &WriteFunc, ThreadIdx]() {
+				float Sum = 0.f;
+				for (int32 i = 0; i < NumReadsPerThread; i++)
+				{
+					if (ThreadIdx == 0 && i % WriteInterval == 0)
+					{
+						WriteFunc(static_cast<float>(i));
+					}
+					Sum += ReadFunc();
+				}
+				return Sum;
+			}));
+		}
+
+		for (auto& Reader : Readers)
+		{
+			Reader.Wait();
+		}
+	}
+} // namespace OUU::Tests::ReadMostlyVariableBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(ConcurrentReads, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::ReadMostlyVariableBenchmark;
+	using namespace OUU::TestUtilities;
+
+	constexpr int64 NumReads = static_cast<int64>(NumReaderThreads) * NumReadsPerThread;
+
+	{
+		TRWLockedVariable<FSettings> Variable;
+		RunAndReportBenchmark(*this, TEXT("TRWLockedVariable"), NumReads, [&]() {
+			RunReaders(
+				[&]() { return Variable.Read()->Values[3]; },
+				[&](float Value) { Variable.Write()->Values[3] = Value; });
+		});
+	}
+
+	{
+		TSeqLockedVariable<FSettings> Variable;
+		RunAndReportBenchmark(*this, TEXT("TSeqLockedVariable"), NumReads, [&]() {
+			RunReaders(
+				[&]() { return Variable.Read()->Values[3]; },
+				[&](float Value) { Variable.Write()->Values[3] = Value; });
+		});
+	}
+
+	{
+		TRcuVariable<FSettings> Variable;
+		RunAndReportBenchmark(*this, TEXT("TRcuVariable"), NumReads, [&]() {
+			RunReaders(
+				[&]() { return Variable.Read()->Values[3]; },
+				[&](float Value) { Variable.Write()->Values[3] = Value; });
+		});
+	}
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,136 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Async/Async.h"
+	#include "Templates/ReadMostlyVariable.h"
+
+namespace OUU::Tests::ReadMostlyVariable
+{
+	struct FTriplet
+	{
+		int64 A = 0;
+		int64 B = 0;
+		int64 C = 0;
+
+		bool IsConsistent() const { return A == B && B == C; }
+	};
+} // namespace OUU::Tests::ReadMostlyVariable
+
+BEGIN_DEFINE_SPEC(
+	FReadMostlyVariableSpec,
+	"OpenUnrealUtilities.Runtime.Templates.ReadMostlyVariable",
+	DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FReadMostlyVariableSpec)
+
+void FReadMostlyVariableSpec::Define()
+{
+	using namespace OUU::Tests::ReadMostlyVariable;
+
+	Describe("TSeqLockedVariable", [this]() {
+		It("should return the initial value on Read", [this]() {
+			TSeqLockedVariable<int32> SeqLockedInt{42};
+			SPEC_TEST_EQUAL(SeqLockedInt.Read().Get(), 42);
+		});
+
+		It("should allow changing the variable via Write", [this]() {
+			TSeqLockedVariable<int32> SeqLockedInt{2};
+			SeqLockedInt.Write() = 8;
+			SPEC_TEST_EQUAL(SeqLockedInt.Read().Get(), 8);
+			SeqLockedInt.Set(16);
+			SPEC_TEST_EQUAL(SeqLockedInt.Read().Get(), 16);
+		});
+
+		It("should never return torn values while a writer is active", [this]() {
+			TSeqLockedVariable<FTriplet> SeqLockedTriplet;
+			std::atomic<bool> bStop{false};
+			auto Writer = Async(EAsyncExecution::Thread, [&]() {
+				for (int64 i = 1; !bStop.load(); i++)
+				{
+					auto WriteRef = SeqLockedTriplet.Write();
+					WriteRef->A = i;
+					WriteRef->B = i;
+					WriteRef->C = i;
+				}
+			});
+
+			int32 NumTornReads = 0;
+			for (int32 i = 0; i < 100000; i++)
+			{
+				if (!SeqLockedTriplet.Read()->IsConsistent())
+				{
+					NumTornReads++;
+				}
+			}
+			bStop = true;
+			Writer.Wait();
+
+			SPEC_TEST_EQUAL(NumTornReads, 0);
+		});
+	});
+
+	Describe("TRcuVariable", [this]() {
+		It("should return the initial value on Read", [this]() {
+			TRcuVariable<TArray<int32>> RcuArray{TArray<int32>{1, 2, 3}};
+			TestArraysEqual(*this, "Read", RcuArray.Read().Get(), TArray<int32>{1, 2, 3});
+		});
+
+		It("should publish changes when the write ref goes out of scope", [this]() {
+			TRcuVariable<TArray<int32>> RcuArray{TArray<int32>{1, 2, 3}};
+			{
+				auto WriteRef = RcuArray.Write();
+				WriteRef->Add(4);
+				TestArraysEqual(*this, "Read while writing", RcuArray.Read().Get(), TArray<int32>{1, 2, 3});
+			}
+			TestArraysEqual(*this, "Read after writing", RcuArray.Read().Get(), TArray<int32>{1, 2, 3, 4});
+		});
+
+		It("should keep old versions alive while they are being read", [this]() {
+			TRcuVariable<TArray<int32>> RcuArray{TArray<int32>{1, 2, 3}};
+			const auto ReadRef = RcuArray.Read();
+			RcuArray.Set(TArray<int32>{5});
+
+			TestArraysEqual(*this, "Old read ref", ReadRef.Get(), TArray<int32>{1, 2, 3});
+			TestArraysEqual(*this, "New read ref", RcuArray.Read().Get(), TArray<int32>{5});
+			SPEC_TEST_EQUAL(RcuArray.GetNumRetiredValues(), 1);
+		});
+
+		It("should delete old versions once no reader is active anymore", [this]() {
+			TRcuVariable<TArray<int32>> RcuArray{TArray<int32>{1, 2, 3}};
+			{
+				const auto ReadRef = RcuArray.Read();
+				RcuArray.Set(TArray<int32>{4});
+			}
+			RcuArray.Set(TArray<int32>{5});
+			SPEC_TEST_EQUAL(RcuArray.GetNumRetiredValues(), 0);
+		});
+
+		It("should only return consistent versions while a writer is active", [this]() {
+			TRcuVariable<FTriplet> RcuTriplet;
+			std::atomic<bool> bStop{false};
+			auto Writer = Async(EAsyncExecution::Thread, [&]() {
+				for (int64 i = 1; !bStop.load(); i++)
+				{
+					RcuTriplet.Set(FTriplet{i, i, i});
+				}
+			});
+
+			int32 NumInconsistentReads = 0;
+			for (int32 i = 0; i < 100000; i++)
+			{
+				if (!RcuTriplet.Read()->IsConsistent())
+				{
+					NumInconsistentReads++;
+				}
+			}
+			bStop = true;
+			Writer.Wait();
+
+			SPEC_TEST_EQUAL(NumInconsistentReads, 0);
+		});
+	});
+}
+
+#endif
@@ -4,8 +4,15 @@
 
 #if WITH_AUTOMATION_WORKER
 
+	#include "Math/RandomStream.h"
 	#include "Templates/CircularAggregator.h"
 
+static_assert(
+	std::is_convertible_v<
+		TRunningCircularAggregator<int32>*,
+		TCircularAggregator_Base<TRunningCircularAggregator<int32>, int32, FDefaultAllocator>*> == false,
+	"Running aggregators must not expose the base aggregator, because its Add() bypasses the running statistics");
+
 BEGIN_DEFINE_SPEC(
 	FRingAggregatorSpec,
 	"OpenUnrealUtilities.Runtime.Templates.CircularAggregator",
@@ -264,6 +271,97 @@ void FRingAggregatorSpec::Define()
 			}
 		});
 	});
+
+	Describe("TRunningCircularAggregator", [this]() {
+		It("should match the results of TCircularAggregator for a random integer sequence", [this]() {
+			constexpr int32 MaxNum = 7;
+			TCircularAggregator<int32> ReferenceAggregator(MaxNum);
+			TRunningCircularAggregator<int32> TestAggregator(MaxNum);
+
+			FRandomStream RandomStream(42);
+			for (int32 i = 0; i < 100; i++)
+			{
+				const int32 Value = RandomStream.RandRange(-100, 100);
+				ReferenceAggregator.Add(Value);
+				TestAggregator.Add(Value);
+
+				SPEC_TEST_EQUAL(TestAggregator.Sum(), ReferenceAggregator.Sum());
+				SPEC_TEST_EQUAL(TestAggregator.Average(), ReferenceAggregator.Average());
+				SPEC_TEST_EQUAL(TestAggregator.Max(), ReferenceAggregator.Max());
+				SPEC_TEST_EQUAL(TestAggregator.Min(), ReferenceAggregator.Min());
+			}
+		});
+
+		It("should match the results of TCircularAggregator for a random float sequence", [this]() {
+			TFixedSizeCircularAggregator<float, 60> ReferenceAggregator;
+			TFixedSizeRunningCircularAggregator<float, 60> TestAggregator;
+
+			FRandomStream RandomStream(42);
+			for (int32 i = 0; i < 1000; i++)
+			{
+				const float Value = RandomStream.FRandRange(0.f, 0.1f);
+				ReferenceAggregator.Add(Value);
+				TestAggregator.Add(Value);
+
+				SPEC_TEST_TRUE(FMath::IsNearlyEqual(TestAggregator.Sum(), ReferenceAggregator.Sum(), 1.e-4f));
+				SPEC_TEST_TRUE(FMath::IsNearlyEqual(TestAggregator.Average(), ReferenceAggregator.Average(), 1.e-6f));
+				SPEC_TEST_EQUAL(TestAggregator.Max(), ReferenceAggregator.Max());
+				SPEC_TEST_EQUAL(TestAggregator.Min(), ReferenceAggregator.Min());
+			}
+		});
+
+		It("should return 3 as max and 1 as min for the sequence 2,3,1", [this]() {
+			TFixedSizeRunningCircularAggregator<int32, 3> TestAggregator;
+			TestAggregator.Add(2);
+			TestAggregator.Add(3);
+			TestAggregator.Add(1);
+			SPEC_TEST_EQUAL(TestAggregator.Max(), 3);
+			SPEC_TEST_EQUAL(TestAggregator.Min(), 1);
+		});
+
+		It("should drop elements that left the window from min and max", [this]() {
+			TFixedSizeRunningCircularAggregator<int32, 3> TestAggregator;
+			TestAggregator.Add(9);
+			TestAggregator.Add(-9);
+			TestAggregator.Add(2);
+			TestAggregator.Add(3);
+			TestAggregator.Add(4);
+			SPEC_TEST_EQUAL(TestAggregator.Max(), 4);
+			SPEC_TEST_EQUAL(TestAggregator.Min(), 2);
+			SPEC_TEST_EQUAL(TestAggregator.Sum(), 9);
+		});
+
+		It("should give read-only access to the elements in insertion order", [this]() {
+			TFixedSizeRunningCircularAggregator<int32, 3> TestAggregator;
+			TestAggregator.Add(1);
+			TestAggregator.Add(2);
+			TestAggregator.Add(3);
+			TestAggregator.Add(4);
+			SPEC_TEST_EQUAL(TestAggregator.Num(), 3);
+			SPEC_TEST_TRUE(TestAggregator.HasData());
+			SPEC_TEST_EQUAL(TestAggregator.Oldest(), 2);
+			SPEC_TEST_EQUAL(TestAggregator.Last(), 4);
+			SPEC_TEST_EQUAL(TestAggregator[0], 2);
+
+			int32 IteratedSum = 0;
+			for (const int32 Element : TestAggregator)
+			{
+				IteratedSum += Element;
+			}
+			SPEC_TEST_EQUAL(IteratedSum, TestAggregator.Sum());
+		});
+
+		It("should return 0 for all statistics after Reset", [this]() {
+			TFixedSizeRunningCircularAggregator<int32, 3> TestAggregator;
+			TestAggregator.Add(5);
+			TestAggregator.Add(6);
+			TestAggregator.Reset();
+			SPEC_TEST_EQUAL(TestAggregator.Sum(), 0);
+			SPEC_TEST_EQUAL(TestAggregator.Average(), 0);
+			SPEC_TEST_EQUAL(TestAggregator.Max(), 0);
+			SPEC_TEST_EQUAL(TestAggregator.Min(), 0);
+		});
+	});
 }
 
 #endif
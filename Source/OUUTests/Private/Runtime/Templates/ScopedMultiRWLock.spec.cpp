@@ -57,6 +57,45 @@ void FScopedMultiRWLockSpec::Define()
 			IntRef1 = 3;
 			SPEC_TEST_EQUAL(RealInt, 3);
 		});
+
+		It("should keep the constructor argument order independent of the lock order", [this]() {
+			const auto ScopedMultiLock = MakeScopedMultiRWLock(Write(RWLockedInt), Read(RWLockedArray));
+			ScopedMultiLock.GetByIdx<0>() = 7;
+			SPEC_TEST_EQUAL(RWLockedInt.GetRefWithoutLocking_USE_WITH_CAUTION(), 7);
+			SPEC_TEST_EQUAL(ScopedMultiLock.GetByIdx<1>().Num(), 0);
+		});
+	});
+
+	Describe("TryMakeScopedMultiRWLock", [this]() {
+		It("should acquire all locks if they are available", [this]() {
+			const auto ScopedMultiLock = TryMakeScopedMultiRWLock(0.0, Read(RWLockedArray), Write(RWLockedInt));
+			SPEC_TEST_TRUE(ScopedMultiLock.IsLocked());
+			SPEC_TEST_EQUAL(ScopedMultiLock.GetByIdx<1>(), 5);
+		});
+
+		It("should release all acquired locks if any lock is not available", [this]() {
+			const auto IntWriteRef = RWLockedInt.Write();
+			{
+				const auto ScopedMultiLock = TryMakeScopedMultiRWLock(0.0, Write(RWLockedArray), Read(RWLockedInt));
+				SPEC_TEST_FALSE(ScopedMultiLock.IsLocked());
+			}
+
+			// The array must not remain locked by the failed attempt
+			const auto ArrayOnlyLock = TryMakeScopedMultiRWLock(0.0, Write(RWLockedArray));
+			SPEC_TEST_TRUE(ArrayOnlyLock.IsLocked());
+		});
+
+		It("should give up after the timeout expired", [this]() {
+			const auto IntWriteRef = RWLockedInt.Write();
+
+			const double TimeoutSeconds = 0.01;
+			const double StartTime = FPlatformTime::Seconds();
+			const auto ScopedMultiLock = TryMakeScopedMultiRWLock(TimeoutSeconds, Write(RWLockedInt));
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			SPEC_TEST_FALSE(ScopedMultiLock.IsLocked());
+			SPEC_TEST_TRUE(ElapsedTime >= TimeoutSeconds);
+		});
 	});
 }
 
@@ -0,0 +1,183 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Math/RandomStream.h"
+	#include "Templates/SlotMap.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  SlotMap
+
+namespace OUU::Tests::SlotMapBenchmark
+{
+	constexpr int32 ContainerSizes[] = {1000, 10000, 100000, 1000000};
+
+	struct FBenchmarkHandle : public FIndexedHandleBase
+	{
+		FBenchmarkHandle() = default;
+		FBenchmarkHandle(const int32 InIndex, const uint32 InSerialNumber) : FIndexedHandleBase(InIndex, InSerialNumber)
+		{
+		}
+	};
+
+	struct FPayload
+	{
+		FVector Location = FVector::ZeroVector;
+		int32 Id = 0;
+	};
+
+	template <typename KeyType>
+	TArray<KeyType> MakeShuffledCopy(const TArray<KeyType>& Keys)
+	{
+		FRandomStream Stream(42);
+		TArray<KeyType> Result = Keys;
+		for (int32 i = Result.Num() - 1; i > 0; i--)
+		{
+			Result.Swap(i, Stream.RandRange(0, i));
+		}
+		return Result;
+	}
+
+	/**
+	 * Run insert, random lookup, iteration and removal of every second element for one container type.
+	 * The container specific operations are passed as lambdas, so all containers run the exact same workload.
+	 */
+	template <
+		typename ContainerType,
+		typename KeyType,
+		typename AddFuncType,
+		typename FindFuncType,
+		typename SumFuncType,
+		typename RemoveFuncType>
+	int64 RunWorkload(
+		FAutomationTestBase& Test,
+		const TCHAR* ContainerName,
+		int32 Num,
+		AddFuncType&& AddFunc,
+		FindFuncType&& FindFunc,
+		SumFuncType&& SumFunc,
+		RemoveFuncType&& RemoveFunc)
+	{
+		using namespace OUU::TestUtilities;
+
+		ContainerType Container;
+		TArray<KeyType> Keys;
+		Keys.Reserve(Num);
+
+		RunAndReportBenchmark(Test, FString::Printf(TEXT("%s insert (%i)"), ContainerName, Num), Num, [&]() {
+			Container = ContainerType();
+			Keys.Reset();
+			for (int32 i = 0; i < Num; i++)
+			{
+				Keys.Add(AddFunc(Container, FPayload{FVector(i), i}));
+			}
+		});
+
+		const TArray<KeyType> ShuffledKeys = MakeShuffledCopy(Keys);
+		int64 LookupSum = 0;
+		RunAndReportBenchmark(Test, FString::Printf(TEXT("%s random lookup (%i)"), ContainerName, Num), Num, [&]() {
+			for (const KeyType& Key : ShuffledKeys)
+			{
+				if (const FPayload* Payload = FindFunc(Container, Key))
+				{
+					LookupSum += Payload->Id;
+				}
+			}
+		});
+
+		int64 IterationSum = 0;
+		RunAndReportBenchmark(Test, FString::Printf(TEXT("%s iterate (%i)"), ContainerName, Num), Num, [&]() {
+			IterationSum += SumFunc(Container);
+		});
+
+		RunAndReportBenchmark(Test, FString::Printf(TEXT("%s remove half (%i)"), ContainerName, Num), Num / 2, [&]() {
+			for (int32 i = 0; i < ShuffledKeys.Num(); i += 2)
+			{
+				RemoveFunc(Container, ShuffledKeys[i]);
+			}
+		});
+
+		return LookupSum + IterationSum;
+	}
+} // namespace OUU::Tests::SlotMapBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(VsMapAndSparseArray, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::SlotMapBenchmark;
+
+	using FSlotMap = TSlotMap<FBenchmarkHandle, FPayload>;
+	using FMap = TMap<FBenchmarkHandle, FPayload>;
+	using FSparseArray = TSparseArray<FPayload>;
+
+	for (const int32 Num : ContainerSizes)
+	{
+		const int64 SlotMapResult = RunWorkload<FSlotMap, FBenchmarkHandle>(
+			*this,
+			TEXT("TSlotMap"),
+			Num,
+			[](FSlotMap& Container, FPayload Payload) { return Container.Add(Payload); },
+			[](FSlotMap& Container, const FBenchmarkHandle& Handle) { return Container.Find(Handle); },
+			[](const FSlotMap& Container) {
+				int64 Sum = 0;
+				for (const FPayload& Payload : Container)
+				{
+					Sum += Payload.Id;
+				}
+				return Sum;
+			},
+			[](FSlotMap& Container, const FBenchmarkHandle& Handle) { Container.Remove(Handle); });
+
+		// TMap keyed by handles that are created with the same scheme a handle manager would use
+		int32 NextIndex = 0;
+		const int64 MapResult = RunWorkload<FMap, FBenchmarkHandle>(
+			*this,
+			TEXT("TMap"),
+			Num,
+			[&NextIndex, Num](FMap& Container, FPayload Payload) {
+				const FBenchmarkHandle Handle(NextIndex++ % Num, 1);
+				Container.Add(Handle, Payload);
+				return Handle;
+			},
+			[](FMap& Container, const FBenchmarkHandle& Handle) { return Container.Find(Handle); },
+			[](const FMap& Container) {
+				int64 Sum = 0;
+				for (const auto& Entry : Container)
+				{
+					Sum += Entry.Value.Id;
+				}
+				return Sum;
+			},
+			[](FMap& Container, const FBenchmarkHandle& Handle) { Container.Remove(Handle); });
+
+		// TSparseArray has no stale-handle detection, so this is the lower bound for index based lookups
+		const int64 SparseArrayResult = RunWorkload<FSparseArray, int32>(
+			*this,
+			TEXT("TSparseArray"),
+			Num,
+			[](FSparseArray& Container, FPayload Payload) { return Container.Add(Payload); },
+			[](FSparseArray& Container, int32 Index) {
+				return Container.IsValidIndex(Index) ? &Container[Index] : nullptr;
+			},
+			[](const FSparseArray& Container) {
+				int64 Sum = 0;
+				for (const FPayload& Payload : Container)
+				{
+					Sum += Payload.Id;
+				}
+				return Sum;
+			},
+			[](FSparseArray& Container, int32 Index) { Container.RemoveAt(Index); });
+
+		TestEqual(FString::Printf(TEXT("TMap result (%i)"), Num), MapResult, SlotMapResult);
+		TestEqual(FString::Printf(TEXT("TSparseArray result (%i)"), Num), SparseArrayResult, SlotMapResult);
+	}
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Templates/SlotMap.h"
+
+namespace OUU::Tests::SlotMap
+{
+	struct FTestHandle : public FIndexedHandleBase
+	{
+		FTestHandle() = default;
+		FTestHandle(const int32 InIndex, const uint32 InSerialNumber) : FIndexedHandleBase(InIndex, InSerialNumber) {}
+	};
+
+	using FTestSlotMap = TSlotMap<FTestHandle, FString>;
+} // namespace OUU::Tests::SlotMap
+
+BEGIN_DEFINE_SPEC(FSlotMapSpec, "OpenUnrealUtilities.Runtime.Templates.SlotMap", DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FSlotMapSpec)
+
+void FSlotMapSpec::Define()
+{
+	using namespace OUU::Tests::SlotMap;
+
+	Describe("Add / Find", [this]() {
+		It("should find values by the handles returned from Add", [this]() {
+			FTestSlotMap SlotMap;
+			const FTestHandle HandleA = SlotMap.Add(TEXT("A"));
+			const FTestHandle HandleB = SlotMap.Emplace(TEXT("B"));
+
+			SPEC_TEST_EQUAL(SlotMap.Num(), 2);
+			SPEC_TEST_TRUE(HandleA.IsValid());
+			SPEC_TEST_TRUE(HandleA != HandleB);
+			SPEC_TEST_EQUAL(SlotMap[HandleA], FString(TEXT("A")));
+			SPEC_TEST_EQUAL(*SlotMap.Find(HandleB), FString(TEXT("B")));
+		});
+
+		It("should not find values for default constructed or out of range handles", [this]() {
+			FTestSlotMap SlotMap;
+			SlotMap.Add(TEXT("A"));
+
+			SPEC_TEST_NULL(SlotMap.Find(FTestHandle()));
+			SPEC_TEST_NULL(SlotMap.Find(FTestHandle(0, 0)));
+			SPEC_TEST_NULL(SlotMap.Find(FTestHandle(100, 1)));
+		});
+	});
+
+	Describe("Remove", [this]() {
+		It("should keep the remaining handles valid", [this]() {
+			FTestSlotMap SlotMap;
+			TArray<FTestHandle> Handles;
+			for (int32 i = 0; i < 10; i++)
+			{
+				Handles.Add(SlotMap.Add(LexToString(i)));
+			}
+
+			SPEC_TEST_TRUE(SlotMap.Remove(Handles[0]));
+			SPEC_TEST_TRUE(SlotMap.Remove(Handles[5]));
+			SPEC_TEST_FALSE(SlotMap.Remove(Handles[5]));
+
+			SPEC_TEST_EQUAL(SlotMap.Num(), 8);
+			for (int32 i = 0; i < 10; i++)
+			{
+				const FString* Value = SlotMap.Find(Handles[i]);
+				if (i == 0 || i == 5)
+				{
+					SPEC_TEST_NULL(Value);
+				}
+				else if (SPEC_TEST_NOT_NULL(Value))
+				{
+					SPEC_TEST_EQUAL(*Value, LexToString(i));
+				}
+			}
+		});
+
+		It("should detect stale handles after the slot was reused", [this]() {
+			FTestSlotMap SlotMap;
+			const FTestHandle OldHandle = SlotMap.Add(TEXT("Old"));
+			SlotMap.Remove(OldHandle);
+			const FTestHandle NewHandle = SlotMap.Add(TEXT("New"));
+
+			SPEC_TEST_EQUAL(NewHandle.GetIndex(), OldHandle.GetIndex());
+			SPEC_TEST_FALSE(SlotMap.Contains(OldHandle));
+			SPEC_TEST_EQUAL(SlotMap[NewHandle], FString(TEXT("New")));
+			SPEC_TEST_EQUAL(SlotMap.GetNumSlots(), 1);
+		});
+
+		It("should invalidate all handles on Reset", [this]() {
+			FTestSlotMap SlotMap;
+			const FTestHandle Handle = SlotMap.Add(TEXT("A"));
+			SlotMap.Reset();
+			SlotMap.Add(TEXT("B"));
+
+			SPEC_TEST_FALSE(SlotMap.Contains(Handle));
+			SPEC_TEST_EQUAL(SlotMap.Num(), 1);
+		});
+
+		It("should remove values matching a predicate", [this]() {
+			FTestSlotMap SlotMap;
+			for (int32 i = 0; i < 10; i++)
+			{
+				SlotMap.Add(LexToString(i));
+			}
+
+			const int32 NumRemoved = SlotMap.RemoveAll([](const FTestHandle&, const FString& Value) {
+				return FCString::Atoi(*Value) % 2 == 0;
+			});
+
+			SPEC_TEST_EQUAL(NumRemoved, 5);
+			SPEC_TEST_EQUAL(SlotMap.Num(), 5);
+			for (const FString& Value : SlotMap)
+			{
+				SPEC_TEST_EQUAL(FCString::Atoi(*Value) % 2, 1);
+			}
+		});
+	});
+
+	Describe("Iteration", [this]() {
+		It("should pass matching handles and values in ForEach", [this]() {
+			FTestSlotMap SlotMap;
+			for (int32 i = 0; i < 10; i++)
+			{
+				SlotMap.Add(LexToString(i));
+			}
+			SlotMap.Remove(SlotMap.GetHandleAtDenseIndex(3));
+
+			int32 NumVisited = 0;
+			SlotMap.ForEach([&](const FTestHandle& Handle, const FString& Value) {
+				SPEC_TEST_TRUE(SlotMap.Find(Handle) == &Value);
+				NumVisited++;
+			});
+			SPEC_TEST_EQUAL(NumVisited, 9);
+			SPEC_TEST_EQUAL(SlotMap.GetValues().Num(), 9);
+		});
+	});
+}
+
+#endif
@@ -177,6 +177,90 @@ void FStringUtilsSpec::Define()
 			SPEC_TEST_EQUAL(Result, "[Alpha, Beta, Gamma]");
 		});
 	});
+
+	Describe("MapToString", [this]() {
+		It("should return a comma separated list of quoted key value pairs", [this]() {
+			TMap<FString, int32> SourceMap;
+			SourceMap.Add("apple", 1);
+			SourceMap.Add("banana", 2);
+			const FString Result = MapToString(SourceMap);
+			SPEC_TEST_EQUAL(Result, "{\"apple\" : 1, \"banana\" : 2}");
+		});
+	});
+
+	Describe("LexAppend", [this]() {
+		It("should produce the same results as LexToString", [this]() {
+			TStringBuilder<256> Builder;
+			const FStringUtilsTestStruct Struct{"test_string"};
+			const UObject* NullObject = nullptr;
+
+			LexAppend(Builder, 42);
+			LexAppend(Builder, 1.5f);
+			LexAppend(Builder, true);
+			LexAppend(Builder, FName("name"));
+			LexAppend(Builder, FString("string"));
+			LexAppend(Builder, EStringUtilsTestEnum::Gamma);
+			LexAppend(Builder, Struct);
+			LexAppend(Builder, NullObject);
+
+			const FString Expected = LexToString(42) + LexToString(1.5f) + LexToString(true) + TEXT("name")
+				+ TEXT("string") + TEXT("Gamma") + TEXT("test_string") + LexToString(NullObject);
+			SPEC_TEST_EQUAL(FString(Builder.ToView()), Expected);
+		});
+
+		It("should quote strings with LexAppend_QuotedIfString", [this]() {
+			TStringBuilder<64> Builder;
+			LexAppend_QuotedIfString(Builder, FName("apple"));
+			LexAppend_QuotedIfString(Builder, 3);
+			SPEC_TEST_EQUAL(FString(Builder.ToView()), "\"apple\"3");
+		});
+	});
+
+	Describe("AppendArrayToString", [this]() {
+		It("should produce the same result as ArrayToString", [this]() {
+			const TArray<FName> SourceArray = {"apple", "banana", "citrus", "dragon fruit"};
+			TStringBuilder<256> Builder;
+			AppendArrayToString(Builder, SourceArray);
+			SPEC_TEST_EQUAL(FString(Builder.ToView()), ArrayToString(SourceArray));
+		});
+
+		It("should allocate less than concatenating FStrings", [this]() {
+			TArray<int32> SourceArray;
+			for (int32 i = 0; i < 32; i++)
+			{
+				SourceArray.Add(i * 1000);
+			}
+			TStringBuilder<512> Builder;
+
+			if (OUU::TestUtilities::FScopedAllocationCounter::IsAvailable() == false)
+			{
+				AddInfo(TEXT("Skipped: Counting allocations requires -OUUCountAllocations"));
+				return;
+			}
+			OUU::TestUtilities::FScopedAllocationCounter AllocationCounter;
+
+			// Previous ArrayToString implementation
+			const FString JoinedString =
+				FString::Printf(TEXT("[%s]"), *FString::JoinBy(SourceArray, TEXT(", "), [](auto& Element) {
+					return LexToString_QuotedIfString<int32>(Element);
+				}));
+			const int64 NumAllocationsConcatenated = AllocationCounter.GetNumAllocations();
+
+			AllocationCounter.Reset();
+			AppendArrayToString(Builder, SourceArray);
+			const int64 NumAllocationsBuilder = AllocationCounter.GetNumAllocations();
+
+			AddInfo(FString::Printf(
+				TEXT("Allocations for %i elements: FString concatenation: %lld, TStringBuilder: %lld"),
+				SourceArray.Num(),
+				NumAllocationsConcatenated,
+				NumAllocationsBuilder));
+
+			SPEC_TEST_EQUAL(FString(Builder.ToView()), JoinedString);
+			SPEC_TEST_EQUAL(NumAllocationsBuilder, static_cast<int64>(0));
+			SPEC_TEST_TRUE(NumAllocationsConcatenated > NumAllocationsBuilder);
+		});
+	});
 }
 
 #endif
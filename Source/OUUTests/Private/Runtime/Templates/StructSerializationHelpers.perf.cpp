@@ -0,0 +1,128 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Runtime/Templates/StructSerializationHelpersTests_Types.h"
+	#include "Serialization/MemoryWriter.h"
+	#include "Templates/StructSerializationHelpers.h"
+
+	#define OUU_TEST_CATEGORY OpenUnrealUtilities.Runtime.Templates.Benchmarks
+	#define OUU_TEST_TYPE	  StructSerializationHelpers
+
+namespace OUU::Tests::StructSerializationHelpersBenchmark
+{
+	constexpr int32 NumSnapshots = 20000;
+
+	FStructSerializationTests_SaveGame MakeSaveGame()
+	{
+		FStructSerializationTests_SaveGame SaveGame;
+		SaveGame.PlayerName = TEXT("BenchmarkPlayer");
+		SaveGame.Level = 40;
+		SaveGame.Experience = 1234567;
+		for (int32 i = 0; i < 64; i++)
+		{
+			SaveGame.UnlockedItems.Add(i);
+			SaveGame.Inventory.Add(FName(TEXT("Item"), i), i);
+		}
+		SaveGame.Stats.LastCheckpoint = TEXT("Checkpoint");
+		return SaveGame;
+	}
+
+	/** Serialize NumSnapshots snapshots where only the location and stamina change between frames */
+	template <typename SerializeFuncType>
+	int64 SerializeSnapshots(SerializeFuncType&& SerializeFunc)
+	{
+		const FStructSerializationTests_SaveGame Baseline = MakeSaveGame();
+		FStructSerializationTests_SaveGame Snapshot = Baseline;
+
+		TArray<uint8> Bytes;
+		Bytes.Reserve(1024 * 1024);
+		int64 NumBytesWritten = 0;
+		for (int32 i = 0; i < NumSnapshots; i++)
+		{
+			Snapshot.Location.X = static_cast<double>(i);
+			Snapshot.Stats.Stamina = static_cast<float>(i % 100) / 100.f;
+
+			Bytes.Reset();
+			FMemoryWriter Writer(Bytes, true);
+			SerializeFunc(Writer, Snapshot, Baseline);
+			NumBytesWritten += Bytes.Num();
+		}
+		return NumBytesWritten;
+	}
+} // namespace OUU::Tests::StructSerializationHelpersBenchmark
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(SaveGameSnapshots, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::Tests::StructSerializationHelpersBenchmark;
+	using namespace OUU::TestUtilities;
+
+	auto Report = [this](const TCHAR* Name, int64 NumBytesWritten) {
+		AddInfo(FString::Printf(
+			TEXT("%s: %lld bytes total, %.1f bytes per snapshot"),
+			Name,
+			NumBytesWritten,
+			static_cast<double>(NumBytesWritten) / NumSnapshots));
+	};
+
+	int64 NumBytesTagged = 0;
+	RunAndReportBenchmark(*this, TEXT("Tagged properties"), NumSnapshots, [&]() {
+		NumBytesTagged = SerializeSnapshots([](FArchive& Ar, auto& Snapshot, const auto&) {
+			OUU::Runtime::DefaultStructSerialization(Snapshot, Ar);
+		});
+	});
+	Report(TEXT("Tagged properties"), NumBytesTagged);
+
+	int64 NumBytesBinary = 0;
+	RunAndReportBenchmark(*this, TEXT("SerializeBin"), NumSnapshots, [&]() {
+		NumBytesBinary = SerializeSnapshots([](FArchive& Ar, auto& Snapshot, const auto&) {
+			FStructSerializationTests_SaveGame::StaticStruct()->SerializeBin(Ar, &Snapshot);
+		});
+	});
+	Report(TEXT("SerializeBin"), NumBytesBinary);
+
+	int64 NumBytesDelta = 0;
+	RunAndReportBenchmark(*this, TEXT("SerializeStructDelta"), NumSnapshots, [&]() {
+		NumBytesDelta = SerializeSnapshots([](FArchive& Ar, auto& Snapshot, const auto& Baseline) {
+			OUU::Runtime::SerializeStructDelta(Snapshot, Baseline, Ar);
+		});
+	});
+	Report(TEXT("SerializeStructDelta"), NumBytesDelta);
+
+	TestTrue(TEXT("Delta is smaller than binary serialization"), NumBytesDelta < NumBytesBinary);
+	return true;
+}
+
+OUU_IMPLEMENT_SIMPLE_AUTOMATION_TEST(PodSnapshots, DEFAULT_OUU_BENCHMARK_FLAGS)
+{
+	using namespace OUU::TestUtilities;
+	using namespace OUU::Tests::StructSerializationHelpersBenchmark;
+
+	FStructSerializationTests_Pod Baseline = {};
+	FStructSerializationTests_Pod Snapshot = Baseline;
+	TArray<uint8> Bytes;
+	Bytes.Reserve(1024);
+
+	for (const bool bAllowPodFastPath : {false, true})
+	{
+		const TCHAR* Name = bAllowPodFastPath ? TEXT("SerializeStructDelta (POD)") : TEXT("SerializeStructDelta");
+		RunAndReportBenchmark(*this, Name, NumSnapshots, [&]() {
+			for (int32 i = 0; i < NumSnapshots; i++)
+			{
+				Snapshot.Counters[i % 16] = i;
+				Bytes.Reset();
+				FMemoryWriter Writer(Bytes, true);
+				OUU::Runtime::SerializeStructDelta(Snapshot, Baseline, Writer, bAllowPodFastPath);
+			}
+		});
+	}
+
+	return true;
+}
+
+	#undef OUU_TEST_CATEGORY
+	#undef OUU_TEST_TYPE
+
+#endif
@@ -0,0 +1,192 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#include "OUUTestUtilities.h"
+
+#if WITH_AUTOMATION_WORKER
+
+	#include "Runtime/Templates/StructSerializationHelpersTests_Types.h"
+	#include "Serialization/MemoryReader.h"
+	#include "Serialization/MemoryWriter.h"
+	#include "Templates/StructSerializationHelpers.h"
+
+namespace OUU::Tests::StructSerializationHelpers
+{
+	FStructSerializationTests_SaveGame MakeSaveGame()
+	{
+		FStructSerializationTests_SaveGame SaveGame;
+		SaveGame.PlayerName = TEXT("Player");
+		SaveGame.Location = FVector(100.f, 200.f, 300.f);
+		SaveGame.Level = 12;
+		SaveGame.Experience = 123456;
+		SaveGame.UnlockedItems = {1, 2, 3, 5, 8};
+		SaveGame.Inventory.Add(TEXT("Potion"), 3);
+		SaveGame.Stats.LastCheckpoint = TEXT("Cave");
+		return SaveGame;
+	}
+
+	FStructSerializationTests_Pod MakePod()
+	{
+		FStructSerializationTests_Pod Pod = {};
+		for (int32 i = 0; i < static_cast<int32>(UE_ARRAY_COUNT(Pod.Counters)); i++)
+		{
+			Pod.Counters[i] = i * 10;
+		}
+		Pod.Flags = 0b101;
+		return Pod;
+	}
+
+	template <typename StructType>
+	TArray<uint8> SaveDelta(StructType& Data, const StructType& Baseline, bool bAllowPodFastPath = false)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes, true);
+		OUU::Runtime::SerializeStructDelta(Data, Baseline, Writer, bAllowPodFastPath);
+		return Bytes;
+	}
+
+	template <typename StructType>
+	bool LoadDelta(
+		const TArray<uint8>& Bytes,
+		StructType& Data,
+		const StructType& Baseline,
+		bool bAllowPodFastPath = false)
+	{
+		FMemoryReader Reader(Bytes, true);
+		return OUU::Runtime::SerializeStructDelta(Data, Baseline, Reader, bAllowPodFastPath);
+	}
+
+	template <typename StructType>
+	bool AreIdentical(const StructType& A, const StructType& B)
+	{
+		return StructType::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+	}
+} // namespace OUU::Tests::StructSerializationHelpers
+
+BEGIN_DEFINE_SPEC(
+	FStructSerializationHelpersSpec,
+	"OpenUnrealUtilities.Runtime.Templates.StructSerializationHelpers",
+	DEFAULT_OUU_TEST_FLAGS)
+END_DEFINE_SPEC(FStructSerializationHelpersSpec)
+void FStructSerializationHelpersSpec::Define()
+{
+	using namespace OUU::Tests::StructSerializationHelpers;
+
+	Describe("SerializeStructDelta", [this]() {
+		It("should only write the changed property bitmask if nothing changed", [this]() {
+			auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+
+			const TArray<uint8> Bytes = SaveDelta(Data, Baseline);
+
+			// One byte for the property count, four bytes for the schema hash and two bytes for the bitmask of the
+			// 9 non-transient properties
+			SPEC_TEST_EQUAL(Bytes.Num(), 7);
+		});
+
+		It("should restore changed properties on top of the baseline", [this]() {
+			const auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+			Data.Level = 13;
+			Data.UnlockedItems.Add(13);
+			Data.Inventory.Add(TEXT("Sword"), 1);
+
+			const TArray<uint8> Bytes = SaveDelta(Data, Baseline);
+
+			FStructSerializationTests_SaveGame Loaded;
+			SPEC_TEST_TRUE(LoadDelta(Bytes, Loaded, Baseline));
+			SPEC_TEST_TRUE(AreIdentical(Loaded, Data));
+		});
+
+		It("should write less data than the full struct if only a few properties changed", [this]() {
+			const auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+			Data.Experience += 50;
+
+			TArray<uint8> FullBytes;
+			FMemoryWriter Writer(FullBytes, true);
+			OUU::Runtime::DefaultStructSerialization(Data, Writer);
+
+			SPEC_TEST_TRUE(SaveDelta(Data, Baseline).Num() < FullBytes.Num());
+		});
+
+		It("should serialize changes in nested structs as nested delta", [this]() {
+			const auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+			Data.Stats.Health = 42;
+
+			const TArray<uint8> Bytes = SaveDelta(Data, Baseline);
+			FStructSerializationTests_SaveGame Loaded;
+			SPEC_TEST_TRUE(LoadDelta(Bytes, Loaded, Baseline));
+
+			SPEC_TEST_EQUAL(Loaded.Stats.Health, 42);
+			SPEC_TEST_EQUAL(Loaded.Stats.LastCheckpoint, FName(TEXT("Cave")));
+			// outer property count + hash + mask, inner property count + hash + mask, int32 value
+			SPEC_TEST_EQUAL(Bytes.Num(), 7 + 6 + 4);
+		});
+
+		It("should not serialize transient properties", [this]() {
+			const auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+			Data.TransientValue = 42;
+
+			const TArray<uint8> Bytes = SaveDelta(Data, Baseline);
+			FStructSerializationTests_SaveGame Loaded;
+			SPEC_TEST_TRUE(LoadDelta(Bytes, Loaded, Baseline));
+
+			SPEC_TEST_EQUAL(Loaded.TransientValue, 0);
+		});
+
+		It("should support loading into the baseline instance", [this]() {
+			const auto Baseline = MakeSaveGame();
+			auto Data = Baseline;
+			Data.PlayerName = TEXT("Renamed");
+			const TArray<uint8> Bytes = SaveDelta(Data, Baseline);
+
+			auto InPlace = Baseline;
+			SPEC_TEST_TRUE(LoadDelta(Bytes, InPlace, InPlace));
+			SPEC_TEST_EQUAL(InPlace.PlayerName, FString(TEXT("Renamed")));
+		});
+
+		It("should fail to load data that was written for a different struct layout", [this]() {
+			auto Pod = MakePod();
+			const TArray<uint8> Bytes = SaveDelta(Pod, MakePod());
+
+			FStructSerializationTests_SaveGame Loaded;
+			AddExpectedError(TEXT("Struct delta for"));
+			SPEC_TEST_FALSE(LoadDelta(Bytes, Loaded, MakeSaveGame()));
+		});
+
+		It("should fail to load data that was written for different property names or types", [this]() {
+			FStructSerializationTests_Stats Stats;
+			const TArray<uint8> Bytes = SaveDelta(Stats, FStructSerializationTests_Stats());
+
+			// Same number of properties, so only the schema hash tells the structs apart
+			FStructSerializationTests_StatsRenamed Loaded;
+			AddExpectedError(TEXT("Struct delta for"));
+			SPEC_TEST_FALSE(LoadDelta(Bytes, Loaded, FStructSerializationTests_StatsRenamed()));
+		});
+	});
+
+	Describe("SerializeStructDelta for POD structs", [this]() {
+		It("should be flagged as POD", [this]() {
+			SPEC_TEST_TRUE((FStructSerializationTests_Pod::StaticStruct()->StructFlags & STRUCT_IsPlainOldData) != 0);
+		});
+
+		It("should restore changed properties with and without the fast path", [this]() {
+			const auto Baseline = MakePod();
+			auto Data = Baseline;
+			Data.Counters[7] = 777;
+			Data.bActive = true;
+
+			for (const bool bAllowPodFastPath : {true, false})
+			{
+				const TArray<uint8> Bytes = SaveDelta(Data, Baseline, bAllowPodFastPath);
+				FStructSerializationTests_Pod Loaded = {};
+				SPEC_TEST_TRUE(LoadDelta(Bytes, Loaded, Baseline, bAllowPodFastPath));
+				SPEC_TEST_TRUE(AreIdentical(Loaded, Data));
+			}
+		});
+	});
+}
+
+#endif
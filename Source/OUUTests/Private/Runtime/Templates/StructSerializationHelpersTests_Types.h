@@ -0,0 +1,94 @@
+// Copyright (c) 2023 Jonas Reich & Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "StructSerializationHelpersTests_Types.generated.h"
+
+USTRUCT()
+struct FStructSerializationTests_Stats
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	int32 Health = 100;
+
+	UPROPERTY()
+	float Stamina = 1.f;
+
+	UPROPERTY()
+	FName LastCheckpoint;
+};
+
+// Same number of properties as FStructSerializationTests_Stats, but different names and types.
+USTRUCT()
+struct FStructSerializationTests_StatsRenamed
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	int32 Mana = 100;
+
+	UPROPERTY()
+	int32 Stamina = 1;
+
+	UPROPERTY()
+	FName LastCheckpoint;
+};
+
+// Typical save game struct: Few values change between two snapshots.
+USTRUCT()
+struct FStructSerializationTests_SaveGame
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	FString PlayerName;
+
+	UPROPERTY()
+	FVector Location = FVector::ZeroVector;
+
+	UPROPERTY()
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	UPROPERTY()
+	int32 Level = 1;
+
+	UPROPERTY()
+	int64 Experience = 0;
+
+	UPROPERTY()
+	bool bTutorialCompleted = false;
+
+	UPROPERTY()
+	TArray<int32> UnlockedItems;
+
+	UPROPERTY()
+	TMap<FName, int32> Inventory;
+
+	UPROPERTY()
+	FStructSerializationTests_Stats Stats;
+
+	UPROPERTY(Transient)
+	int32 TransientValue = 0;
+};
+
+// No default member initializers, so the struct is flagged as plain old data (STRUCT_IsPlainOldData)
+USTRUCT()
+struct FStructSerializationTests_Pod
+{
+	GENERATED_BODY()
+public:
+	UPROPERTY()
+	int32 Counters[16];
+
+	UPROPERTY()
+	float Position[3];
+
+	UPROPERTY()
+	uint8 Flags;
+
+	UPROPERTY()
+	bool bActive;
+};